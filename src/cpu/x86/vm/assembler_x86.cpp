@@ -1324,6 +1324,56 @@ void Assembler::cpuid() {
   emit_int8((unsigned char)0xA2);
 }
 
+void Assembler::crc32(Register crc, Register v, int8_t sizeInBytes) {
+  assert(VM_Version::supports_sse4_2(), "");
+  emit_int8((unsigned char)0xF2);
+  int encode;
+  switch (sizeInBytes) {
+  case 1:
+    encode = prefix_and_encode(crc->encoding(), v->encoding(), true);
+    break;
+  case 4:
+    encode = prefix_and_encode(crc->encoding(), v->encoding());
+    break;
+#ifdef _LP64
+  case 8:
+    encode = prefixq_and_encode(crc->encoding(), v->encoding());
+    break;
+#endif
+  default:
+    ShouldNotReachHere();
+    return;
+  }
+  emit_int8(0x0F);
+  emit_int8(0x38);
+  emit_int8((unsigned char)(sizeInBytes == 1 ? 0xF0 : 0xF1));
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::crc32(Register crc, Address adr, int8_t sizeInBytes) {
+  assert(VM_Version::supports_sse4_2(), "");
+  InstructionMark im(this);
+  emit_int8((unsigned char)0xF2);
+  switch (sizeInBytes) {
+  case 1:
+  case 4:
+    prefix(adr, crc);
+    break;
+#ifdef _LP64
+  case 8:
+    prefixq(adr, crc);
+    break;
+#endif
+  default:
+    ShouldNotReachHere();
+    return;
+  }
+  emit_int8(0x0F);
+  emit_int8(0x38);
+  emit_int8((unsigned char)(sizeInBytes == 1 ? 0xF0 : 0xF1));
+  emit_operand(crc, adr);
+}
+
 void Assembler::cvtdq2pd(XMMRegister dst, XMMRegister src) {
   NOT_LP64(assert(VM_Version::supports_sse2(), ""));
   emit_simd_arith_nonds(0xE6, dst, src, VEX_SIMD_F3);
@@ -3075,6 +3125,14 @@ void Assembler::xorl(Register dst, Register src) {
   emit_arith(0x33, 0xC0, dst, src);
 }
 
+void Assembler::xorb(Register dst, Address src) {
+  NOT_LP64(assert(dst->has_byte_register(), "must have byte register"));
+  InstructionMark im(this);
+  prefix(src, dst, true);
+  emit_int8(0x32);
+  emit_operand(dst, src);
+}
+
 
 // AVX 3-operands scalar float-point arithmetic instructions
 
@@ -3496,6 +3554,54 @@ void Assembler::pmulld(XMMRegister dst, XMMRegister src) {
   emit_int8((unsigned char)(0xC0 | encode));
 }
 
+void Assembler::pminsd(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_sse4_1(), "");
+  int encode = simd_prefix_and_encode(dst, dst, src, VEX_SIMD_66, VEX_OPCODE_0F_38);
+  emit_int8(0x39);
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::pmaxsd(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_sse4_1(), "");
+  int encode = simd_prefix_and_encode(dst, dst, src, VEX_SIMD_66, VEX_OPCODE_0F_38);
+  emit_int8(0x3D);
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::pmaddubsw(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_ssse3(), "");
+  int encode = simd_prefix_and_encode(dst, dst, src, VEX_SIMD_66, VEX_OPCODE_0F_38);
+  emit_int8(0x04);
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::pmaddwd(XMMRegister dst, XMMRegister src) {
+  NOT_LP64(assert(VM_Version::supports_sse2(), ""));
+  emit_simd_arith(0xF5, dst, src, VEX_SIMD_66);
+}
+
+void Assembler::vpmaddubsw(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256) {
+  assert(VM_Version::supports_avx() && !vector256 || VM_Version::supports_avx2(), "256 bit integer vectors requires AVX2");
+  int encode = vex_prefix_and_encode(dst, nds, src, VEX_SIMD_66, vector256, VEX_OPCODE_0F_38);
+  emit_int8(0x04);
+  emit_int8((unsigned char)(0xC0 | encode));
+}
+
+void Assembler::vpmaddwd(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256) {
+  assert(VM_Version::supports_avx() && !vector256 || VM_Version::supports_avx2(), "256 bit integer vectors requires AVX2");
+  emit_vex_arith(0xF5, dst, nds, src, VEX_SIMD_66, vector256);
+}
+
+void Assembler::psadbw(XMMRegister dst, XMMRegister src) {
+  NOT_LP64(assert(VM_Version::supports_sse2(), ""));
+  emit_simd_arith(0xF6, dst, src, VEX_SIMD_66);
+}
+
+void Assembler::vpsadbw(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256) {
+  assert(VM_Version::supports_avx() && !vector256 || VM_Version::supports_avx2(), "256 bit integer vectors requires AVX2");
+  emit_vex_arith(0xF6, dst, nds, src, VEX_SIMD_66, vector256);
+}
+
 void Assembler::vpmullw(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256) {
   assert(VM_Version::supports_avx() && !vector256 || VM_Version::supports_avx2(), "256 bit integer vectors requires AVX2");
   emit_vex_arith(0xD5, dst, nds, src, VEX_SIMD_66, vector256);
@@ -3822,6 +3928,17 @@ void Assembler::vextractf128h(Address dst, XMMRegister src) {
   emit_int8(0x01);
 }
 
+void Assembler::vextractf128h(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_avx(), "");
+  bool vector256 = true;
+  // swap src<->dst for encoding
+  int encode = vex_prefix_and_encode(src, xnoreg, dst, VEX_SIMD_66, vector256, VEX_OPCODE_0F_3A);
+  emit_int8(0x19);
+  emit_int8((unsigned char)(0xC0 | encode));
+  // 0x01 - extract from upper 128 bits
+  emit_int8(0x01);
+}
+
 void Assembler::vinserti128h(XMMRegister dst, XMMRegister nds, XMMRegister src) {
   assert(VM_Version::supports_avx2(), "");
   bool vector256 = true;
@@ -3860,6 +3977,17 @@ void Assembler::vextracti128h(Address dst, XMMRegister src) {
   emit_int8(0x01);
 }
 
+void Assembler::vextracti128h(XMMRegister dst, XMMRegister src) {
+  assert(VM_Version::supports_avx2(), "");
+  bool vector256 = true;
+  // swap src<->dst for encoding
+  int encode = vex_prefix_and_encode(src, xnoreg, dst, VEX_SIMD_66, vector256, VEX_OPCODE_0F_3A);
+  emit_int8(0x39);
+  emit_int8((unsigned char)(0xC0 | encode));
+  // 0x01 - extract from upper 128 bits
+  emit_int8(0x01);
+}
+
 // duplicate 4-bytes integer data from src into 8 locations in dest
 void Assembler::vpbroadcastd(XMMRegister dst, XMMRegister src) {
   assert(VM_Version::supports_avx2(), "");
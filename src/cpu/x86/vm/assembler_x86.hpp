@@ -1022,6 +1022,10 @@ private:
   // Identify processor type and features
   void cpuid();
 
+  // Accumulate CRC32C (Castagnoli polynomial) of a 1, 4 or 8 byte value
+  void crc32(Register crc, Register v, int8_t sizeInBytes);
+  void crc32(Register crc, Address adr, int8_t sizeInBytes);
+
   // Convert Scalar Double-Precision Floating-Point Value to Scalar Single-Precision Floating-Point Value
   void cvtsd2ss(XMMRegister dst, XMMRegister src);
   void cvtsd2ss(XMMRegister dst, Address src);
@@ -1687,6 +1691,8 @@ private:
   void xorl(Register dst, Address src);
   void xorl(Register dst, Register src);
 
+  void xorb(Register dst, Address src);
+
   void xorq(Register dst, Address src);
   void xorq(Register dst, Register src);
 
@@ -1798,6 +1804,21 @@ private:
   void vpmullw(XMMRegister dst, XMMRegister nds, Address src, bool vector256);
   void vpmulld(XMMRegister dst, XMMRegister nds, Address src, bool vector256);
 
+  // Minimum and maximum of packed signed ints
+  void pminsd(XMMRegister dst, XMMRegister src);
+  void pmaxsd(XMMRegister dst, XMMRegister src);
+
+  // Multiply and add packed integers: unsigned by signed bytes into
+  // saturated shorts, and shorts into ints
+  void pmaddubsw(XMMRegister dst, XMMRegister src);
+  void pmaddwd(XMMRegister dst, XMMRegister src);
+  void vpmaddubsw(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256);
+  void vpmaddwd(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256);
+
+  // Sum of absolute differences of packed unsigned bytes
+  void psadbw(XMMRegister dst, XMMRegister src);
+  void vpsadbw(XMMRegister dst, XMMRegister nds, XMMRegister src, bool vector256);
+
   // Shift left packed integers
   void psllw(XMMRegister dst, int shift);
   void pslld(XMMRegister dst, int shift);
@@ -1861,6 +1882,10 @@ private:
   void vextractf128h(Address dst, XMMRegister src);
   void vextracti128h(Address dst, XMMRegister src);
 
+  // Extract high 128bit of YMM registers into the low half of dst.
+  void vextractf128h(XMMRegister dst, XMMRegister src);
+  void vextracti128h(XMMRegister dst, XMMRegister src);
+
   // duplicate 4-bytes integer data from src into 8 locations in dest
   void vpbroadcastd(XMMRegister dst, XMMRegister src);
 
@@ -27,7 +27,15 @@
 
 
 void Bytecodes::pd_initialize() {
-  // No i486 specific initialization
+  //  bytecode               bytecode name           format   wide f.   result tp  stk traps  std code
+  def(_fast_iload_iadd     , "fast_iload_iadd"     , "bi_"  , NULL    , T_INT    ,  0, false, _iload);
+  def(_fast_iload2_iadd    , "fast_iload2_iadd"    , "bi_i_", NULL    , T_INT    ,  1, false, _iload);
+  def(_fast_iinc           , "fast_iinc"           , "bic"  , NULL    , T_VOID   ,  0, false, _iinc );
+  def(_fast_iinc_goto      , "fast_iinc_goto"      , "bic___", NULL   , T_VOID   ,  0, false, _iinc );
+  def(_fast_aload          , "fast_aload"          , "bi"   , NULL    , T_OBJECT ,  1, false, _aload);
+  def(_fast_aload_iaccess  , "fast_aload_iaccess"  , "bi_JJ", NULL    , T_INT    ,  1, true , _aload);
+  def(_fast_aload_aaccess  , "fast_aload_aaccess"  , "bi_JJ", NULL    , T_OBJECT ,  1, true , _aload);
+  def(_fast_aload_faccess  , "fast_aload_faccess"  , "bi_JJ", NULL    , T_FLOAT  ,  1, true , _aload);
 }
 
 
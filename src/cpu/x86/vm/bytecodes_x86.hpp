@@ -25,6 +25,31 @@
 #ifndef CPU_X86_VM_BYTECODES_X86_HPP
 #define CPU_X86_VM_BYTECODES_X86_HPP
 
-// No i486 specific bytecodes
+// Superinstructions for frequent bytecode sequences, formed lazily by the
+// template interpreter when RewriteFrequentPairs is on:
+//
+//   iload, iadd         -> _fast_iload_iadd
+//   iload, iload, iadd  -> _fast_iload2_iadd
+//   iinc, goto          -> _fast_iinc_goto (the usual loop back branch)
+//   aload, getfield     -> _fast_aload_[iaf]access (once getfield is
+//                          quickened to _fast_[iaf]getfield)
+//
+// _fast_iinc and _fast_aload are an iinc and an aload that are not part of
+// a pair, so that the interpreter doesn't check again.  The aload_0 forms
+// of the getfield pairs are shared, see _fast_[iaf]access_0.
+//
+// The top of stack is already cached in rax/xmm0 (st0 on 32 bit) by the
+// template interpreter's tos states.  Caching more than one element would
+// need a tos state, and so a dispatch table, per combination of cached
+// types, and is not done.
+
+    _fast_iload_iadd      ,
+    _fast_iload2_iadd     ,
+    _fast_iinc            ,
+    _fast_iinc_goto       ,
+    _fast_aload           ,
+    _fast_aload_iaccess   ,
+    _fast_aload_aaccess   ,
+    _fast_aload_faccess   ,
 
 #endif // CPU_X86_VM_BYTECODES_X86_HPP
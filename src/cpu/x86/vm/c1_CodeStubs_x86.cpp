@@ -89,6 +89,12 @@ void CounterOverflowStub::emit_code(LIR_Assembler* ce) {
   __ jmp(_continuation);
 }
 
+void ProfileBranchStub::emit_code(LIR_Assembler* ce) {
+  __ bind(_entry);
+  ce->profile_branch_sampled(this);
+  __ jmp(_continuation);
+}
+
 RangeCheckStub::RangeCheckStub(CodeEmitInfo* info, LIR_Opr index,
                                bool throw_index_out_of_bounds_exception)
   : _throw_index_out_of_bounds_exception(throw_index_out_of_bounds_exception)
@@ -1676,6 +1676,13 @@ void LIR_Assembler::emit_alloc_array(LIR_OpAllocArray* op) {
   __ bind(*op->stub()->continuation());
 }
 
+// With sampled profiling (Tier3ProfileUpdateFreqLog > 0) only one in
+// 2^Tier3ProfileUpdateFreqLog profile updates is done on average, so each
+// update is weighted accordingly and the counts keep their usual scale.
+static int profile_counter_increment() {
+  return DataLayout::counter_increment << Tier3ProfileUpdateFreqLog;
+}
+
 void LIR_Assembler::type_profile_helper(Register mdo,
                                         ciMethodData *md, ciProfileData *data,
                                         Register recv, Label* update_done) {
@@ -1685,7 +1692,7 @@ void LIR_Assembler::type_profile_helper(Register mdo,
     __ cmpptr(recv, Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_offset(i))));
     __ jccb(Assembler::notEqual, next_test);
     Address data_addr(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i)));
-    __ addptr(data_addr, DataLayout::counter_increment);
+    __ addptr(data_addr, profile_counter_increment());
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -1697,12 +1704,26 @@ void LIR_Assembler::type_profile_helper(Register mdo,
     __ cmpptr(recv_addr, (intptr_t)NULL_WORD);
     __ jccb(Assembler::notEqual, next_test);
     __ movptr(recv_addr, recv);
-    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), DataLayout::counter_increment);
+    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), profile_counter_increment());
     __ jmp(*update_done);
     __ bind(next_test);
   }
 }
 
+void LIR_Assembler::profile_branch_sampled(ProfileBranchStub* stub) {
+  Register mdo = stub->md_reg()->as_register();
+  Register data_offset = stub->tmp()->as_pointer_register();
+  __ profile_sample_rearm(data_offset);
+  __ mov_metadata(mdo, stub->md()->constant_encoding());
+  comp_op(stub->cond(), stub->left(), stub->right(), NULL);
+  // moves of constants and cmov leave the condition codes alone
+  cmove(stub->cond(),
+        LIR_OprFact::intptrConst(stub->taken_count_offset()),
+        LIR_OprFact::intptrConst(stub->not_taken_count_offset()),
+        stub->tmp(), T_INT);
+  __ addptr(Address(mdo, data_offset, Address::times_1), profile_counter_increment());
+}
+
 void LIR_Assembler::emit_typecheck_helper(LIR_OpTypeCheck *op, Label* success, Label* failure, Label* obj_is_null) {
   // we always need a stub for the failure case.
   CodeStub* stub = op->stub();
@@ -1846,6 +1867,9 @@ void LIR_Assembler::emit_typecheck_helper(LIR_OpTypeCheck *op, Label* success, L
   if (op->should_profile()) {
     Register mdo  = klass_RInfo, recv = k_RInfo;
     __ bind(profile_cast_success);
+    if (Tier3ProfileUpdateFreqLog > 0) {
+      __ profile_sample(mdo, *success);
+    }
     __ mov_metadata(mdo, md->constant_encoding());
     __ load_klass(recv, obj);
     Label update_done;
@@ -1853,9 +1877,12 @@ void LIR_Assembler::emit_typecheck_helper(LIR_OpTypeCheck *op, Label* success, L
     __ jmp(*success);
 
     __ bind(profile_cast_failure);
+    if (Tier3ProfileUpdateFreqLog > 0) {
+      __ profile_sample(mdo, *failure);
+    }
     __ mov_metadata(mdo, md->constant_encoding());
     Address counter_addr(mdo, md->byte_offset_of_slot(data, CounterData::count_offset()));
-    __ subptr(counter_addr, DataLayout::counter_increment);
+    __ subptr(counter_addr, profile_counter_increment());
     __ jmp(*failure);
   }
   __ jmp(*success);
@@ -1929,6 +1956,9 @@ void LIR_Assembler::emit_opTypeCheck(LIR_OpTypeCheck* op) {
     if (op->should_profile()) {
       Register mdo  = klass_RInfo, recv = k_RInfo;
       __ bind(profile_cast_success);
+      if (Tier3ProfileUpdateFreqLog > 0) {
+        __ profile_sample(mdo, done);
+      }
       __ mov_metadata(mdo, md->constant_encoding());
       __ load_klass(recv, value);
       Label update_done;
@@ -1936,9 +1966,12 @@ void LIR_Assembler::emit_opTypeCheck(LIR_OpTypeCheck* op) {
       __ jmpb(done);
 
       __ bind(profile_cast_failure);
+      if (Tier3ProfileUpdateFreqLog > 0) {
+        __ profile_sample(mdo, *stub->entry());
+      }
       __ mov_metadata(mdo, md->constant_encoding());
       Address counter_addr(mdo, md->byte_offset_of_slot(data, CounterData::count_offset()));
-      __ subptr(counter_addr, DataLayout::counter_increment);
+      __ subptr(counter_addr, profile_counter_increment());
       __ jmp(*stub->entry());
     }
 
@@ -3603,6 +3636,10 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
   assert(data->is_CounterData(), "need CounterData for calls");
   assert(op->mdo()->is_single_cpu(),  "mdo must be allocated");
   Register mdo  = op->mdo()->as_register();
+  Label profile_done;
+  if (Tier3ProfileUpdateFreqLog > 0) {
+    __ profile_sample(mdo, profile_done);
+  }
   __ mov_metadata(mdo, md->constant_encoding());
   Address counter_addr(mdo, md->byte_offset_of_slot(data, CounterData::count_offset()));
   Bytecodes::Code bc = method->java_code_at_bci(bci);
@@ -3630,7 +3667,8 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
         ciKlass* receiver = vc_data->receiver(i);
         if (known_klass->equals(receiver)) {
           Address data_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_count_offset(i)));
-          __ addptr(data_addr, DataLayout::counter_increment);
+          __ addptr(data_addr, profile_counter_increment());
+          __ bind(profile_done);
           return;
         }
       }
@@ -3646,7 +3684,8 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
           Address recv_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_offset(i)));
           __ mov_metadata(recv_addr, known_klass->constant_encoding());
           Address data_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_count_offset(i)));
-          __ addptr(data_addr, DataLayout::counter_increment);
+          __ addptr(data_addr, profile_counter_increment());
+          __ bind(profile_done);
           return;
         }
       }
@@ -3656,14 +3695,15 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
       type_profile_helper(mdo, md, data, recv, &update_done);
       // Receiver did not match any saved receiver and there is no empty row for it.
       // Increment total counter to indicate polymorphic case.
-      __ addptr(counter_addr, DataLayout::counter_increment);
+      __ addptr(counter_addr, profile_counter_increment());
 
       __ bind(update_done);
     }
   } else {
     // Static call
-    __ addptr(counter_addr, DataLayout::counter_increment);
+    __ addptr(counter_addr, profile_counter_increment());
   }
+  __ bind(profile_done);
 }
 
 void LIR_Assembler::emit_profile_type(LIR_OpProfileType* op) {
@@ -53,6 +53,9 @@ public:
   void store_parameter(jint c,     int offset_from_esp_in_words);
   void store_parameter(jobject c,  int offset_from_esp_in_words);
 
+  // Out of line branch profile update of ProfileBranchStub
+  void profile_branch_sampled(ProfileBranchStub* stub);
+
   enum { call_stub_size = NOT_LP64(15) LP64_ONLY(28),
          exception_handler_size = DEBUG_ONLY(1*K) NOT_DEBUG(175),
          deopt_handler_size = NOT_LP64(10) LP64_ONLY(17)
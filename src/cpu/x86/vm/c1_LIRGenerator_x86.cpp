@@ -809,6 +809,30 @@ void LIRGenerator::do_CompareAndSwap(Intrinsic* x, ValueType* type) {
 
 void LIRGenerator::do_MathIntrinsic(Intrinsic* x) {
   assert(x->number_of_arguments() == 1 || (x->number_of_arguments() == 2 && x->id() == vmIntrinsics::_dpow), "wrong type");
+
+  address libm_entry = NULL;
+  switch (x->id()) {
+    case vmIntrinsics::_dexp:   libm_entry = StubRoutines::dexp();   break;
+    case vmIntrinsics::_dlog:   libm_entry = StubRoutines::dlog();   break;
+    case vmIntrinsics::_dlog10: libm_entry = StubRoutines::dlog10(); break;
+  }
+  if (libm_entry != NULL) {
+    // Leaf call to the stub the interpreter and C2 use as well.
+    LIRItem value(x->argument_at(0), this);
+    value.set_destroys_register();
+
+    BasicTypeList signature(1);
+    signature.append(T_DOUBLE);
+    CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+    value.load_item_force(cc->at(0));
+
+    LIR_Opr result_reg = result_register_for(x->type());
+    LIR_Opr calc_result = rlock_result(x);
+    __ call_runtime_leaf(libm_entry, getThreadTemp(), result_reg, cc->args());
+    __ move(result_reg, calc_result);
+    return;
+  }
+
   LIRItem value(x->argument_at(0), this);
 
   bool use_fpu = false;
@@ -1318,9 +1342,39 @@ void LIRGenerator::do_If(If* x) {
 
   LIR_Opr left = xin->result();
   LIR_Opr right = yin->result();
-  __ cmp(lir_cond(cond), left, right);
-  // Generate branch profiling. Profiling code doesn't kill flags.
-  profile_branch(x, cond);
+  if (x->should_profile() && Tier3ProfileUpdateFreqLog > 0 && !x->x()->type()->is_float_kind()) {
+    // Sampled branch profiling: count down the thread's sample counter and
+    // only go to the out of line update when it runs out.
+    ciMethodData* md = x->profiled_method()->method_data_or_null();
+    assert(md != NULL, "Sanity");
+    ciProfileData* data = md->bci_to_data(x->profiled_bci());
+    assert(data != NULL && data->is_BranchData(), "need BranchData for two-way branches");
+    int taken_count_offset     = md->byte_offset_of_slot(data, BranchData::taken_offset());
+    int not_taken_count_offset = md->byte_offset_of_slot(data, BranchData::not_taken_offset());
+    if (x->is_swapped()) {
+      int t = taken_count_offset;
+      taken_count_offset = not_taken_count_offset;
+      not_taken_count_offset = t;
+    }
+    LIR_Address* counter_addr = new LIR_Address(getThreadPointer(),
+                                                in_bytes(JavaThread::profile_sample_counter_offset()),
+                                                T_INT);
+    LIR_Opr counter = new_register(T_INT);
+    __ load(counter_addr, counter);
+    __ sub(counter, LIR_OprFact::intConst(1), counter);
+    __ store(counter, counter_addr);
+    __ cmp(lir_cond_equal, counter, LIR_OprFact::intConst(0));
+    CodeStub* stub = new ProfileBranchStub(md, taken_count_offset, not_taken_count_offset,
+                                           lir_cond(cond), left, right,
+                                           new_register(T_METADATA), new_pointer_register());
+    __ branch(lir_cond_equal, T_INT, stub);
+    __ branch_destination(stub->continuation());
+    __ cmp(lir_cond(cond), left, right);
+  } else {
+    __ cmp(lir_cond(cond), left, right);
+    // Generate branch profiling. Profiling code doesn't kill flags.
+    profile_branch(x, cond);
+  }
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), right->type(), x->tsux(), x->usux());
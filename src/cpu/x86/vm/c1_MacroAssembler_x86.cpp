@@ -401,6 +401,38 @@ void C1_MacroAssembler::verified_entry() {
 }
 
 
+void C1_MacroAssembler::profile_sample(Register tmp, Label& skip) {
+  assert(Tier3ProfileUpdateFreqLog > 0, "profile sampling is off");
+#ifdef _LP64
+  decrementl(Address(r15_thread, JavaThread::profile_sample_counter_offset()));
+  jcc(Assembler::notZero, skip);
+  profile_sample_rearm(tmp);
+#else
+  ShouldNotReachHere();
+#endif // _LP64
+}
+
+
+void C1_MacroAssembler::profile_sample_rearm(Register tmp) {
+  assert(Tier3ProfileUpdateFreqLog > 0, "profile sampling is off");
+#ifdef _LP64
+  Address seed(r15_thread, JavaThread::profile_sample_seed_offset());
+  // linear congruential step; its low bits are weak, so use bits 16..30
+  movl(tmp, seed);
+  imull(tmp, tmp, 1103515245);
+  addl(tmp, 12345);
+  movl(seed, tmp);
+  shrl(tmp, 16);
+  // an odd interval in [1, 2^(n+1) - 1], i.e. 2^n on average
+  andl(tmp, (2 << Tier3ProfileUpdateFreqLog) - 2);
+  incrementl(tmp);
+  movl(Address(r15_thread, JavaThread::profile_sample_counter_offset()), tmp);
+#else
+  ShouldNotReachHere();
+#endif // _LP64
+}
+
+
 #ifndef PRODUCT
 
 void C1_MacroAssembler::verify_stack_oop(int stack_offset) {
@@ -91,6 +91,15 @@
   // slow_case  : exit to slow case implementation if fast allocation fails
   void allocate_array(Register obj, Register len, Register t, Register t2, int header_size, Address::ScaleFactor f, Register klass, Label& slow_case);
 
+  // sampled profiling (Tier3ProfileUpdateFreqLog > 0, 64-bit only)
+  // profile_sample      : counts down the thread's sample counter and jumps to skip
+  //                       unless it ran out; then rearms it and falls through
+  // profile_sample_rearm: restarts the counter with a pseudo random interval
+  //                       averaging 2^Tier3ProfileUpdateFreqLog
+  // tmp                 : scratch register - contents destroyed
+  void profile_sample(Register tmp, Label& skip);
+  void profile_sample_rearm(Register tmp);
+
   int  rsp_offset() const { return _rsp_offset; }
   void set_rsp_offset(int n) { _rsp_offset = n; }
 
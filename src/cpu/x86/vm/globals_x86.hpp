@@ -140,6 +140,10 @@ define_pd_global(bool, PreserveFramePointer, false);
   product(bool, UseRTMDeopt, false,                                         \
           "Perform deopt and recompilation based on RTM abort ratio")       \
                                                                             \
+  product(bool, RTMLockingPerCallsite, false,                               \
+          "After deopt for a high RTM abort ratio, keep RTM lock eliding "  \
+          "for the lock sites whose own abort ratio is low")                \
+                                                                            \
   product(uintx, RTMRetryCount, 5,                                          \
           "Number of RTM retries on lock abort or busy")                    \
                                                                             \
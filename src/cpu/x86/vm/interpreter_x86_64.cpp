@@ -249,8 +249,20 @@ address InterpreterGenerator::generate_math_entry(AbstractInterpreter::MethodKin
   //       this entry point for the corresponding methods in JDK 1.3.
   // get argument
 
+  address libm_entry = NULL;
+  switch (kind) {
+    case Interpreter::java_lang_math_exp   : libm_entry = StubRoutines::dexp();   break;
+    case Interpreter::java_lang_math_log   : libm_entry = StubRoutines::dlog();   break;
+    case Interpreter::java_lang_math_log10 : libm_entry = StubRoutines::dlog10(); break;
+    default                                : break;
+  }
+
   if (kind == Interpreter::java_lang_math_sqrt) {
     __ sqrtsd(xmm0, Address(rsp, wordSize));
+  } else if (libm_entry != NULL) {
+    // Same stub as compiled code so that the results agree.
+    __ movdbl(xmm0, Address(rsp, wordSize));
+    __ call(RuntimeAddress(libm_entry));
   } else {
     __ fld_d(Address(rsp, wordSize));
     switch (kind) {
@@ -50,6 +50,16 @@ void RTMLockingCounters::init() {
   }
 }
 
+//------------------------------abort_ratio_too_high-------------------
+bool RTMLockingCounters::abort_ratio_too_high() const {
+  if (_abort_count < (uintx)RTMAbortThreshold) {
+    return false;
+  }
+  //   Aborted transactions = abort_count * 100
+  //   All transactions = total_count * RTMTotalCountIncrRate
+  return _abort_count * 100 >= _total_count * RTMTotalCountIncrRate * RTMAbortRatio;
+}
+
 //------------------------------print_on-------------------------------
 void RTMLockingCounters::print_on(outputStream* st) {
   tty->print_cr("# rtm locks total (estimated): " UINTX_FORMAT, _total_count * RTMTotalCountIncrRate);
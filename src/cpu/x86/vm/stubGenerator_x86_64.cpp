@@ -2902,8 +2902,552 @@ class StubGenerator: public StubCodeGenerator {
     StubRoutines::_arrayof_oop_arraycopy_uninit             = StubRoutines::_oop_arraycopy_uninit;
   }
 
+  // Layout of StubRoutines::x86::_libm_exp_table, in bytes.
+  enum {
+    exp_inv_l      =  0,   // 64/ln2
+    exp_shifter    =  8,   // 1.5*2^52
+    exp_l1         = 16,   // ln2_hi/64
+    exp_l2         = 24,   // ln2_lo/64
+    exp_c5         = 32,   // 1/720, followed by 1/120, 1/24, 1/6, 1/2
+    exp_entries    = 80    // 64 x (hi, lo) of 2^(j/64)
+  };
+
+  // Layout of StubRoutines::x86::_libm_log_table, in bytes.
+  enum {
+    log_ln2_hi     =  0,
+    log_ln2_lo     =  8,
+    log_inv_ln10_hi = 16,
+    log_inv_ln10_lo = 24,
+    log_p6         = 32,   // 1/7, followed by -1/6, 1/5, -1/4, 1/3, -1/2
+    log_one        = 80,   // exponent bits of 1.0
+    log_uh_mask    = 88,
+    log_split_mask = 96,
+    log_entries    = 112   // 129 x (F, 1/F, log(F) hi, log(F) lo)
+  };
+
+  // Tail of the libm stubs for arguments outside the table driven
+  // range: realign the stack and call the fdlibm based runtime routine,
+  // which also leaves its result in xmm0.
+  void libm_slow_path(address runtime_entry) {
+    __ enter();
+    __ andptr(rsp, -16);
+    __ subptr(rsp, frame::arg_reg_save_area_bytes); // windows
+    __ call(RuntimeAddress(runtime_entry));
+    __ leave();
+    __ ret(0);
+  }
+
+  /**
+   *  Math.exp with SSE2 arithmetic.
+   *
+   *  x = n*ln2/64 + r, |r| <= ln2/128, is reduced with a Cody-Waite
+   *  split of ln2/64. exp(r) - 1 is a degree 6 polynomial and
+   *  2^(j/64) comes from a double-double table, so the result is
+   *  within about 0.51 ulp. Arguments with |x| >= 708, infinities and
+   *  NaNs go to SharedRuntime::dexp.
+   *
+   * Input:
+   *   xmm0   - double x
+   *
+   * Output:
+   *   xmm0   - double exp(x)
+   *
+   * Uses rax, rcx, rdx and xmm1-xmm2, all volatile in both x86_64 ABIs.
+   */
+  address generate_libm_exp() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libm_exp");
+
+    address start = __ pc();
+
+    const Register table = rcx;
+    Label L_slow;
+
+    __ movdq(rax, xmm0);
+    __ shrq(rax, 32);
+    __ andl(rax, 0x7fffffff);
+    __ cmpl(rax, 0x40862000);              // |x| >= 708.0, inf or NaN
+    __ jcc(Assembler::aboveEqual, L_slow);
+
+    __ lea(table, ExternalAddress(StubRoutines::x86::libm_exp_table_addr()));
+
+    // n = round(x * 64/ln2), left in the low word of xmm1 by the shifter
+    __ movdbl(xmm1, xmm0);
+    __ mulsd(xmm1, Address(table, exp_inv_l));
+    __ addsd(xmm1, Address(table, exp_shifter));
+    __ movdl(rax, xmm1);
+    __ subsd(xmm1, Address(table, exp_shifter));
+
+    // r = (x - n*L1) - n*L2; n*L1 is exact
+    __ movdbl(xmm2, xmm1);
+    __ mulsd(xmm2, Address(table, exp_l1));
+    __ subsd(xmm0, xmm2);
+    __ mulsd(xmm1, Address(table, exp_l2));
+    __ subsd(xmm0, xmm1);
+
+    // p = r + r^2 * (1/2 + r/6 + r^2/24 + r^3/120 + r^4/720)
+    __ movdbl(xmm1, Address(table, exp_c5));
+    for (int i = 1; i <= 4; i++) {
+      __ mulsd(xmm1, xmm0);
+      __ addsd(xmm1, Address(table, exp_c5 + i * wordSize));
+    }
+    __ movdbl(xmm2, xmm0);
+    __ mulsd(xmm2, xmm0);
+    __ mulsd(xmm1, xmm2);
+    __ addsd(xmm1, xmm0);
+
+    // j = n & 63 selects the table entry, k = n >> 6 the binary exponent
+    __ movl(rdx, rax);
+    __ andl(rdx, 63);
+    __ shll(rdx, 4);
+    __ sarl(rax, 6);
+    __ addl(rax, 1023);
+    __ shlq(rax, 52);
+
+    // 2^k * (T_hi + (T_hi * p + T_lo))
+    __ movdbl(xmm2, Address(table, rdx, Address::times_1, exp_entries));
+    __ mulsd(xmm1, xmm2);
+    __ addsd(xmm1, Address(table, rdx, Address::times_1, exp_entries + wordSize));
+    __ addsd(xmm1, xmm2);
+    __ movdq(xmm0, rax);
+    __ mulsd(xmm0, xmm1);
+    __ ret(0);
+
+    __ bind(L_slow);
+    libm_slow_path(CAST_FROM_FN_PTR(address, SharedRuntime::dexp));
+
+    return start;
+  }
+
+  /**
+   *  Math.log and Math.log10 with SSE2 arithmetic.
+   *
+   *  x = 2^m * f with f in [1, 2) and F = 1 + j/128 the nearest table
+   *  point. u = (f - F)/F is formed as uh + ul with uh*F exact, so
+   *  log(x) = m*ln2 + log(F) + log1p(u) is carried as a double-double
+   *  until the final add and is within about 0.5 ulp. log10 multiplies
+   *  that double-double by a split 1/ln10, which keeps exact powers of
+   *  ten exact. Zero, negative, subnormal and non-finite arguments go to
+   *  SharedRuntime::dlog or dlog10.
+   *
+   * Input:
+   *   xmm0   - double x
+   *
+   * Output:
+   *   xmm0   - double log(x) or log10(x)
+   *
+   * Uses rax, rcx, rdx and xmm1-xmm5, all volatile in both x86_64 ABIs.
+   */
+  address generate_libm_log(bool is_log10) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", is_log10 ? "libm_log10" : "libm_log");
+
+    address start = __ pc();
+
+    const Register table = rcx;
+    const Register entry = rdx;
+    Label L_slow;
+
+    __ movdq(rax, xmm0);
+    __ movq(rdx, rax);
+    __ shrq(rdx, 32);
+    __ subl(rdx, 0x00100000);
+    __ cmpl(rdx, 0x7fe00000);              // x <= 0, subnormal, inf or NaN
+    __ jcc(Assembler::aboveEqual, L_slow);
+
+    __ lea(table, ExternalAddress(StubRoutines::x86::libm_log_table_addr()));
+
+    // m = unbiased exponent, as a double in xmm5
+    __ shrl(rdx, 20);
+    __ subl(rdx, 1022);
+    __ cvtsi2sdl(xmm5, rdx);
+
+    // j = rounded top 8 bits of the mantissa, 0..128
+    __ movq(entry, rax);
+    __ shrq(entry, 44);
+    __ andl(entry, 0xff);
+    __ addl(entry, 1);
+    __ shrl(entry, 1);
+    __ shll(entry, 5);
+
+    // f = mantissa with the exponent of 1.0, g = f - F
+    __ shlq(rax, 12);
+    __ shrq(rax, 12);
+    __ orq(rax, Address(table, log_one));
+    __ movdq(xmm1, rax);
+    __ subsd(xmm1, Address(table, entry, Address::times_1, log_entries));
+
+    // uh = g/F with the low 12 bits cleared, so that uh*F is exact
+    __ movdbl(xmm2, xmm1);
+    __ mulsd(xmm2, Address(table, entry, Address::times_1, log_entries + wordSize));
+    __ movdq(rax, xmm2);
+    __ andq(rax, -4096);
+    __ movdq(xmm2, rax);
+
+    // ul = (g - uh*F)/F
+    __ movdbl(xmm3, xmm2);
+    __ mulsd(xmm3, Address(table, entry, Address::times_1, log_entries));
+    __ subsd(xmm1, xmm3);
+    __ mulsd(xmm1, Address(table, entry, Address::times_1, log_entries + wordSize));
+
+    // q = u^2 * (-1/2 + u/3 - u^2/4 + u^3/5 - u^4/6 + u^5/7), u = uh + ul
+    __ movdbl(xmm3, xmm2);
+    __ addsd(xmm3, xmm1);
+    __ movdbl(xmm4, Address(table, log_p6));
+    for (int i = 1; i <= 5; i++) {
+      __ mulsd(xmm4, xmm3);
+      __ addsd(xmm4, Address(table, log_p6 + i * wordSize));
+    }
+    __ mulsd(xmm3, xmm3);
+    __ mulsd(xmm4, xmm3);
+
+    // lo = ((m*ln2_lo + log(F)_lo) + ul) + q
+    __ movdbl(xmm3, xmm5);
+    __ mulsd(xmm3, Address(table, log_ln2_lo));
+    __ addsd(xmm3, Address(table, entry, Address::times_1, log_entries + 3 * wordSize));
+    __ addsd(xmm3, xmm1);
+    __ addsd(xmm3, xmm4);
+
+    // hi = m*ln2_hi + log(F)_hi, exact
+    __ mulsd(xmm5, Address(table, log_ln2_hi));
+    __ addsd(xmm5, Address(table, entry, Address::times_1, log_entries + 2 * wordSize));
+
+    // t + err = hi + uh exactly (two-sum), then xmm5 = err + lo
+    __ movdbl(xmm0, xmm5);
+    __ addsd(xmm0, xmm2);
+    __ movdbl(xmm1, xmm0);
+    __ subsd(xmm1, xmm5);
+    __ movdbl(xmm4, xmm0);
+    __ subsd(xmm4, xmm1);
+    __ subsd(xmm5, xmm4);
+    __ subsd(xmm2, xmm1);
+    __ addsd(xmm5, xmm2);
+    __ addsd(xmm5, xmm3);
+
+    if (is_log10) {
+      // (th + tl) * (1/ln10_hi + 1/ln10_lo) with th*1/ln10_hi exact
+      __ movdq(rax, xmm0);
+      __ andq(rax, -134217728);            // keep the top 26 bits
+      __ movdq(xmm1, rax);
+      __ movdbl(xmm2, xmm0);
+      __ subsd(xmm2, xmm1);
+      __ addsd(xmm2, xmm5);
+      __ addsd(xmm0, xmm5);
+      __ mulsd(xmm0, Address(table, log_inv_ln10_lo));
+      __ mulsd(xmm2, Address(table, log_inv_ln10_hi));
+      __ addsd(xmm0, xmm2);
+      __ mulsd(xmm1, Address(table, log_inv_ln10_hi));
+      __ addsd(xmm0, xmm1);
+    } else {
+      __ addsd(xmm0, xmm5);
+    }
+    __ ret(0);
+
+    __ bind(L_slow);
+    libm_slow_path(is_log10 ? CAST_FROM_FN_PTR(address, SharedRuntime::dlog10)
+                            : CAST_FROM_FN_PTR(address, SharedRuntime::dlog));
+
+    return start;
+  }
+
+  // Helpers for the two-lane versions of the libm kernels below. The
+  // lane arithmetic is the same sequence of IEEE operations as in the
+  // scalar stubs, so both give bit-identical results.
+
+  // dst = { src, src }
+  void libm_broadcast(XMMRegister dst, Address src) {
+    __ movdbl(dst, src);
+    __ pshufd(dst, dst, 0x44);
+  }
+
+  // dst = { [table + lane0 + disp], [table + lane1 + disp] }
+  void libm_gather(XMMRegister dst, XMMRegister tmp, Register table,
+                   Register lane0, Register lane1, int disp) {
+    __ movdbl(dst, Address(table, lane0, Address::times_1, disp));
+    __ movdbl(tmp, Address(table, lane1, Address::times_1, disp));
+    __ punpcklqdq(dst, tmp);
+  }
+
+  // dst = { lo, hi } from the low quadwords of two registers
+  void libm_pack(XMMRegister dst, Register lo, Register hi, XMMRegister tmp) {
+    __ movdq(dst, lo);
+    __ movdq(tmp, hi);
+    __ punpcklqdq(dst, tmp);
+  }
+
+  // exp of the two doubles at src, both known to be in the table
+  // driven range, into xmm0. Kills rax, rdx, r8, r9, xmm1-xmm5.
+  void libm_exp_pair(Register table, Register src) {
+    __ movdqu(xmm0, Address(src, 0));
+
+    libm_broadcast(xmm1, Address(table, exp_inv_l));
+    __ mulpd(xmm1, xmm0);
+    libm_broadcast(xmm3, Address(table, exp_shifter));
+    __ addpd(xmm1, xmm3);
+    __ movdqu(xmm5, xmm1);                 // n in the low word of each lane
+    __ subpd(xmm1, xmm3);
+
+    libm_broadcast(xmm2, Address(table, exp_l1));
+    __ mulpd(xmm2, xmm1);
+    __ subpd(xmm0, xmm2);
+    libm_broadcast(xmm2, Address(table, exp_l2));
+    __ mulpd(xmm1, xmm2);
+    __ subpd(xmm0, xmm1);                  // r
+
+    libm_broadcast(xmm1, Address(table, exp_c5));
+    for (int i = 1; i <= 4; i++) {
+      __ mulpd(xmm1, xmm0);
+      libm_broadcast(xmm3, Address(table, exp_c5 + i * wordSize));
+      __ addpd(xmm1, xmm3);
+    }
+    __ movdqu(xmm2, xmm0);
+    __ mulpd(xmm2, xmm0);
+    __ mulpd(xmm1, xmm2);
+    __ addpd(xmm1, xmm0);                  // p
+
+    // table offsets in r8/r9, 2^k bits in rax/rdx
+    __ movdl(rax, xmm5);
+    __ pshufd(xmm5, xmm5, 0xE);
+    __ movdl(rdx, xmm5);
+    __ movl(r8, rax);
+    __ andl(r8, 63);
+    __ shll(r8, 4);
+    __ sarl(rax, 6);
+    __ addl(rax, 1023);
+    __ shlq(rax, 52);
+    __ movl(r9, rdx);
+    __ andl(r9, 63);
+    __ shll(r9, 4);
+    __ sarl(rdx, 6);
+    __ addl(rdx, 1023);
+    __ shlq(rdx, 52);
+
+    libm_gather(xmm2, xmm3, table, r8, r9, exp_entries);
+    libm_gather(xmm3, xmm4, table, r8, r9, exp_entries + wordSize);
+    __ mulpd(xmm1, xmm2);
+    __ addpd(xmm1, xmm3);
+    __ addpd(xmm1, xmm2);
+    libm_pack(xmm0, rax, rdx, xmm3);
+    __ mulpd(xmm0, xmm1);
+  }
+
+  // log or log10 of the two doubles whose bits are in rax and r10, both
+  // known to be positive normal numbers, into xmm0. Kills rax, rdx,
+  // r8-r11, xmm1-xmm5.
+  void libm_log_pair(Register table, bool is_log10) {
+    // m for both lanes into xmm5
+    __ movq(rdx, rax);
+    __ shrq(rdx, 52);
+    __ subl(rdx, 1023);
+    __ cvtsi2sdl(xmm5, rdx);
+    __ movq(rdx, r10);
+    __ shrq(rdx, 52);
+    __ subl(rdx, 1023);
+    __ cvtsi2sdl(xmm0, rdx);
+    __ punpcklqdq(xmm5, xmm0);
+
+    // table offsets in r8/r9
+    __ movq(r8, rax);
+    __ shrq(r8, 44);
+    __ andl(r8, 0xff);
+    __ addl(r8, 1);
+    __ shrl(r8, 1);
+    __ shll(r8, 5);
+    __ movq(r9, r10);
+    __ shrq(r9, 44);
+    __ andl(r9, 0xff);
+    __ addl(r9, 1);
+    __ shrl(r9, 1);
+    __ shll(r9, 5);
+
+    // f for both lanes into xmm1, g = f - F
+    __ movq(r11, Address(table, log_one));
+    __ shlq(rax, 12);
+    __ shrq(rax, 12);
+    __ orq(rax, r11);
+    __ shlq(r10, 12);
+    __ shrq(r10, 12);
+    __ orq(r10, r11);
+    libm_pack(xmm1, rax, r10, xmm0);
+    libm_gather(xmm2, xmm0, table, r8, r9, log_entries);
+    __ subpd(xmm1, xmm2);
+
+    // uh in xmm3, ul in xmm1
+    libm_gather(xmm0, xmm3, table, r8, r9, log_entries + wordSize);
+    __ movdqu(xmm3, xmm1);
+    __ mulpd(xmm3, xmm0);
+    libm_broadcast(xmm4, Address(table, log_uh_mask));
+    __ pand(xmm3, xmm4);
+    __ movdqu(xmm4, xmm3);
+    __ mulpd(xmm4, xmm2);
+    __ subpd(xmm1, xmm4);
+    __ mulpd(xmm1, xmm0);
+
+    // (m*ln2_lo + log(F)_lo) + ul in xmm2, hi in xmm5
+    __ movdqu(xmm2, xmm5);
+    libm_broadcast(xmm0, Address(table, log_ln2_lo));
+    __ mulpd(xmm2, xmm0);
+    libm_gather(xmm0, xmm4, table, r8, r9, log_entries + 3 * wordSize);
+    __ addpd(xmm2, xmm0);
+    __ addpd(xmm2, xmm1);
+    libm_broadcast(xmm0, Address(table, log_ln2_hi));
+    __ mulpd(xmm5, xmm0);
+    libm_gather(xmm0, xmm4, table, r8, r9, log_entries + 2 * wordSize);
+    __ addpd(xmm5, xmm0);
+
+    // lo = ... + q in xmm2
+    __ movdqu(xmm0, xmm3);
+    __ addpd(xmm0, xmm1);
+    libm_broadcast(xmm4, Address(table, log_p6));
+    for (int i = 1; i <= 5; i++) {
+      __ mulpd(xmm4, xmm0);
+      libm_broadcast(xmm1, Address(table, log_p6 + i * wordSize));
+      __ addpd(xmm4, xmm1);
+    }
+    __ mulpd(xmm0, xmm0);
+    __ mulpd(xmm4, xmm0);
+    __ addpd(xmm2, xmm4);
+
+    // two-sum of hi and uh
+    __ movdqu(xmm0, xmm5);
+    __ addpd(xmm0, xmm3);
+    __ movdqu(xmm1, xmm0);
+    __ subpd(xmm1, xmm5);
+    __ movdqu(xmm4, xmm0);
+    __ subpd(xmm4, xmm1);
+    __ subpd(xmm5, xmm4);
+    __ subpd(xmm3, xmm1);
+    __ addpd(xmm5, xmm3);
+    __ addpd(xmm5, xmm2);
+
+    if (is_log10) {
+      libm_broadcast(xmm1, Address(table, log_split_mask));
+      __ pand(xmm1, xmm0);
+      __ movdqu(xmm2, xmm0);
+      __ subpd(xmm2, xmm1);
+      __ addpd(xmm2, xmm5);
+      __ addpd(xmm0, xmm5);
+      libm_broadcast(xmm3, Address(table, log_inv_ln10_lo));
+      __ mulpd(xmm0, xmm3);
+      libm_broadcast(xmm3, Address(table, log_inv_ln10_hi));
+      __ mulpd(xmm2, xmm3);
+      __ addpd(xmm0, xmm2);
+      __ mulpd(xmm1, xmm3);
+      __ addpd(xmm0, xmm1);
+    } else {
+      __ addpd(xmm0, xmm5);
+    }
+  }
+
+  /**
+   *  dst[i] = exp(src[i]), log(src[i]) or log10(src[i]) for 0 <= i < len.
+   *  Used by C2 in place of counted loops that apply the scalar stub to
+   *  each element. Pairs of elements in the table driven range are done
+   *  with packed SSE2 arithmetic; other pairs and an odd last element
+   *  call the scalar stub. src and dst are either disjoint or equal.
+   *
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - double* src
+   *   c_rarg1   - double* dst
+   *   c_rarg2   - long    len
+   */
+  address generate_libm_array(const char* name, address scalar_entry, bool is_exp, bool is_log10) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+
+    address start = __ pc();
+
+    const Register src   = r12;
+    const Register dst   = r13;
+    const Register len   = r14;
+    const Register table = rcx;
+    Label L_pair_loop, L_next_pair, L_scalar_pair, L_tail, L_done;
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+    __ push(r12);
+    __ push(r13);
+    __ push(r14);
+    __ movq(src, c_rarg0);
+    __ movq(dst, c_rarg1);
+    __ movq(len, c_rarg2);
+
+    __ BIND(L_pair_loop);
+    __ cmpq(len, 2);
+    __ jcc(Assembler::less, L_tail);
+
+    // Both lanes must take the fast path of the scalar stub.
+    __ movq(rax, Address(src, 0));
+    __ movq(r10, Address(src, wordSize));
+    if (is_exp) {
+      __ movq(rdx, rax);
+      __ shrq(rdx, 32);
+      __ andl(rdx, 0x7fffffff);
+      __ cmpl(rdx, 0x40862000);
+      __ jcc(Assembler::aboveEqual, L_scalar_pair);
+      __ movq(rdx, r10);
+      __ shrq(rdx, 32);
+      __ andl(rdx, 0x7fffffff);
+      __ cmpl(rdx, 0x40862000);
+      __ jcc(Assembler::aboveEqual, L_scalar_pair);
+      __ lea(table, ExternalAddress(StubRoutines::x86::libm_exp_table_addr()));
+      libm_exp_pair(table, src);
+    } else {
+      __ movq(rdx, rax);
+      __ shrq(rdx, 32);
+      __ subl(rdx, 0x00100000);
+      __ cmpl(rdx, 0x7fe00000);
+      __ jcc(Assembler::aboveEqual, L_scalar_pair);
+      __ movq(rdx, r10);
+      __ shrq(rdx, 32);
+      __ subl(rdx, 0x00100000);
+      __ cmpl(rdx, 0x7fe00000);
+      __ jcc(Assembler::aboveEqual, L_scalar_pair);
+      __ lea(table, ExternalAddress(StubRoutines::x86::libm_log_table_addr()));
+      libm_log_pair(table, is_log10);
+    }
+    __ movdqu(Address(dst, 0), xmm0);
+
+    __ BIND(L_next_pair);
+    __ addptr(src, 2 * wordSize);
+    __ addptr(dst, 2 * wordSize);
+    __ subq(len, 2);
+    __ jmp(L_pair_loop);
+
+    // Read each element before its result is stored, for src == dst.
+    __ BIND(L_scalar_pair);
+    __ movdbl(xmm0, Address(src, 0));
+    __ call(RuntimeAddress(scalar_entry));
+    __ movdbl(Address(dst, 0), xmm0);
+    __ movdbl(xmm0, Address(src, wordSize));
+    __ call(RuntimeAddress(scalar_entry));
+    __ movdbl(Address(dst, wordSize), xmm0);
+    __ jmp(L_next_pair);
+
+    __ BIND(L_tail);
+    __ cmpq(len, 1);
+    __ jcc(Assembler::less, L_done);
+    __ movdbl(xmm0, Address(src, 0));
+    __ call(RuntimeAddress(scalar_entry));
+    __ movdbl(Address(dst, 0), xmm0);
+
+    __ BIND(L_done);
+    __ pop(r14);
+    __ pop(r13);
+    __ pop(r12);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   void generate_math_stubs() {
-    {
+    // The constant folding versions must agree with the compiled code, so
+    // they reuse the libm stubs when those were generated.
+    if (StubRoutines::dlog() != NULL) {
+      StubRoutines::_intrinsic_log = (double (*)(double)) StubRoutines::dlog();
+    } else {
       StubCodeMark mark(this, "StubRoutines", "log");
       StubRoutines::_intrinsic_log = (double (*)(double)) __ pc();
 
@@ -2916,7 +3460,9 @@ class StubGenerator: public StubCodeGenerator {
       __ addq(rsp, 8);
       __ ret(0);
     }
-    {
+    if (StubRoutines::dlog10() != NULL) {
+      StubRoutines::_intrinsic_log10 = (double (*)(double)) StubRoutines::dlog10();
+    } else {
       StubCodeMark mark(this, "StubRoutines", "log10");
       StubRoutines::_intrinsic_log10 = (double (*)(double)) __ pc();
 
@@ -2968,7 +3514,9 @@ class StubGenerator: public StubCodeGenerator {
       __ addq(rsp, 8);
       __ ret(0);
     }
-    {
+    if (StubRoutines::dexp() != NULL) {
+      StubRoutines::_intrinsic_exp = (double (*)(double)) StubRoutines::dexp();
+    } else {
       StubCodeMark mark(this, "StubRoutines", "exp");
       StubRoutines::_intrinsic_exp = (double (*)(double)) __ pc();
 
@@ -3640,6 +4188,240 @@ class StubGenerator: public StubCodeGenerator {
   }
 
 
+  // Encrypts the blocks held in xmm registers first .. first + count - 1 in
+  // place.  The number of rounds follows from the length of the expanded
+  // key K, which is 44, 52 or 60 ints.
+  void aes_encrypt_blocks(int first, int count, Register key,
+                          XMMRegister xmm_key, XMMRegister xmm_key_shuf_mask) {
+    const Address keylen(key, arrayOopDesc::length_offset_in_bytes() - arrayOopDesc::base_offset_in_bytes(T_INT));
+    Label L_last_round;
+
+    load_key(xmm_key, key, 0x00, xmm_key_shuf_mask);
+    for (int i = first; i < first + count; i++) {
+      __ pxor(as_XMMRegister(i), xmm_key);
+    }
+    for (int offset = 0x10; offset < 0xe0; offset += 0x10) {
+      load_key(xmm_key, key, offset, xmm_key_shuf_mask);
+      if (offset == 0xa0 || offset == 0xc0) {
+        // last round key of a 128-bit or 192-bit key
+        __ cmpl(keylen, offset == 0xa0 ? 44 : 52);
+        __ jcc(Assembler::equal, L_last_round);
+      }
+      for (int i = first; i < first + count; i++) {
+        __ aesenc(as_XMMRegister(i), xmm_key);
+      }
+    }
+    load_key(xmm_key, key, 0xe0, xmm_key_shuf_mask);
+
+    __ BIND(L_last_round);
+    for (int i = first; i < first + count; i++) {
+      __ aesenclast(as_XMMRegister(i), xmm_key);
+    }
+  }
+
+  // Increments the 128-bit little endian counter in xmm_counter.
+  void inc_counter(Register tmp, XMMRegister xmm_counter) {
+    Label L_no_carry;
+    __ pextrq(tmp, xmm_counter, 0);
+    __ addq(tmp, 1);
+    __ pinsrq(xmm_counter, tmp, 0);
+    __ jccb(Assembler::carryClear, L_no_carry);
+    __ pextrq(tmp, xmm_counter, 1);
+    __ addq(tmp, 1);
+    __ pinsrq(xmm_counter, tmp, 1);
+    __ BIND(L_no_carry);
+  }
+
+  address generate_counter_shuffle_mask() {
+    __ align(16);
+    StubCodeMark mark(this, "StubRoutines", "counter_shuffle_mask");
+    address start = __ pc();
+    __ emit_data64( 0x08090a0b0c0d0e0f, relocInfo::none );
+    __ emit_data64( 0x0001020304050607, relocInfo::none );
+    return start;
+  }
+
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - source byte array address
+  //   c_rarg1   - destination byte array address
+  //   c_rarg2   - K (key) in little endian int array
+  //   c_rarg3   - counter vector byte array address
+  //   c_rarg4   - input length
+  //   c_rarg5   - saved encryptedCounter start
+  //   rbp + 2 * wordSize - address of the used field of the CounterMode object
+  //
+  // On Win64 the last three arguments are on the stack.
+  //
+  // Output:
+  //   rax       - input length
+  //
+  address generate_counterMode_AESCrypt_Parallel() {
+    assert(UseAESCTRIntrinsics, "need AES instructions and SSE4.1 support");
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "counterMode_AESCrypt");
+    address start = __ pc();
+
+    const Register from    = c_rarg0;  // source array address
+    const Register to      = c_rarg1;  // destination array address
+    const Register key     = c_rarg2;  // key array address
+    const Register counter = c_rarg3;  // counter byte array initialized from counter array address
+                                       // and updated with the incremented counter at the end
+#ifndef _WIN64
+    const Register len_reg = c_rarg4;
+    const Register saved_encCounter_start = c_rarg5;
+    const Address  used_addr_mem(rbp, 2 * wordSize);
+    const Register used    = r10;
+    const Register tmp     = r11;
+#else
+    const Address  len_mem(rbp, 6 * wordSize);
+    const Address  saved_encCounter_mem(rbp, 7 * wordSize);
+    const Address  used_addr_mem(rbp, 8 * wordSize);
+    const Register len_reg = r10;
+    const Register saved_encCounter_start = r11;
+    const Register used    = rdi;      // callee saved on Win64
+    const Register tmp     = rsi;      // callee saved on Win64
+#endif
+    const Register pos     = rax;      // bytes done, which is the input length at the end
+
+    // the eight results of the parallelized loop are in xmm0-xmm7
+    const int XMM_REG_NUM_RESULT_LAST = 7;
+    const XMMRegister xmm_counter       = xmm8;   // counter as a little endian 128-bit integer
+    const XMMRegister xmm_key_shuf_mask = xmm9;
+    const XMMRegister xmm_ctr_shuf_mask = xmm10;
+    const XMMRegister xmm_key           = xmm11;
+    const XMMRegister xmm_one           = xmm12;
+    const XMMRegister xmm_from          = xmm13;
+#ifdef _WIN64
+    const int XMM_REG_LAST = 13;
+#endif
+
+    Label L_preLoop, L_multiBlock_loopTop, L_singleBlock, L_processTail, L_tail_loop, L_exit;
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+#ifdef _WIN64
+    // save the xmm registers which must be preserved 6-13
+    __ subptr(rsp, -rsp_after_call_off * wordSize);
+    for (int i = 6; i <= XMM_REG_LAST; i++) {
+      __ movdqu(xmm_save(i), as_XMMRegister(i));
+    }
+    __ push(rdi);
+    __ push(rsi);
+    __ movl(len_reg, len_mem);
+    __ movptr(saved_encCounter_start, saved_encCounter_mem);
+#endif
+    __ movptr(tmp, used_addr_mem);
+    __ movl(used, Address(tmp, 0));
+
+    __ movdqu(xmm_key_shuf_mask, ExternalAddress(StubRoutines::x86::key_shuffle_mask_addr()));
+    __ movdqu(xmm_ctr_shuf_mask, ExternalAddress(StubRoutines::x86::counter_shuffle_mask_addr()));
+    __ movdqu(xmm_counter, Address(counter, 0));
+    __ pshufb(xmm_counter, xmm_ctr_shuf_mask);
+    __ movl(tmp, 1);
+    __ movdl(xmm_one, tmp);
+    __ xorptr(pos, pos);
+
+    // Use up the key stream left over in encryptedCounter by the last call.
+    __ BIND(L_preLoop);
+    __ cmpl(used, AESBlockSize);
+    __ jccb(Assembler::aboveEqual, L_multiBlock_loopTop);
+    __ testl(len_reg, len_reg);
+    __ jcc(Assembler::zero, L_exit);
+    __ movb(tmp, Address(saved_encCounter_start, used, Address::times_1));
+    __ xorb(tmp, Address(from, pos, Address::times_1));
+    __ movb(Address(to, pos, Address::times_1), tmp);
+    __ addptr(pos, 1);
+    __ addl(used, 1);
+    __ subl(len_reg, 1);
+    __ jmpb(L_preLoop);
+
+    // Eight blocks at a time.  If the low half of the counter would wrap
+    // within them, the next block goes through the single block code.
+    __ align(OptoLoopAlignment);
+    __ BIND(L_multiBlock_loopTop);
+    __ cmpl(len_reg, 8 * AESBlockSize);
+    __ jcc(Assembler::less, L_singleBlock);
+    __ pextrq(tmp, xmm_counter, 0);
+    __ addq(tmp, 8);
+    __ jcc(Assembler::carrySet, L_singleBlock);
+
+    __ movdqa(xmm0, xmm_counter);
+    for (int i = 1; i <= XMM_REG_NUM_RESULT_LAST; i++) {
+      __ movdqa(as_XMMRegister(i), as_XMMRegister(i - 1));
+      __ paddq(as_XMMRegister(i), xmm_one);
+    }
+    __ movdqa(xmm_counter, as_XMMRegister(XMM_REG_NUM_RESULT_LAST));
+    __ paddq(xmm_counter, xmm_one);
+    for (int i = 0; i <= XMM_REG_NUM_RESULT_LAST; i++) {
+      __ pshufb(as_XMMRegister(i), xmm_ctr_shuf_mask);
+    }
+
+    aes_encrypt_blocks(0, XMM_REG_NUM_RESULT_LAST + 1, key, xmm_key, xmm_key_shuf_mask);
+
+    for (int i = 0; i <= XMM_REG_NUM_RESULT_LAST; i++) {
+      __ movdqu(xmm_from, Address(from, pos, Address::times_1, i * AESBlockSize));
+      __ pxor(as_XMMRegister(i), xmm_from);
+      __ movdqu(Address(to, pos, Address::times_1, i * AESBlockSize), as_XMMRegister(i));
+    }
+    __ addptr(pos, 8 * AESBlockSize);
+    __ subl(len_reg, 8 * AESBlockSize);
+    __ jmp(L_multiBlock_loopTop);
+
+    __ BIND(L_singleBlock);
+    __ cmpl(len_reg, AESBlockSize);
+    __ jcc(Assembler::less, L_processTail);
+    __ movdqa(xmm0, xmm_counter);
+    __ pshufb(xmm0, xmm_ctr_shuf_mask);
+    inc_counter(tmp, xmm_counter);
+    aes_encrypt_blocks(0, 1, key, xmm_key, xmm_key_shuf_mask);
+    __ movdqu(xmm_from, Address(from, pos, Address::times_1, 0));
+    __ pxor(xmm0, xmm_from);
+    __ movdqu(Address(to, pos, Address::times_1, 0), xmm0);
+    __ addptr(pos, AESBlockSize);
+    __ subl(len_reg, AESBlockSize);
+    __ jmp(L_multiBlock_loopTop);
+
+    // Encrypt the counter for the last partial block and save the key
+    // stream in encryptedCounter, where the next call picks it up.
+    __ BIND(L_processTail);
+    __ testl(len_reg, len_reg);
+    __ jcc(Assembler::zero, L_exit);
+    __ movdqa(xmm0, xmm_counter);
+    __ pshufb(xmm0, xmm_ctr_shuf_mask);
+    inc_counter(tmp, xmm_counter);
+    aes_encrypt_blocks(0, 1, key, xmm_key, xmm_key_shuf_mask);
+    __ movdqu(Address(saved_encCounter_start, 0), xmm0);
+    __ xorl(used, used);
+    __ BIND(L_tail_loop);
+    __ movb(tmp, Address(saved_encCounter_start, used, Address::times_1));
+    __ xorb(tmp, Address(from, pos, Address::times_1));
+    __ movb(Address(to, pos, Address::times_1), tmp);
+    __ addptr(pos, 1);
+    __ addl(used, 1);
+    __ subl(len_reg, 1);
+    __ jccb(Assembler::notZero, L_tail_loop);
+
+    __ BIND(L_exit);
+    __ pshufb(xmm_counter, xmm_ctr_shuf_mask);
+    __ movdqu(Address(counter, 0), xmm_counter);   // next counter stored in the CounterMode object
+    __ movptr(tmp, used_addr_mem);
+    __ movl(Address(tmp, 0), used);
+#ifdef _WIN64
+    __ pop(rsi);
+    __ pop(rdi);
+    // restore regs belonging to calling function
+    for (int i = 6; i <= XMM_REG_LAST; i++) {
+      __ movdqu(as_XMMRegister(i), xmm_save(i));
+    }
+#endif
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   // byte swap x86 long
   address generate_ghash_long_swap_mask() {
     __ align(CodeEntryAlignment);
@@ -3660,10 +4442,87 @@ class StubGenerator: public StubCodeGenerator {
   return start;
   }
 
+  // Carry-less multiplication of a by b into the 256-bit <hi:lo>.
+  void ghash_multiply(XMMRegister a, XMMRegister b, XMMRegister lo, XMMRegister hi,
+                      XMMRegister tmp1, XMMRegister tmp2) {
+    __ movdqu(lo, a);
+    __ pclmulqdq(lo, b, 0);         // lo holds a0*b0
+    __ movdqu(hi, a);
+    __ pclmulqdq(hi, b, 17);        // hi holds a1*b1
+    __ movdqu(tmp1, a);
+    __ pclmulqdq(tmp1, b, 16);      // tmp1 holds a0*b1
+    __ movdqu(tmp2, a);
+    __ pclmulqdq(tmp2, b, 1);       // tmp2 holds a1*b0
+
+    __ pxor(tmp1, tmp2);            // tmp1 holds a0*b1 + a1*b0
+    __ movdqu(tmp2, tmp1);
+    __ psrldq(tmp1, 8);             // shift by tmp1 64 bits to the right
+    __ pslldq(tmp2, 8);             // shift by tmp2 64 bits to the left
+    __ pxor(lo, tmp2);
+    __ pxor(hi, tmp1);              // Register pair <hi:lo> holds the result
+  }
+
+  // Reduces the 256-bit product <hi:lo> modulo the GHASH polynomial,
+  // leaving the result in hi.  Products may be xor-ed together before
+  // a single reduction, since both steps are linear.
+  void ghash_reduce(XMMRegister lo, XMMRegister hi, XMMRegister tmp1,
+                    XMMRegister tmp2, XMMRegister tmp3, XMMRegister tmp4) {
+    // We shift the result of the multiplication by one bit position
+    // to the left to cope for the fact that the bits are reversed.
+    __ movdqu(tmp1, lo);
+    __ movdqu(tmp2, hi);
+    __ pslld(lo, 1);
+    __ pslld(hi, 1);
+    __ psrld(tmp1, 31);
+    __ psrld(tmp2, 31);
+    __ movdqu(tmp3, tmp1);
+    __ pslldq(tmp2, 4);
+    __ pslldq(tmp1, 4);
+    __ psrldq(tmp3, 12);
+    __ por(lo, tmp1);
+    __ por(hi, tmp2);
+    __ por(hi, tmp3);
+
+    //
+    // First phase of the reduction
+    //
+    // Move lo into tmp1, tmp2, tmp3 in order to perform the shifts
+    // independently.
+    __ movdqu(tmp1, lo);
+    __ movdqu(tmp2, lo);
+    __ movdqu(tmp3, lo);
+    __ pslld(tmp1, 31);             // packed right shift shifting << 31
+    __ pslld(tmp2, 30);             // packed right shift shifting << 30
+    __ pslld(tmp3, 25);             // packed right shift shifting << 25
+    __ pxor(tmp1, tmp2);            // xor the shifted versions
+    __ pxor(tmp1, tmp3);
+    __ movdqu(tmp2, tmp1);
+    __ pslldq(tmp1, 12);
+    __ psrldq(tmp2, 4);
+    __ pxor(lo, tmp1);              // first phase of the reduction complete
+
+    //
+    // Second phase of the reduction
+    //
+    // Make 3 copies of lo in tmp1, tmp3, tmp4 for doing these
+    // shift operations.
+    __ movdqu(tmp1, lo);
+    __ movdqu(tmp3, lo);
+    __ movdqu(tmp4, lo);
+    __ psrld(tmp1, 1);              // packed left shifting >> 1
+    __ psrld(tmp3, 2);              // packed left shifting >> 2
+    __ psrld(tmp4, 7);              // packed left shifting >> 7
+    __ pxor(tmp1, tmp3);            // xor the shifted versions
+    __ pxor(tmp1, tmp4);
+    __ pxor(tmp1, tmp2);
+    __ pxor(lo, tmp1);
+    __ pxor(hi, lo);                // the result is in hi
+  }
+
   /* Single and multi-block ghash operations */
   address generate_ghash_processBlocks() {
     __ align(CodeEntryAlignment);
-    Label L_ghash_loop, L_exit;
+    Label L_ghash_loop, L_four_blocks_loop, L_single_blocks, L_exit;
     StubCodeMark mark(this, "StubRoutines", "ghash_processBlocks");
     address start = __ pc();
 
@@ -3673,129 +4532,115 @@ class StubGenerator: public StubCodeGenerator {
     const Register blocks       = c_rarg3;
 
 #ifdef _WIN64
-    const int XMM_REG_LAST  = 10;
+    const int XMM_REG_LAST  = 15;
 #endif
 
-    const XMMRegister xmm_temp0 = xmm0;
-    const XMMRegister xmm_temp1 = xmm1;
-    const XMMRegister xmm_temp2 = xmm2;
-    const XMMRegister xmm_temp3 = xmm3;
-    const XMMRegister xmm_temp4 = xmm4;
-    const XMMRegister xmm_temp5 = xmm5;
-    const XMMRegister xmm_temp6 = xmm6;
-    const XMMRegister xmm_temp7 = xmm7;
-    const XMMRegister xmm_temp8 = xmm8;
-    const XMMRegister xmm_temp9 = xmm9;
-    const XMMRegister xmm_temp10 = xmm10;
+    const XMMRegister xmm_state     = xmm0;
+    const XMMRegister xmm_H         = xmm1;
+    const XMMRegister xmm_data      = xmm2;
+    const XMMRegister xmm_lo        = xmm3;
+    const XMMRegister xmm_hi        = xmm4;
+    const XMMRegister xmm_temp1     = xmm5;
+    const XMMRegister xmm_temp2     = xmm6;
+    const XMMRegister xmm_temp3     = xmm7;
+    const XMMRegister xmm_temp4     = xmm8;
+    const XMMRegister xmm_byte_swap = xmm9;
+    const XMMRegister xmm_long_swap = xmm10;
+    const XMMRegister xmm_H2        = xmm11;
+    const XMMRegister xmm_H3        = xmm12;
+    const XMMRegister xmm_H4        = xmm13;
+    const XMMRegister xmm_lo2       = xmm14;
+    const XMMRegister xmm_hi2       = xmm15;
 
     __ enter();
 
 #ifdef _WIN64
-    // save the xmm registers which must be preserved 6-10
+    // save the xmm registers which must be preserved 6-15
     __ subptr(rsp, -rsp_after_call_off * wordSize);
     for (int i = 6; i <= XMM_REG_LAST; i++) {
       __ movdqu(xmm_save(i), as_XMMRegister(i));
     }
 #endif
 
-    __ movdqu(xmm_temp10, ExternalAddress(StubRoutines::x86::ghash_long_swap_mask_addr()));
-
-    __ movdqu(xmm_temp0, Address(state, 0));
-    __ pshufb(xmm_temp0, xmm_temp10);
-
+    __ movdqu(xmm_long_swap, ExternalAddress(StubRoutines::x86::ghash_long_swap_mask_addr()));
+    __ movdqu(xmm_byte_swap, ExternalAddress(StubRoutines::x86::ghash_byte_swap_mask_addr()));
+
+    __ movdqu(xmm_state, Address(state, 0));
+    __ pshufb(xmm_state, xmm_long_swap);
+    __ movdqu(xmm_H, Address(subkeyH, 0));
+    __ pshufb(xmm_H, xmm_long_swap);
+
+    // Four blocks per reduction once there are enough blocks to pay for
+    // computing H^2, H^3 and H^4:
+    //   X' = (X + D0)*H^4 + D1*H^3 + D2*H^2 + D3*H
+    __ cmpl(blocks, 8);
+    __ jcc(Assembler::less, L_single_blocks);
+
+    ghash_multiply(xmm_H, xmm_H, xmm_lo, xmm_hi, xmm_temp1, xmm_temp2);
+    ghash_reduce(xmm_lo, xmm_hi, xmm_temp1, xmm_temp2, xmm_temp3, xmm_temp4);
+    __ movdqu(xmm_H2, xmm_hi);
+    ghash_multiply(xmm_H2, xmm_H, xmm_lo, xmm_hi, xmm_temp1, xmm_temp2);
+    ghash_reduce(xmm_lo, xmm_hi, xmm_temp1, xmm_temp2, xmm_temp3, xmm_temp4);
+    __ movdqu(xmm_H3, xmm_hi);
+    ghash_multiply(xmm_H3, xmm_H, xmm_lo, xmm_hi, xmm_temp1, xmm_temp2);
+    ghash_reduce(xmm_lo, xmm_hi, xmm_temp1, xmm_temp2, xmm_temp3, xmm_temp4);
+    __ movdqu(xmm_H4, xmm_hi);
+
+    __ BIND(L_four_blocks_loop);
+    __ movdqu(xmm_data, Address(data, 0));
+    __ pshufb(xmm_data, xmm_byte_swap);
+    __ pxor(xmm_state, xmm_data);
+    ghash_multiply(xmm_state, xmm_H4, xmm_lo, xmm_hi, xmm_temp1, xmm_temp2);
+
+    __ movdqu(xmm_data, Address(data, 16));
+    __ pshufb(xmm_data, xmm_byte_swap);
+    ghash_multiply(xmm_data, xmm_H3, xmm_lo2, xmm_hi2, xmm_temp1, xmm_temp2);
+    __ pxor(xmm_lo, xmm_lo2);
+    __ pxor(xmm_hi, xmm_hi2);
+
+    __ movdqu(xmm_data, Address(data, 32));
+    __ pshufb(xmm_data, xmm_byte_swap);
+    ghash_multiply(xmm_data, xmm_H2, xmm_lo2, xmm_hi2, xmm_temp1, xmm_temp2);
+    __ pxor(xmm_lo, xmm_lo2);
+    __ pxor(xmm_hi, xmm_hi2);
+
+    __ movdqu(xmm_data, Address(data, 48));
+    __ pshufb(xmm_data, xmm_byte_swap);
+    ghash_multiply(xmm_data, xmm_H, xmm_lo2, xmm_hi2, xmm_temp1, xmm_temp2);
+    __ pxor(xmm_lo, xmm_lo2);
+    __ pxor(xmm_hi, xmm_hi2);
+
+    ghash_reduce(xmm_lo, xmm_hi, xmm_temp1, xmm_temp2, xmm_temp3, xmm_temp4);
+    __ movdqu(xmm_state, xmm_hi);
+
+    __ addptr(data, 64);
+    __ subl(blocks, 4);
+    __ cmpl(blocks, 4);
+    __ jcc(Assembler::greaterEqual, L_four_blocks_loop);
+
+    __ BIND(L_single_blocks);
+    __ testl(blocks, blocks);
+    __ jcc(Assembler::zero, L_exit);
 
     __ BIND(L_ghash_loop);
-    __ movdqu(xmm_temp2, Address(data, 0));
-    __ pshufb(xmm_temp2, ExternalAddress(StubRoutines::x86::ghash_byte_swap_mask_addr()));
-
-    __ movdqu(xmm_temp1, Address(subkeyH, 0));
-    __ pshufb(xmm_temp1, xmm_temp10);
-
-    __ pxor(xmm_temp0, xmm_temp2);
+    __ movdqu(xmm_data, Address(data, 0));
+    __ pshufb(xmm_data, xmm_byte_swap);
+    __ pxor(xmm_state, xmm_data);
 
     //
     // Multiply with the hash key
     //
-    __ movdqu(xmm_temp3, xmm_temp0);
-    __ pclmulqdq(xmm_temp3, xmm_temp1, 0);      // xmm3 holds a0*b0
-    __ movdqu(xmm_temp4, xmm_temp0);
-    __ pclmulqdq(xmm_temp4, xmm_temp1, 16);     // xmm4 holds a0*b1
-
-    __ movdqu(xmm_temp5, xmm_temp0);
-    __ pclmulqdq(xmm_temp5, xmm_temp1, 1);      // xmm5 holds a1*b0
-    __ movdqu(xmm_temp6, xmm_temp0);
-    __ pclmulqdq(xmm_temp6, xmm_temp1, 17);     // xmm6 holds a1*b1
-
-    __ pxor(xmm_temp4, xmm_temp5);      // xmm4 holds a0*b1 + a1*b0
-
-    __ movdqu(xmm_temp5, xmm_temp4);    // move the contents of xmm4 to xmm5
-    __ psrldq(xmm_temp4, 8);    // shift by xmm4 64 bits to the right
-    __ pslldq(xmm_temp5, 8);    // shift by xmm5 64 bits to the left
-    __ pxor(xmm_temp3, xmm_temp5);
-    __ pxor(xmm_temp6, xmm_temp4);      // Register pair <xmm6:xmm3> holds the result
-                                        // of the carry-less multiplication of
-                                        // xmm0 by xmm1.
-
-    // We shift the result of the multiplication by one bit position
-    // to the left to cope for the fact that the bits are reversed.
-    __ movdqu(xmm_temp7, xmm_temp3);
-    __ movdqu(xmm_temp8, xmm_temp6);
-    __ pslld(xmm_temp3, 1);
-    __ pslld(xmm_temp6, 1);
-    __ psrld(xmm_temp7, 31);
-    __ psrld(xmm_temp8, 31);
-    __ movdqu(xmm_temp9, xmm_temp7);
-    __ pslldq(xmm_temp8, 4);
-    __ pslldq(xmm_temp7, 4);
-    __ psrldq(xmm_temp9, 12);
-    __ por(xmm_temp3, xmm_temp7);
-    __ por(xmm_temp6, xmm_temp8);
-    __ por(xmm_temp6, xmm_temp9);
-
-    //
-    // First phase of the reduction
-    //
-    // Move xmm3 into xmm7, xmm8, xmm9 in order to perform the shifts
-    // independently.
-    __ movdqu(xmm_temp7, xmm_temp3);
-    __ movdqu(xmm_temp8, xmm_temp3);
-    __ movdqu(xmm_temp9, xmm_temp3);
-    __ pslld(xmm_temp7, 31);    // packed right shift shifting << 31
-    __ pslld(xmm_temp8, 30);    // packed right shift shifting << 30
-    __ pslld(xmm_temp9, 25);    // packed right shift shifting << 25
-    __ pxor(xmm_temp7, xmm_temp8);      // xor the shifted versions
-    __ pxor(xmm_temp7, xmm_temp9);
-    __ movdqu(xmm_temp8, xmm_temp7);
-    __ pslldq(xmm_temp7, 12);
-    __ psrldq(xmm_temp8, 4);
-    __ pxor(xmm_temp3, xmm_temp7);      // first phase of the reduction complete
+    ghash_multiply(xmm_state, xmm_H, xmm_lo, xmm_hi, xmm_temp1, xmm_temp2);
+    ghash_reduce(xmm_lo, xmm_hi, xmm_temp1, xmm_temp2, xmm_temp3, xmm_temp4);
+    __ movdqu(xmm_state, xmm_hi);
 
-    //
-    // Second phase of the reduction
-    //
-    // Make 3 copies of xmm3 in xmm2, xmm4, xmm5 for doing these
-    // shift operations.
-    __ movdqu(xmm_temp2, xmm_temp3);
-    __ movdqu(xmm_temp4, xmm_temp3);
-    __ movdqu(xmm_temp5, xmm_temp3);
-    __ psrld(xmm_temp2, 1);     // packed left shifting >> 1
-    __ psrld(xmm_temp4, 2);     // packed left shifting >> 2
-    __ psrld(xmm_temp5, 7);     // packed left shifting >> 7
-    __ pxor(xmm_temp2, xmm_temp4);      // xor the shifted versions
-    __ pxor(xmm_temp2, xmm_temp5);
-    __ pxor(xmm_temp2, xmm_temp8);
-    __ pxor(xmm_temp3, xmm_temp2);
-    __ pxor(xmm_temp6, xmm_temp3);      // the result is in xmm6
-
-    __ decrement(blocks);
-    __ jcc(Assembler::zero, L_exit);
-    __ movdqu(xmm_temp0, xmm_temp6);
     __ addptr(data, 16);
-    __ jmp(L_ghash_loop);
+    __ decrementl(blocks);
+    __ jcc(Assembler::notZero, L_ghash_loop);
 
     __ BIND(L_exit);
-    __ pshufb(xmm_temp6, xmm_temp10);          // Byte swap 16-byte result
-    __ movdqu(Address(state, 0), xmm_temp6);   // store the result
+    __ pshufb(xmm_state, xmm_long_swap);        // Byte swap 16-byte result
+    __ movdqu(Address(state, 0), xmm_state);    // store the result
 
 #ifdef _WIN64
     // restore xmm regs belonging to calling function
@@ -3848,6 +4693,415 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // x^n mod P for the (bit-reflected) CRC32C polynomial P.
+  static juint crc32c_x_pow(int n) {
+    juint v = 0x80000000;  // x^0
+    while (n-- > 0) {
+      v = (v & 1) ? (v >> 1) ^ 0x82F63B78 : (v >> 1);
+    }
+    return v;
+  }
+
+  // Consume 'len' bytes at 'buf' in blocks of 3 * 'chunk' bytes, running
+  // the crc32 instruction over the three chunks of a block as independent
+  // streams to hide its latency.  The partial CRCs are then merged with
+  // carry-less multiplies: crc(A|B|C) = crc(A) * x^(16 * chunk) ^
+  // crc(B) * x^(8 * chunk) ^ crc(C), where the products are reduced with a
+  // final crc32 over the 64-bit sum (which itself multiplies by x^33, hence
+  // the constants below).
+  void crc32c_3way(int chunk, Register crc, Register buf, Register len,
+                   Register crc1, Register crc2, Register pos,
+                   XMMRegister xk1, XMMRegister xk2, XMMRegister xtmp1, XMMRegister xtmp2) {
+    assert(chunk % 8 == 0, "whole quadwords per chunk");
+    Label L_done, L_block, L_chunk_loop;
+
+    __ cmpl(len, 3 * chunk);
+    __ jcc(Assembler::less, L_done);
+    __ movl(pos, (int32_t)crc32c_x_pow(8 * chunk - 33));
+    __ movdl(xk1, pos);
+    __ movl(pos, (int32_t)crc32c_x_pow(16 * chunk - 33));
+    __ movdl(xk2, pos);
+
+    __ BIND(L_block);
+    __ xorl(crc1, crc1);
+    __ xorl(crc2, crc2);
+    __ xorl(pos, pos);
+    __ align(16);
+    __ BIND(L_chunk_loop);
+    __ crc32(crc,  Address(buf, pos, Address::times_1, 0), 8);
+    __ crc32(crc1, Address(buf, pos, Address::times_1, chunk), 8);
+    __ crc32(crc2, Address(buf, pos, Address::times_1, 2 * chunk), 8);
+    __ addl(pos, 8);
+    __ cmpl(pos, chunk);
+    __ jcc(Assembler::less, L_chunk_loop);
+
+    __ movdl(xtmp1, crc);
+    __ pclmulqdq(xtmp1, xk2, 0x00);
+    __ movdl(xtmp2, crc1);
+    __ pclmulqdq(xtmp2, xk1, 0x00);
+    __ pxor(xtmp1, xtmp2);
+    __ movdq(pos, xtmp1);
+    __ xorl(crc, crc);
+    __ crc32(crc, pos, 8);
+    __ xorl(crc, crc2);
+
+    __ addptr(buf, 3 * chunk);
+    __ subl(len, 3 * chunk);
+    __ cmpl(len, 3 * chunk);
+    __ jcc(Assembler::greaterEqual, L_block);
+    __ BIND(L_done);
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int crc
+   *   c_rarg1   - byte* buf
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int crc result
+   */
+  address generate_updateBytesCRC32C() {
+    assert(UseCRC32CIntrinsics, "need SSE4.2 and CLMUL instructions");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesCRC32C");
+
+    address start = __ pc();
+    const Register crc   = c_rarg0;  // crc
+    const Register buf   = c_rarg1;  // source java byte array address
+    const Register len   = c_rarg2;  // length
+    const Register crc1  = r10;
+    const Register crc2  = r11;
+    const Register pos   = rax;
+    assert_different_registers(crc, buf, len, crc1, crc2, pos);
+
+    Label L_quad_loop, L_byte, L_byte_loop, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    // Long buffers in large blocks, what is left of them and medium sized
+    // ones in small blocks, so the merge cost stays well below the time
+    // saved by interleaving.
+    crc32c_3way(1024, crc, buf, len, crc1, crc2, pos, xmm0, xmm1, xmm2, xmm3);
+    crc32c_3way(128,  crc, buf, len, crc1, crc2, pos, xmm0, xmm1, xmm2, xmm3);
+
+    __ cmpl(len, 8);
+    __ jccb(Assembler::less, L_byte);
+    __ BIND(L_quad_loop);
+    __ crc32(crc, Address(buf, 0), 8);
+    __ addptr(buf, 8);
+    __ subl(len, 8);
+    __ cmpl(len, 8);
+    __ jccb(Assembler::greaterEqual, L_quad_loop);
+
+    __ BIND(L_byte);
+    __ testl(len, len);
+    __ jccb(Assembler::lessEqual, L_exit);
+    __ BIND(L_byte_loop);
+    __ crc32(crc, Address(buf, 0), 1);
+    __ increment(buf);
+    __ decrementl(len);
+    __ jccb(Assembler::greater, L_byte_loop);
+
+    __ BIND(L_exit);
+    __ movl(rax, crc);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int adler
+   *   c_rarg1   - byte* buf
+   *   c_rarg2   - int length
+   *
+   * Ouput:
+   *       rax   - int adler result
+   */
+  address generate_updateBytesAdler32() {
+    assert(UseAdler32Intrinsics, "need AVX2");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+
+    address start = __ pc();
+
+    const int BASE = 65521;
+    // Largest multiple of 32 bytes that can be summed before s2 may
+    // overflow 32 bits (zlib's NMAX is 5552).
+    const int NMAX = 5536;
+
+    // Copy the arguments out of the way first, c_rarg0 is rcx on Win64.
+    const Register len  = r11;
+    const Register buf  = r10;
+    const Register s2   = r9;
+    const Register s1   = r8;
+    const Register n    = rcx;
+    assert_different_registers(len, buf, s2, s1, n, rax, rdx);
+
+    const XMMRegister xs1      = xmm0;  // byte sums
+    const XMMRegister xs2      = xmm1;  // weighted byte sums
+    const XMMRegister xs3      = xmm2;  // sums of xs1 before each 32 bytes
+    const XMMRegister xdata    = xmm3;
+    const XMMRegister xtmp     = xmm4;
+    const XMMRegister xzero    = xmm5;
+    const XMMRegister xweights = xmm6;
+    const XMMRegister xones    = xmm7;
+
+    Label L_block, L_nmax_ok, L_vector_loop, L_tail, L_tail_loop, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ movl(len, c_rarg2);
+    __ movptr(buf, c_rarg1);
+    __ movl(s2, c_rarg0);
+    __ movl(s1, s2);
+    __ andl(s1, 0xFFFF);
+    __ shrl(s2, 16);
+
+    __ cmpl(len, 32);
+    __ jcc(Assembler::less, L_tail);
+
+#ifdef _WIN64
+    // save the xmm registers which must be preserved 6-7
+    __ subptr(rsp, 4 * wordSize);
+    __ movdqu(Address(rsp, 0), xmm6);
+    __ movdqu(Address(rsp, 2 * wordSize), xmm7);
+#endif
+    __ lea(rax, ExternalAddress(StubRoutines::x86::adler32_byte_weights_addr()));
+    __ vmovdqu(xweights, Address(rax, 0));
+    __ lea(rax, ExternalAddress(StubRoutines::x86::adler32_word_ones_addr()));
+    __ vmovdqu(xones, Address(rax, 0));
+    __ vpxor(xzero, xzero, xzero, true);
+
+    // s1 and s2 are reduced modulo BASE after each block of at most NMAX bytes.
+    __ BIND(L_block);
+    __ movl(n, len);
+    __ cmpl(n, NMAX);
+    __ jccb(Assembler::lessEqual, L_nmax_ok);
+    __ movl(n, NMAX);
+    __ BIND(L_nmax_ok);
+    __ andl(n, ~31);
+    __ subl(len, n);
+    // Every byte of the block adds the incoming s1 to s2 once more.
+    __ movl(rax, s1);
+    __ imull(rax, n);
+    __ addl(s2, rax);
+
+    __ vpxor(xs1, xs1, xs1, true);
+    __ vpxor(xs2, xs2, xs2, true);
+    __ vpxor(xs3, xs3, xs3, true);
+    __ align(16);
+    __ BIND(L_vector_loop);
+    __ vmovdqu(xdata, Address(buf, 0));
+    __ vpaddd(xs3, xs3, xs1, true);
+    __ vpsadbw(xtmp, xdata, xzero, true);
+    __ vpaddd(xs1, xs1, xtmp, true);
+    __ vpmaddubsw(xdata, xdata, xweights, true);
+    __ vpmaddwd(xdata, xdata, xones, true);
+    __ vpaddd(xs2, xs2, xdata, true);
+    __ addptr(buf, 32);
+    __ subl(n, 32);
+    __ jcc(Assembler::greater, L_vector_loop);
+
+    // s2 gets 32 * s1 for every 32 bytes that followed
+    __ vpslld(xs3, xs3, 5, true);
+    __ vpaddd(xs2, xs2, xs3, true);
+
+    // Add up the lanes.  The byte sums are in the low dwords of qwords.
+    __ vextracti128h(xtmp, xs1);
+    __ vpaddd(xs1, xs1, xtmp, false);
+    __ pshufd(xtmp, xs1, 0x4E);
+    __ paddd(xs1, xtmp);
+    __ movdl(rax, xs1);
+    __ addl(s1, rax);
+    __ vextracti128h(xtmp, xs2);
+    __ vpaddd(xs2, xs2, xtmp, false);
+    __ pshufd(xtmp, xs2, 0x4E);
+    __ paddd(xs2, xtmp);
+    __ pshufd(xtmp, xs2, 0xB1);
+    __ paddd(xs2, xtmp);
+    __ movdl(rax, xs2);
+    __ addl(s2, rax);
+
+    __ movl(n, BASE);
+    __ movl(rax, s1);
+    __ xorl(rdx, rdx);
+    __ divl(n);
+    __ movl(s1, rdx);
+    __ movl(rax, s2);
+    __ xorl(rdx, rdx);
+    __ divl(n);
+    __ movl(s2, rdx);
+
+    __ cmpl(len, 32);
+    __ jcc(Assembler::greaterEqual, L_block);
+
+    __ vzeroupper();
+#ifdef _WIN64
+    __ movdqu(xmm6, Address(rsp, 0));
+    __ movdqu(xmm7, Address(rsp, 2 * wordSize));
+    __ addptr(rsp, 4 * wordSize);
+#endif
+
+    // Fewer than 32 bytes left, which cannot overflow s1 or s2.
+    __ BIND(L_tail);
+    __ testl(len, len);
+    __ jccb(Assembler::lessEqual, L_exit);
+    __ BIND(L_tail_loop);
+    __ movzbl(rax, Address(buf, 0));
+    __ addl(s1, rax);
+    __ addl(s2, s1);
+    __ increment(buf);
+    __ decrementl(len);
+    __ jccb(Assembler::greater, L_tail_loop);
+
+    __ movl(n, BASE);
+    __ movl(rax, s1);
+    __ xorl(rdx, rdx);
+    __ divl(n);
+    __ movl(s1, rdx);
+    __ movl(rax, s2);
+    __ xorl(rdx, rdx);
+    __ divl(n);
+    __ movl(s2, rdx);
+
+    __ BIND(L_exit);
+    __ shll(s2, 16);
+    __ orl(s2, s1);
+    __ movl(rax, s2);
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - address a
+   *   c_rarg1   - address b
+   *   c_rarg2   - int length (in elements)
+   *   c_rarg3   - int log2 of the element size
+   *
+   * Ouput:
+   *       rax   - int index of the first mismatching element, or -1
+   */
+  address generate_vectorizedMismatch() {
+    assert(UseVectorizedMismatchIntrinsic, "need LP64");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "vectorizedMismatch");
+
+    address start = __ pc();
+
+    // Copy the arguments out of the way first, c_rarg0 is rcx on Win64
+    // and rcx holds the shift count.
+    const Register obja   = r11;
+    const Register objb   = r10;
+    const Register nbytes = r8;
+    const Register idx    = r9;
+    const Register limit  = rdx;
+    const Register tmp    = rax;
+    const Register scale  = rcx;
+    assert_different_registers(obja, objb, nbytes, idx, limit, tmp, scale);
+
+    Label L_vector_loop, L_qword, L_qword_loop, L_qword_found,
+          L_byte_loop, L_found, L_equal, L_exit;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    __ movptr(obja, c_rarg0);
+    __ movptr(objb, c_rarg1);
+    __ movl(tmp, c_rarg2);
+    __ movl(scale, c_rarg3);
+    __ shlq(tmp);                      // length in bytes
+    __ movq(nbytes, tmp);
+    __ xorl(idx, idx);
+
+    // Compare a vector at a time. A mismatching vector is rescanned by
+    // the quadword loop below, which finds the differing byte.
+    if (UseAVX >= 2 || (UseSSE >= 4 && VM_Version::supports_sse4_1())) {
+      const int vsize = UseAVX >= 2 ? 32 : 16;
+      __ movq(limit, nbytes);
+      __ andq(limit, -vsize);
+      __ BIND(L_vector_loop);
+      __ cmpq(idx, limit);
+      __ jccb(Assembler::aboveEqual, L_qword);
+      if (UseAVX >= 2) {
+        __ vmovdqu(xmm0, Address(obja, idx, Address::times_1));
+        __ vpxor(xmm0, xmm0, Address(objb, idx, Address::times_1), true);
+        __ vptest(xmm0, xmm0);
+      } else {
+        __ movdqu(xmm0, Address(obja, idx, Address::times_1));
+        __ movdqu(xmm1, Address(objb, idx, Address::times_1));
+        __ pxor(xmm0, xmm1);
+        __ ptest(xmm0, xmm0);
+      }
+      __ jccb(Assembler::notZero, L_qword);
+      __ addq(idx, vsize);
+      __ jmpb(L_vector_loop);
+    }
+
+    __ BIND(L_qword);
+    __ movq(limit, nbytes);
+    __ andq(limit, -8);
+    __ BIND(L_qword_loop);
+    __ cmpq(idx, limit);
+    __ jccb(Assembler::aboveEqual, L_byte_loop);
+    __ movq(tmp, Address(obja, idx, Address::times_1));
+    __ xorq(tmp, Address(objb, idx, Address::times_1));
+    __ jccb(Assembler::notZero, L_qword_found);
+    __ addq(idx, 8);
+    __ jmpb(L_qword_loop);
+
+    __ BIND(L_qword_found);
+    // Little endian: the lowest set bit is in the first differing byte.
+    __ bsfq(tmp, tmp);
+    __ shrl(tmp, LogBitsPerByte);
+    __ addq(idx, tmp);
+    __ jmpb(L_found);
+
+    // At most 7 bytes left.
+    __ BIND(L_byte_loop);
+    __ cmpq(idx, nbytes);
+    __ jccb(Assembler::aboveEqual, L_equal);
+    __ movzbl(tmp, Address(obja, idx, Address::times_1));
+    __ movzbl(limit, Address(objb, idx, Address::times_1));
+    __ cmpl(tmp, limit);
+    __ jccb(Assembler::notEqual, L_found);
+    __ incrementq(idx);
+    __ jmpb(L_byte_loop);
+
+    __ BIND(L_found);
+    __ movq(tmp, idx);
+    __ shrq(tmp);                      // byte offset to element index
+    __ jmpb(L_exit);
+
+    __ BIND(L_equal);
+    __ movl(tmp, -1);
+
+    __ BIND(L_exit);
+    if (UseAVX >= 2) {
+      __ vzeroupper();
+    }
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
 
   /**
    *  Arguments:
@@ -4191,6 +5445,18 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_crc_table_adr = (address)StubRoutines::x86::_crc_table;
       StubRoutines::_updateBytesCRC32 = generate_updateBytesCRC32();
     }
+    if (UseCRC32CIntrinsics) {
+      StubRoutines::_updateBytesCRC32C = generate_updateBytesCRC32C();
+    }
+    if (UseAdler32Intrinsics) {
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
+    // The interpreter's math entries call these.
+    if (UseLibmIntrinsic) {
+      StubRoutines::_dexp   = generate_libm_exp();
+      StubRoutines::_dlog   = generate_libm_log(false);
+      StubRoutines::_dlog10 = generate_libm_log(true);
+    }
   }
 
   void generate_all() {
@@ -4246,6 +5512,11 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_cipherBlockChaining_decryptAESCrypt = generate_cipherBlockChaining_decryptAESCrypt_Parallel();
     }
 
+    if (UseAESCTRIntrinsics) {
+      StubRoutines::x86::_counter_shuffle_mask_addr = generate_counter_shuffle_mask();
+      StubRoutines::_counterMode_AESCrypt = generate_counterMode_AESCrypt_Parallel();
+    }
+
     // Generate GHASH intrinsics code
     if (UseGHASHIntrinsics) {
       StubRoutines::x86::_ghash_long_swap_mask_addr = generate_ghash_long_swap_mask();
@@ -4260,7 +5531,16 @@ class StubGenerator: public StubCodeGenerator {
     generate_safefetch("SafeFetchN", sizeof(intptr_t), &StubRoutines::_safefetchN_entry,
                                                        &StubRoutines::_safefetchN_fault_pc,
                                                        &StubRoutines::_safefetchN_continuation_pc);
+
+    if (UseVectorizedMismatchIntrinsic) {
+      StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
+    }
 #ifdef COMPILER2
+    if (UseLibmIntrinsic) {
+      StubRoutines::_dexp_array   = generate_libm_array("libm_exp_array", StubRoutines::dexp(), true, false);
+      StubRoutines::_dlog_array   = generate_libm_array("libm_log_array", StubRoutines::dlog(), false, false);
+      StubRoutines::_dlog10_array = generate_libm_array("libm_log10_array", StubRoutines::dlog10(), false, true);
+    }
     if (UseMultiplyToLenIntrinsic) {
       StubRoutines::_multiplyToLen = generate_multiplyToLen();
     }
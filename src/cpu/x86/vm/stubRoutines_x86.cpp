@@ -33,6 +33,7 @@
 
 address StubRoutines::x86::_verify_mxcsr_entry = NULL;
 address StubRoutines::x86::_key_shuffle_mask_addr = NULL;
+address StubRoutines::x86::_counter_shuffle_mask_addr = NULL;
 address StubRoutines::x86::_ghash_long_swap_mask_addr = NULL;
 address StubRoutines::x86::_ghash_byte_swap_mask_addr = NULL;
 
@@ -130,3 +131,255 @@ juint StubRoutines::x86::_crc_table[] =
     0x5d681b02UL, 0x2a6f2b94UL, 0xb40bbe37UL, 0xc30c8ea1UL, 0x5a05df1bUL,
     0x2d02ef8dUL
 };
+
+/**
+ * Weights of the bytes in a 32 byte Adler32 block, from the first to the
+ * last, and the multipliers that sum adjacent weighted 16-bit pairs.
+ */
+jbyte StubRoutines::x86::_adler32_byte_weights[] =
+{
+    32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+    16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1
+};
+
+jshort StubRoutines::x86::_adler32_word_ones[] =
+{
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+/**
+ * Constants for the SSE2 exp stub. x = n*ln2/64 + r with |r| <= ln2/128,
+ * exp(x) = 2^(n>>6) * 2^((n&63)/64) * exp(r). The header layout is fixed
+ * by the offsets used in StubGenerator::generate_libm_exp().
+ */
+julong StubRoutines::x86::_libm_exp_table[] =
+{
+  UCONST64(0x40571547652b82fe), // 64/ln2
+  UCONST64(0x4338000000000000), // 1.5*2^52, rounding shifter
+  UCONST64(0x3f862e42fee00000), // ln2_hi/64
+  UCONST64(0x3d8a39ef35793c76), // ln2_lo/64
+  UCONST64(0x3f56c16c16c16c17), // 1/720
+  UCONST64(0x3f81111111111111), // 1/120
+  UCONST64(0x3fa5555555555555), // 1/24
+  UCONST64(0x3fc5555555555555), // 1/6
+  UCONST64(0x3fe0000000000000), // 1/2
+  UCONST64(0x0000000000000000), // padding
+  // 2^(j/64) as a double-double, j = 0..63
+  UCONST64(0x3ff0000000000000), UCONST64(0x0000000000000000),
+  UCONST64(0x3ff02c9a3e778061), UCONST64(0xbc719083535b085d),
+  UCONST64(0x3ff059b0d3158574), UCONST64(0x3c8d73e2a475b465),
+  UCONST64(0x3ff0874518759bc8), UCONST64(0x3c6186be4bb284ff),
+  UCONST64(0x3ff0b5586cf9890f), UCONST64(0x3c98a62e4adc610b),
+  UCONST64(0x3ff0e3ec32d3d1a2), UCONST64(0x3c403a1727c57b53),
+  UCONST64(0x3ff11301d0125b51), UCONST64(0xbc96c51039449b3a),
+  UCONST64(0x3ff1429aaea92de0), UCONST64(0xbc932fbf9af1369e),
+  UCONST64(0x3ff172b83c7d517b), UCONST64(0xbc819041b9d78a76),
+  UCONST64(0x3ff1a35beb6fcb75), UCONST64(0x3c8e5b4c7b4968e4),
+  UCONST64(0x3ff1d4873168b9aa), UCONST64(0x3c9e016e00a2643c),
+  UCONST64(0x3ff2063b88628cd6), UCONST64(0x3c8dc775814a8495),
+  UCONST64(0x3ff2387a6e756238), UCONST64(0x3c99b07eb6c70573),
+  UCONST64(0x3ff26b4565e27cdd), UCONST64(0x3c82bd339940e9d9),
+  UCONST64(0x3ff29e9df51fdee1), UCONST64(0x3c8612e8afad1255),
+  UCONST64(0x3ff2d285a6e4030b), UCONST64(0x3c90024754db41d5),
+  UCONST64(0x3ff306fe0a31b715), UCONST64(0x3c86f46ad23182e4),
+  UCONST64(0x3ff33c08b26416ff), UCONST64(0x3c932721843659a6),
+  UCONST64(0x3ff371a7373aa9cb), UCONST64(0xbc963aeabf42eae2),
+  UCONST64(0x3ff3a7db34e59ff7), UCONST64(0xbc75e436d661f5e3),
+  UCONST64(0x3ff3dea64c123422), UCONST64(0x3c8ada0911f09ebc),
+  UCONST64(0x3ff4160a21f72e2a), UCONST64(0xbc5ef3691c309278),
+  UCONST64(0x3ff44e086061892d), UCONST64(0x3c489b7a04ef80d0),
+  UCONST64(0x3ff486a2b5c13cd0), UCONST64(0x3c73c1a3b69062f0),
+  UCONST64(0x3ff4bfdad5362a27), UCONST64(0x3c7d4397afec42e2),
+  UCONST64(0x3ff4f9b2769d2ca7), UCONST64(0xbc94b309d25957e3),
+  UCONST64(0x3ff5342b569d4f82), UCONST64(0xbc807abe1db13cad),
+  UCONST64(0x3ff56f4736b527da), UCONST64(0x3c99bb2c011d93ad),
+  UCONST64(0x3ff5ab07dd485429), UCONST64(0x3c96324c054647ad),
+  UCONST64(0x3ff5e76f15ad2148), UCONST64(0x3c9ba6f93080e65e),
+  UCONST64(0x3ff6247eb03a5585), UCONST64(0xbc9383c17e40b497),
+  UCONST64(0x3ff6623882552225), UCONST64(0xbc9bb60987591c34),
+  UCONST64(0x3ff6a09e667f3bcd), UCONST64(0xbc9bdd3413b26456),
+  UCONST64(0x3ff6dfb23c651a2f), UCONST64(0xbc6bbe3a683c88ab),
+  UCONST64(0x3ff71f75e8ec5f74), UCONST64(0xbc816e4786887a99),
+  UCONST64(0x3ff75feb564267c9), UCONST64(0xbc90245957316dd3),
+  UCONST64(0x3ff7a11473eb0187), UCONST64(0xbc841577ee04992f),
+  UCONST64(0x3ff7e2f336cf4e62), UCONST64(0x3c705d02ba15797e),
+  UCONST64(0x3ff82589994cce13), UCONST64(0xbc9d4c1dd41532d8),
+  UCONST64(0x3ff868d99b4492ed), UCONST64(0xbc9fc6f89bd4f6ba),
+  UCONST64(0x3ff8ace5422aa0db), UCONST64(0x3c96e9f156864b27),
+  UCONST64(0x3ff8f1ae99157736), UCONST64(0x3c85cc13a2e3976c),
+  UCONST64(0x3ff93737b0cdc5e5), UCONST64(0xbc675fc781b57ebc),
+  UCONST64(0x3ff97d829fde4e50), UCONST64(0xbc9d185b7c1b85d1),
+  UCONST64(0x3ff9c49182a3f090), UCONST64(0x3c7c7c46b071f2be),
+  UCONST64(0x3ffa0c667b5de565), UCONST64(0xbc9359495d1cd533),
+  UCONST64(0x3ffa5503b23e255d), UCONST64(0xbc9d2f6edb8d41e1),
+  UCONST64(0x3ffa9e6b5579fdbf), UCONST64(0x3c90fac90ef7fd31),
+  UCONST64(0x3ffae89f995ad3ad), UCONST64(0x3c97a1cd345dcc81),
+  UCONST64(0x3ffb33a2b84f15fb), UCONST64(0xbc62805e3084d708),
+  UCONST64(0x3ffb7f76f2fb5e47), UCONST64(0xbc75584f7e54ac3b),
+  UCONST64(0x3ffbcc1e904bc1d2), UCONST64(0x3c823dd07a2d9e84),
+  UCONST64(0x3ffc199bdd85529c), UCONST64(0x3c811065895048dd),
+  UCONST64(0x3ffc67f12e57d14b), UCONST64(0x3c92884dff483cad),
+  UCONST64(0x3ffcb720dcef9069), UCONST64(0x3c7503cbd1e949db),
+  UCONST64(0x3ffd072d4a07897c), UCONST64(0xbc9cbc3743797a9c),
+  UCONST64(0x3ffd5818dcfba487), UCONST64(0x3c82ed02d75b3707),
+  UCONST64(0x3ffda9e603db3285), UCONST64(0x3c9c2300696db532),
+  UCONST64(0x3ffdfc97337b9b5f), UCONST64(0xbc91a5cd4f184b5c),
+  UCONST64(0x3ffe502ee78b3ff6), UCONST64(0x3c839e8980a9cc8f),
+  UCONST64(0x3ffea4afa2a490da), UCONST64(0xbc9e9c23179c2893),
+  UCONST64(0x3ffefa1bee615a27), UCONST64(0x3c9dc7f486a4b6b0),
+  UCONST64(0x3fff50765b6e4540), UCONST64(0x3c99d3e12dd8a18b),
+  UCONST64(0x3fffa7c1819e90d8), UCONST64(0x3c874853f3a5931e)
+};
+
+/**
+ * Constants for the SSE2 log and log10 stubs. x = 2^m * f, f in [1, 2),
+ * log(x) = m*ln2 + log(F) + log1p((f - F)/F) with F the nearest
+ * multiple of 1/128. Entry 128 covers f rounding up to 2.
+ */
+julong StubRoutines::x86::_libm_log_table[] =
+{
+  UCONST64(0x3fe62e42fee00000), // ln2_hi
+  UCONST64(0x3dea39ef35793c76), // ln2_lo
+  UCONST64(0x3fdbcb7b10000000), // 1/ln10, high 26 bits
+  UCONST64(0x3e349b9438ca9aae), // 1/ln10, low part
+  UCONST64(0x3fc2492492492492), // 1/7
+  UCONST64(0xbfc5555555555555), // -1/6
+  UCONST64(0x3fc999999999999a), // 1/5
+  UCONST64(0xbfd0000000000000), // -1/4
+  UCONST64(0x3fd5555555555555), // 1/3
+  UCONST64(0xbfe0000000000000), // -1/2
+  UCONST64(0x3ff0000000000000), // exponent bits of 1.0
+  UCONST64(0xfffffffffffff000), // clears the low 12 bits of uh
+  UCONST64(0xfffffffff8000000), // keeps the top 26 bits for the log10 split
+  UCONST64(0x0000000000000000), // padding
+  // F = 1 + j/128, 1/F, log(F) as hi + lo with hi a multiple of 2^-32, j = 0..128
+  UCONST64(0x3ff0000000000000), UCONST64(0x3ff0000000000000), UCONST64(0x0000000000000000), UCONST64(0x0000000000000000),
+  UCONST64(0x3ff0200000000000), UCONST64(0x3fefc07f01fc07f0), UCONST64(0x3f7fe02a70000000), UCONST64(0xbdd3be61dc0f225c),
+  UCONST64(0x3ff0400000000000), UCONST64(0x3fef81f81f81f820), UCONST64(0x3f8fc0a8b0000000), UCONST64(0x3dbf807c79f3db4f),
+  UCONST64(0x3ff0600000000000), UCONST64(0x3fef44659e4a4271), UCONST64(0x3f97b91b08000000), UCONST64(0xbda52772ab6c055a),
+  UCONST64(0x3ff0800000000000), UCONST64(0x3fef07c1f07c1f08), UCONST64(0x3f9f829b10000000), UCONST64(0xbdd87ccffb30703f),
+  UCONST64(0x3ff0a00000000000), UCONST64(0x3feecc07b301ecc0), UCONST64(0x3fa39e87ba000000), UCONST64(0xbd642a056fea4dfd),
+  UCONST64(0x3ff0c00000000000), UCONST64(0x3fee9131abf0b767), UCONST64(0x3fa77458f6000000), UCONST64(0x3db96e7e231a7951),
+  UCONST64(0x3ff0e00000000000), UCONST64(0x3fee573ac901e574), UCONST64(0x3fab42dd72000000), UCONST64(0xbddcd1c827ae5d67),
+  UCONST64(0x3ff1000000000000), UCONST64(0x3fee1e1e1e1e1e1e), UCONST64(0x3faf0a30c0000000), UCONST64(0x3da162a6617cc971),
+  UCONST64(0x3ff1200000000000), UCONST64(0x3fede5d6e3f8868a), UCONST64(0x3fb16536ef000000), UCONST64(0xbdd72147c5e768fa),
+  UCONST64(0x3ff1400000000000), UCONST64(0x3fedae6076b981db), UCONST64(0x3fb341d796000000), UCONST64(0x3dbbd1d092998376),
+  UCONST64(0x3ff1600000000000), UCONST64(0x3fed77b654b82c34), UCONST64(0x3fb51b073f000000), UCONST64(0x3d9860fda49e39a2),
+  UCONST64(0x3ff1800000000000), UCONST64(0x3fed41d41d41d41d), UCONST64(0x3fb6f0d28b000000), UCONST64(0xbdba94b4641b6646),
+  UCONST64(0x3ff1a00000000000), UCONST64(0x3fed0cb58f6ec074), UCONST64(0x3fb8c345d6000000), UCONST64(0x3dc8cd907ad65a15),
+  UCONST64(0x3ff1c00000000000), UCONST64(0x3fecd85689039b0b), UCONST64(0x3fba926d3a000000), UCONST64(0x3dd2b558d942f48b),
+  UCONST64(0x3ff1e00000000000), UCONST64(0x3feca4b3055ee191), UCONST64(0x3fbc5e548f000000), UCONST64(0x3dd6f1d0c57585fc),
+  UCONST64(0x3ff2000000000000), UCONST64(0x3fec71c71c71c71c), UCONST64(0x3fbe27076e000000), UCONST64(0x3dc57972f4f54400),
+  UCONST64(0x3ff2200000000000), UCONST64(0x3fec3f8f01c3f8f0), UCONST64(0x3fbfec9132000000), UCONST64(0xbdc20aa2aae8d733),
+  UCONST64(0x3ff2400000000000), UCONST64(0x3fec0e070381c0e0), UCONST64(0x3fc0d77e7d000000), UCONST64(0xbdd7b8d34cb44743),
+  UCONST64(0x3ff2600000000000), UCONST64(0x3febdd2b899406f7), UCONST64(0x3fc1b72ad5000000), UCONST64(0x3dd7b3d014830234),
+  UCONST64(0x3ff2800000000000), UCONST64(0x3febacf914c1bad0), UCONST64(0x3fc29552f8000000), UCONST64(0x3dcff5234c05dc71),
+  UCONST64(0x3ff2a00000000000), UCONST64(0x3feb7d6c3dda338b), UCONST64(0x3fc371fc20000000), UCONST64(0x3dce8f743bcd96c5),
+  UCONST64(0x3ff2c00000000000), UCONST64(0x3feb4e81b4e81b4f), UCONST64(0x3fc44d2b6d000000), UCONST64(0xbdda4170cc161358),
+  UCONST64(0x3ff2e00000000000), UCONST64(0x3feb2036406c80d9), UCONST64(0x3fc526e5e3800000), UCONST64(0x3dd0da1bd17200eb),
+  UCONST64(0x3ff3000000000000), UCONST64(0x3feaf286bca1af28), UCONST64(0x3fc5ff3070800000), UCONST64(0x3dd3c9e9e439f105),
+  UCONST64(0x3ff3200000000000), UCONST64(0x3feac5701ac5701b), UCONST64(0x3fc6d60fe7000000), UCONST64(0x3dc9d21c8d54765c),
+  UCONST64(0x3ff3400000000000), UCONST64(0x3fea98ef606a63be), UCONST64(0x3fc7ab8902000000), UCONST64(0x3dc0d9091be36b2d),
+  UCONST64(0x3ff3600000000000), UCONST64(0x3fea6d01a6d01a6d), UCONST64(0x3fc87fa065000000), UCONST64(0x3dd0648848100481),
+  UCONST64(0x3ff3800000000000), UCONST64(0x3fea41a41a41a41a), UCONST64(0x3fc9525a9d000000), UCONST64(0xbdb75297137d9f16),
+  UCONST64(0x3ff3a00000000000), UCONST64(0x3fea16d3f97a4b02), UCONST64(0x3fca23bc20000000), UCONST64(0xbdcd4a9ce6c8ee50),
+  UCONST64(0x3ff3c00000000000), UCONST64(0x3fe9ec8e951033d9), UCONST64(0x3fcaf3c94e800000), UCONST64(0x3d77fe5b19cc0327),
+  UCONST64(0x3ff3e00000000000), UCONST64(0x3fe9c2d14ee4a102), UCONST64(0x3fcbc28674000000), UCONST64(0x3dd6c66b14fce745),
+  UCONST64(0x3ff4000000000000), UCONST64(0x3fe999999999999a), UCONST64(0x3fcc8ff7c7800000), UCONST64(0x3dca9a21ac25d81f),
+  UCONST64(0x3ff4200000000000), UCONST64(0x3fe970e4f80cb872), UCONST64(0x3fcd5c216b800000), UCONST64(0xbdd822375237794d),
+  UCONST64(0x3ff4400000000000), UCONST64(0x3fe948b0fcd6e9e0), UCONST64(0x3fce27076e000000), UCONST64(0x3dd57972f4f54400),
+  UCONST64(0x3ff4600000000000), UCONST64(0x3fe920fb49d0e229), UCONST64(0x3fcef0adcc000000), UCONST64(0xbdd1d364d6f390d6),
+  UCONST64(0x3ff4800000000000), UCONST64(0x3fe8f9c18f9c18fa), UCONST64(0x3fcfb9186d800000), UCONST64(0xbdd0e0eab9555cca),
+  UCONST64(0x3ff4a00000000000), UCONST64(0x3fe8d3018d3018d3), UCONST64(0x3fd0402594c00000), UCONST64(0xbdc65f7e4a3b085f),
+  UCONST64(0x3ff4c00000000000), UCONST64(0x3fe8acb90f6bf3aa), UCONST64(0x3fd0a324e2800000), UCONST64(0xbdc8de39411810c0),
+  UCONST64(0x3ff4e00000000000), UCONST64(0x3fe886e5f0abb04a), UCONST64(0x3fd1058bf9c00000), UCONST64(0xbdd1b52ae7605f55),
+  UCONST64(0x3ff5000000000000), UCONST64(0x3fe8618618618618), UCONST64(0x3fd1675cabc00000), UCONST64(0xbdd459f1fc63382b),
+  UCONST64(0x3ff5200000000000), UCONST64(0x3fe83c977ab2bedd), UCONST64(0x3fd1c898c1800000), UCONST64(0xbdd666050439718b),
+  UCONST64(0x3ff5400000000000), UCONST64(0x3fe8181818181818), UCONST64(0x3fd22941fbc00000), UCONST64(0x3dcef2cb44850a7b),
+  UCONST64(0x3ff5600000000000), UCONST64(0x3fe7f405fd017f40), UCONST64(0x3fd2895a13c00000), UCONST64(0x3dde86a35eb49305),
+  UCONST64(0x3ff5800000000000), UCONST64(0x3fe7d05f417d05f4), UCONST64(0x3fd2e8e2bb000000), UCONST64(0xbddee2cf63d336e5),
+  UCONST64(0x3ff5a00000000000), UCONST64(0x3fe7ad2208e0ecc3), UCONST64(0x3fd347dd9a800000), UCONST64(0x3dd87d54d6456750),
+  UCONST64(0x3ff5c00000000000), UCONST64(0x3fe78a4c8178a4c8), UCONST64(0x3fd3a64c55800000), UCONST64(0xbdd6ba1638d0ca33),
+  UCONST64(0x3ff5e00000000000), UCONST64(0x3fe767dce434a9b1), UCONST64(0x3fd4043086800000), UCONST64(0x3dba9f8ef43049f8),
+  UCONST64(0x3ff6000000000000), UCONST64(0x3fe745d1745d1746), UCONST64(0x3fd4618bc2000000), UCONST64(0x3ddc5ec27d0b7b38),
+  UCONST64(0x3ff6200000000000), UCONST64(0x3fe724287f46debc), UCONST64(0x3fd4be5f95800000), UCONST64(0xbdc10ebe4966cd6c),
+  UCONST64(0x3ff6400000000000), UCONST64(0x3fe702e05c0b8170), UCONST64(0x3fd51aad87400000), UCONST64(0xbdd207d2f636c29f),
+  UCONST64(0x3ff6600000000000), UCONST64(0x3fe6e1f76b4337c7), UCONST64(0x3fd5767717400000), UCONST64(0x3db569b1526adb28),
+  UCONST64(0x3ff6800000000000), UCONST64(0x3fe6c16c16c16c17), UCONST64(0x3fd5d1bdbf400000), UCONST64(0x3dd809ca508d8e0f),
+  UCONST64(0x3ff6a00000000000), UCONST64(0x3fe6a13cd1537290), UCONST64(0x3fd62c82f2c00000), UCONST64(0xbdb8e1ab42428375),
+  UCONST64(0x3ff6c00000000000), UCONST64(0x3fe6816816816817), UCONST64(0x3fd686c81e800000), UCONST64(0x3ddb14aec442be10),
+  UCONST64(0x3ff6e00000000000), UCONST64(0x3fe661ec6a5122f9), UCONST64(0x3fd6e08eaa400000), UCONST64(0xbdd45e1c73ec6ce7),
+  UCONST64(0x3ff7000000000000), UCONST64(0x3fe642c8590b2164), UCONST64(0x3fd739d7f6c00000), UCONST64(0xbdb0bfe58c76ceb0),
+  UCONST64(0x3ff7200000000000), UCONST64(0x3fe623fa77016240), UCONST64(0x3fd792a55fc00000), UCONST64(0x3ddd47a27c15da48),
+  UCONST64(0x3ff7400000000000), UCONST64(0x3fe6058160581606), UCONST64(0x3fd7eaf83b800000), UCONST64(0x3da57e1b259d2f3e),
+  UCONST64(0x3ff7600000000000), UCONST64(0x3fe5e75bb8d015e7), UCONST64(0x3fd842d1da000000), UCONST64(0x3dde8b17493b1466),
+  UCONST64(0x3ff7800000000000), UCONST64(0x3fe5c9882b931057), UCONST64(0x3fd89a3386c00000), UCONST64(0x3d9425ab5a718811),
+  UCONST64(0x3ff7a00000000000), UCONST64(0x3fe5ac056b015ac0), UCONST64(0x3fd8f11e87400000), UCONST64(0xbdc33a7103d12c55),
+  UCONST64(0x3ff7c00000000000), UCONST64(0x3fe58ed2308158ed), UCONST64(0x3fd947941c400000), UCONST64(0xbddee90545b322ec),
+  UCONST64(0x3ff7e00000000000), UCONST64(0x3fe571ed3c506b3a), UCONST64(0x3fd99d9581000000), UCONST64(0x3dd7e08acba92eec),
+  UCONST64(0x3ff8000000000000), UCONST64(0x3fe5555555555555), UCONST64(0x3fd9f323ecc00000), UCONST64(0xbd79ed03525ca264),
+  UCONST64(0x3ff8200000000000), UCONST64(0x3fe5390948f40feb), UCONST64(0x3fda484091000000), UCONST64(0xbdda44f5d4035949),
+  UCONST64(0x3ff8400000000000), UCONST64(0x3fe51d07eae2f815), UCONST64(0x3fda9cec9a800000), UCONST64(0x3dda08498d484ff5),
+  UCONST64(0x3ff8600000000000), UCONST64(0x3fe5015015015015), UCONST64(0x3fdaf12932400000), UCONST64(0x3dbde1ac44ce1128),
+  UCONST64(0x3ff8800000000000), UCONST64(0x3fe4e5e0a72f0539), UCONST64(0x3fdb44f77bc00000), UCONST64(0x3dc91ec5197ddb56),
+  UCONST64(0x3ff8a00000000000), UCONST64(0x3fe4cab88725af6e), UCONST64(0x3fdb985896800000), UCONST64(0x3dd310fb598fb150),
+  UCONST64(0x3ff8c00000000000), UCONST64(0x3fe4afd6a052bf5b), UCONST64(0x3fdbeb4d9dc00000), UCONST64(0xbdd8e4840879e2c8),
+  UCONST64(0x3ff8e00000000000), UCONST64(0x3fe49539e3b2d067), UCONST64(0x3fdc3dd7a7c00000), UCONST64(0x3dcb5a9ae7678297),
+  UCONST64(0x3ff9000000000000), UCONST64(0x3fe47ae147ae147b), UCONST64(0x3fdc8ff7c7800000), UCONST64(0x3dda9a21ac25d81f),
+  UCONST64(0x3ff9200000000000), UCONST64(0x3fe460cbc7f5cf9a), UCONST64(0x3fdce1af0b800000), UCONST64(0x3db7cfadedf4af2b),
+  UCONST64(0x3ff9400000000000), UCONST64(0x3fe446f86562d9fb), UCONST64(0x3fdd32fe7e000000), UCONST64(0x3d8d7aac3bd9197d),
+  UCONST64(0x3ff9600000000000), UCONST64(0x3fe42d6625d51f87), UCONST64(0x3fdd83e725800000), UCONST64(0x3dc45e7ca0a2b746),
+  UCONST64(0x3ff9800000000000), UCONST64(0x3fe4141414141414), UCONST64(0x3fddd46a04c00000), UCONST64(0x3d9c4a0bee626a4a),
+  UCONST64(0x3ff9a00000000000), UCONST64(0x3fe3fb013fb013fb), UCONST64(0x3fde24881a800000), UCONST64(0xbdac9ecf1a1385d3),
+  UCONST64(0x3ff9c00000000000), UCONST64(0x3fe3e22cbce4a902), UCONST64(0x3fde744261c00000), UCONST64(0x3dd68787e37da36f),
+  UCONST64(0x3ff9e00000000000), UCONST64(0x3fe3c995a47babe7), UCONST64(0x3fdec399d2400000), UCONST64(0x3dba33005d73b950),
+  UCONST64(0x3ffa000000000000), UCONST64(0x3fe3b13b13b13b14), UCONST64(0x3fdf128f5fc00000), UCONST64(0xbdd0f9134ca37c4f),
+  UCONST64(0x3ffa200000000000), UCONST64(0x3fe3991c2c187f63), UCONST64(0x3fdf6123fa800000), UCONST64(0xbdcfaea73d752787),
+  UCONST64(0x3ffa400000000000), UCONST64(0x3fe3813813813814), UCONST64(0x3fdfaf588f800000), UCONST64(0xbdbc33849941306c),
+  UCONST64(0x3ffa600000000000), UCONST64(0x3fe3698df3de0748), UCONST64(0x3fdffd2e08400000), UCONST64(0x3dd7f4985597d036),
+  UCONST64(0x3ffa800000000000), UCONST64(0x3fe3521cfb2b78c1), UCONST64(0x3fe02552a5a00000), UCONST64(0x3dc743fb1a71a576),
+  UCONST64(0x3ffaa00000000000), UCONST64(0x3fe33ae45b57bcb2), UCONST64(0x3fe04bdf9da00000), UCONST64(0x3dd24da4cbf98201),
+  UCONST64(0x3ffac00000000000), UCONST64(0x3fe323e34a2b10bf), UCONST64(0x3fe0723e5c200000), UCONST64(0xbdb905fd8d434e3b),
+  UCONST64(0x3ffae00000000000), UCONST64(0x3fe30d190130d190), UCONST64(0x3fe0986f4f600000), UCONST64(0xbdd195be8dc04ad6),
+  UCONST64(0x3ffb000000000000), UCONST64(0x3fe2f684bda12f68), UCONST64(0x3fe0be72e4200000), UCONST64(0x3dc4aa0ada625eed),
+  UCONST64(0x3ffb200000000000), UCONST64(0x3fe2e025c04b8097), UCONST64(0x3fe0e44985e00000), UCONST64(0xbddc66e8122a3443),
+  UCONST64(0x3ffb400000000000), UCONST64(0x3fe2c9fb4d812ca0), UCONST64(0x3fe109f39e200000), UCONST64(0x3dda992dfbc7d936),
+  UCONST64(0x3ffb600000000000), UCONST64(0x3fe2b404ad012b40), UCONST64(0x3fe12f7195a00000), UCONST64(0xbdd8208759fdb9cc),
+  UCONST64(0x3ffb800000000000), UCONST64(0x3fe29e4129e4129e), UCONST64(0x3fe154c3d3000000), UCONST64(0xbdd6542cace198b9),
+  UCONST64(0x3ffba00000000000), UCONST64(0x3fe288b01288b013), UCONST64(0x3fe179eabbe00000), UCONST64(0xbdcd997d00e7c641),
+  UCONST64(0x3ffbc00000000000), UCONST64(0x3fe27350b8812735), UCONST64(0x3fe19ee6b4600000), UCONST64(0x3dcf25bb3172f75e),
+  UCONST64(0x3ffbe00000000000), UCONST64(0x3fe25e22708092f1), UCONST64(0x3fe1c3b81f800000), UCONST64(0xbddd87b686d60e26),
+  UCONST64(0x3ffc000000000000), UCONST64(0x3fe2492492492492), UCONST64(0x3fe1e85f5e800000), UCONST64(0xbddf7e5f84274cb4),
+  UCONST64(0x3ffc200000000000), UCONST64(0x3fe23456789abcdf), UCONST64(0x3fe20cdcd1a00000), UCONST64(0xbddaa924d95f85e1),
+  UCONST64(0x3ffc400000000000), UCONST64(0x3fe21fb78121fb78), UCONST64(0x3fe23130d7c00000), UCONST64(0xbda40bd7d21c978e),
+  UCONST64(0x3ffc600000000000), UCONST64(0x3fe20b470c67c0d9), UCONST64(0x3fe2555bcea00000), UCONST64(0xbdcc20d30fef1495),
+  UCONST64(0x3ffc800000000000), UCONST64(0x3fe1f7047dc11f70), UCONST64(0x3fe2795e12800000), UCONST64(0x3dd36235d6f07e7b),
+  UCONST64(0x3ffca00000000000), UCONST64(0x3fe1e2ef3b3fb874), UCONST64(0x3fe29d37fec00000), UCONST64(0x3db5845642e6b65d),
+  UCONST64(0x3ffcc00000000000), UCONST64(0x3fe1cf06ada2811d), UCONST64(0x3fe2c0e9ed400000), UCONST64(0x3dc23a2ee5ea70c7),
+  UCONST64(0x3ffce00000000000), UCONST64(0x3fe1bb4a4046ed29), UCONST64(0x3fe2e47436e00000), UCONST64(0x3dc009a10150861a),
+  UCONST64(0x3ffd000000000000), UCONST64(0x3fe1a7b9611a7b96), UCONST64(0x3fe307d733400000), UCONST64(0x3dde217c3f6b2144),
+  UCONST64(0x3ffd200000000000), UCONST64(0x3fe19453808ca29c), UCONST64(0x3fe32b1339200000), UCONST64(0xbddbc51d9bf55293),
+  UCONST64(0x3ffd400000000000), UCONST64(0x3fe1811811811812), UCONST64(0x3fe34e289da00000), UCONST64(0xbdb8f16748a3693c),
+  UCONST64(0x3ffd600000000000), UCONST64(0x3fe16e0689427379), UCONST64(0x3fe37117b5400000), UCONST64(0x3dcd1ed717740921),
+  UCONST64(0x3ffd800000000000), UCONST64(0x3fe15b1e5f75270d), UCONST64(0x3fe393e0d3600000), UCONST64(0xbdd3abccac777b40),
+  UCONST64(0x3ffda00000000000), UCONST64(0x3fe1485f0e0acd3b), UCONST64(0x3fe3b6844a000000), UCONST64(0xbd3eea838909f3d3),
+  UCONST64(0x3ffdc00000000000), UCONST64(0x3fe135c81135c811), UCONST64(0x3fe3d9026a800000), UCONST64(0xbddd520ab7f7b386),
+  UCONST64(0x3ffde00000000000), UCONST64(0x3fe12358e75d3033), UCONST64(0x3fe3fb5b84e00000), UCONST64(0xbddd217b4962c55f),
+  UCONST64(0x3ffe000000000000), UCONST64(0x3fe1111111111111), UCONST64(0x3fe41d8fe8400000), UCONST64(0x3dc9cab99192f30c),
+  UCONST64(0x3ffe200000000000), UCONST64(0x3fe0fef010fef011), UCONST64(0x3fe43f9fe3000000), UCONST64(0xbdc8c66216361192),
+  UCONST64(0x3ffe400000000000), UCONST64(0x3fe0ecf56be69c90), UCONST64(0x3fe4618bc2200000), UCONST64(0xbdbd09ec17a42642),
+  UCONST64(0x3ffe600000000000), UCONST64(0x3fe0db20a88f4696), UCONST64(0x3fe48353d1e00000), UCONST64(0x3dd511bee7abd176),
+  UCONST64(0x3ffe800000000000), UCONST64(0x3fe0c9714fbcda3b), UCONST64(0x3fe4a4f85dc00000), UCONST64(0xbddf8289fbb08171),
+  UCONST64(0x3ffea00000000000), UCONST64(0x3fe0b7e6ec259dc8), UCONST64(0x3fe4c679afc00000), UCONST64(0x3dd9dc7362d1d9ba),
+  UCONST64(0x3ffec00000000000), UCONST64(0x3fe0a6810a6810a7), UCONST64(0x3fe4e7d811c00000), UCONST64(0xbdd1489ec69ecf53),
+  UCONST64(0x3ffee00000000000), UCONST64(0x3fe0953f39010954), UCONST64(0x3fe50913cc000000), UCONST64(0x3da686b4bcb3a5b1),
+  UCONST64(0x3fff000000000000), UCONST64(0x3fe0842108421084), UCONST64(0x3fe52a2d26600000), UCONST64(0xbdc0e9544620dd44),
+  UCONST64(0x3fff200000000000), UCONST64(0x3fe073260a47f7c6), UCONST64(0x3fe54b2467a00000), UCONST64(0xbdc9ada15baaf5d3),
+  UCONST64(0x3fff400000000000), UCONST64(0x3fe0624dd2f1a9fc), UCONST64(0x3fe56bf9d5c00000), UCONST64(0xbdd818cd7dc73bd2),
+  UCONST64(0x3fff600000000000), UCONST64(0x3fe05197f7d73404), UCONST64(0x3fe58cadb5c00000), UCONST64(0x3ddaf3126125e4bb),
+  UCONST64(0x3fff800000000000), UCONST64(0x3fe0410410410410), UCONST64(0x3fe5ad404c400000), UCONST64(0xbdd4c1a609acaab4),
+  UCONST64(0x3fffa00000000000), UCONST64(0x3fe03091b51f5e1a), UCONST64(0x3fe5cdb1dc600000), UCONST64(0x3dd82ec919edc78c),
+  UCONST64(0x3fffc00000000000), UCONST64(0x3fe0204081020408), UCONST64(0x3fe5ee02a9200000), UCONST64(0x3dc059d5c358257f),
+  UCONST64(0x3fffe00000000000), UCONST64(0x3fe0101010101010), UCONST64(0x3fe60e32f4400000), UCONST64(0x3dce236329f22568),
+  UCONST64(0x4000000000000000), UCONST64(0x3fe0000000000000), UCONST64(0x3fe62e42fee00000), UCONST64(0x3dea39ef35793c76)
+};
@@ -33,9 +33,17 @@
   static address _verify_mxcsr_entry;
   // shuffle mask for fixing up 128-bit words consisting of big-endian 32-bit integers
   static address _key_shuffle_mask_addr;
+  // byte reversal of a 128-bit big-endian AES counter block
+  static address _counter_shuffle_mask_addr;
   // masks and table for CRC32
   static uint64_t _crc_by128_masks[];
   static juint    _crc_table[];
+  // byte weights and word multipliers for Adler32
+  static jbyte    _adler32_byte_weights[];
+  static jshort   _adler32_word_ones[];
+  // constants and tables for the SSE2 exp and log stubs
+  static julong   _libm_exp_table[];
+  static julong   _libm_log_table[];
   // swap mask for ghash
   static address _ghash_long_swap_mask_addr;
   static address _ghash_byte_swap_mask_addr;
@@ -43,7 +51,12 @@
  public:
   static address verify_mxcsr_entry()    { return _verify_mxcsr_entry; }
   static address key_shuffle_mask_addr() { return _key_shuffle_mask_addr; }
+  static address counter_shuffle_mask_addr() { return _counter_shuffle_mask_addr; }
   static address crc_by128_masks_addr()  { return (address)_crc_by128_masks; }
+  static address adler32_byte_weights_addr() { return (address)_adler32_byte_weights; }
+  static address adler32_word_ones_addr()    { return (address)_adler32_word_ones; }
+  static address libm_exp_table_addr()       { return (address)_libm_exp_table; }
+  static address libm_log_table_addr()       { return (address)_libm_log_table; }
   static address ghash_long_swap_mask_addr() { return _ghash_long_swap_mask_addr; }
   static address ghash_byte_swap_mask_addr() { return _ghash_byte_swap_mask_addr; }
 
@@ -44,7 +44,22 @@
 // Platform-dependent initialization
 
 void TemplateTable::pd_initialize() {
-  // No i486 specific initialization
+  // Superinstructions, see bytecodes_x86.hpp
+  const char _    = ' ';
+  const int  ____ = 0;
+  const int  ubcp = 1 << Template::uses_bcp_bit;
+  const int  disp = 1 << Template::does_dispatch_bit;
+  const int  clvm = 1 << Template::calls_vm_bit;
+  //                                    interpr. templates
+  //                                    ubcp|disp|clvm|iswd  in    out   generator             argument
+  def(Bytecodes::_fast_iload_iadd     , ubcp|____|____|____, itos, itos, fast_iload_iadd     ,  _           );
+  def(Bytecodes::_fast_iload2_iadd    , ubcp|____|____|____, vtos, itos, fast_iload2_iadd    ,  _           );
+  def(Bytecodes::_fast_iinc           , ubcp|____|____|____, vtos, vtos, fast_iinc           ,  _           );
+  def(Bytecodes::_fast_iinc_goto      , ubcp|disp|clvm|____, vtos, vtos, fast_iinc_goto      ,  _           );
+  def(Bytecodes::_fast_aload          , ubcp|____|____|____, vtos, atos, fast_aload          ,  _           );
+  def(Bytecodes::_fast_aload_iaccess  , ubcp|____|____|____, vtos, itos, fast_aload_xaccess  ,  itos        );
+  def(Bytecodes::_fast_aload_aaccess  , ubcp|____|____|____, vtos, atos, fast_aload_xaccess  ,  atos        );
+  def(Bytecodes::_fast_aload_faccess  , ubcp|____|____|____, vtos, ftos, fast_aload_xaccess  ,  ftos        );
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -497,6 +512,17 @@ void TemplateTable::iload() {
     __ movl(rcx, Bytecodes::_fast_icaload);
     __ jccb(Assembler::equal, rewrite);
 
+    // if _iadd, rewrite to fast_iload_iadd
+    __ cmpl(rbx, Bytecodes::_iadd);
+    __ movl(rcx, Bytecodes::_fast_iload_iadd);
+    __ jccb(Assembler::equal, rewrite);
+
+    // the following iload, iadd pair has already been rewritten,
+    // rewrite the triple to fast_iload2_iadd
+    __ cmpl(rbx, Bytecodes::_fast_iload_iadd);
+    __ movl(rcx, Bytecodes::_fast_iload2_iadd);
+    __ jccb(Assembler::equal, rewrite);
+
     // rewrite so iload doesn't check again.
     __ movl(rcx, Bytecodes::_fast_iload);
 
@@ -528,6 +554,20 @@ void TemplateTable::fast_iload() {
   __ movl(rax, iaddress(rbx));
 }
 
+void TemplateTable::fast_iload_iadd() {
+  transition(itos, itos);
+  locals_index(rbx);
+  __ addl(rax, iaddress(rbx));
+}
+
+void TemplateTable::fast_iload2_iadd() {
+  transition(vtos, itos);
+  locals_index(rbx);
+  __ movl(rax, iaddress(rbx));
+  locals_index(rbx, 3);
+  __ addl(rax, iaddress(rbx));
+}
+
 
 void TemplateTable::lload() {
   transition(vtos, ltos);
@@ -552,6 +592,50 @@ void TemplateTable::dload() {
 
 
 void TemplateTable::aload() {
+  transition(vtos, atos);
+  // Pair aload with a following getfield, as aload_0 does.  The rewrite
+  // waits until the getfield has been quickened, so that the pair knows
+  // the field type.
+  if (RewriteFrequentPairs) {
+    Label rewrite, done;
+
+    // get next byte
+    __ load_unsigned_byte(rbx, at_bcp(Bytecodes::length_for(Bytecodes::_aload)));
+    // if _getfield then wait with rewrite
+    __ cmpl(rbx, Bytecodes::_getfield);
+    __ jcc(Assembler::equal, done);
+
+    // if _igetfield then rewrite to _fast_aload_iaccess
+    __ cmpl(rbx, Bytecodes::_fast_igetfield);
+    __ movl(rcx, Bytecodes::_fast_aload_iaccess);
+    __ jccb(Assembler::equal, rewrite);
+
+    // if _agetfield then rewrite to _fast_aload_aaccess
+    __ cmpl(rbx, Bytecodes::_fast_agetfield);
+    __ movl(rcx, Bytecodes::_fast_aload_aaccess);
+    __ jccb(Assembler::equal, rewrite);
+
+    // if _fgetfield then rewrite to _fast_aload_faccess
+    __ cmpl(rbx, Bytecodes::_fast_fgetfield);
+    __ movl(rcx, Bytecodes::_fast_aload_faccess);
+    __ jccb(Assembler::equal, rewrite);
+
+    // rewrite so aload doesn't check again.
+    __ movl(rcx, Bytecodes::_fast_aload);
+
+    // rewrite
+    // rcx: fast bytecode
+    __ bind(rewrite);
+    patch_bytecode(Bytecodes::_aload, rcx, rbx, false);
+    __ bind(done);
+  }
+
+  // Get the local value into tos
+  locals_index(rbx);
+  __ movptr(rax, aaddress(rbx));
+}
+
+void TemplateTable::fast_aload() {
   transition(vtos, atos);
   locals_index(rbx);
   __ movptr(rax, aaddress(rbx));
@@ -1379,6 +1463,30 @@ void TemplateTable::dneg() {
 
 
 void TemplateTable::iinc() {
+  transition(vtos, vtos);
+  if (RewriteFrequentPairs) {
+    Label rewrite;
+
+    // get next byte
+    __ load_unsigned_byte(rbx, at_bcp(Bytecodes::length_for(Bytecodes::_iinc)));
+    // if _goto, rewrite to fast_iinc_goto
+    __ cmpl(rbx, Bytecodes::_goto);
+    __ movl(rcx, Bytecodes::_fast_iinc_goto);
+    __ jccb(Assembler::equal, rewrite);
+
+    // rewrite so iinc doesn't check again.
+    __ movl(rcx, Bytecodes::_fast_iinc);
+
+    // rewrite
+    // rcx: fast bytecode
+    __ bind(rewrite);
+    patch_bytecode(Bytecodes::_iinc, rcx, rbx, false);
+  }
+  fast_iinc();
+}
+
+
+void TemplateTable::fast_iinc() {
   transition(vtos, vtos);
   __ load_signed_byte(rdx, at_bcp(2));           // get constant
   locals_index(rbx);
@@ -1386,6 +1494,15 @@ void TemplateTable::iinc() {
 }
 
 
+void TemplateTable::fast_iinc_goto() {
+  transition(vtos, vtos);
+  fast_iinc();
+  // step to the goto and take it
+  __ addptr(rsi, Bytecodes::length_for(Bytecodes::_iinc));
+  branch(false, false);
+}
+
+
 void TemplateTable::wide_iinc() {
   transition(vtos, vtos);
   __ movl(rdx, at_bcp(4));                       // get constant
@@ -2907,6 +3024,35 @@ void TemplateTable::fast_xaccess(TosState state) {
   __ decrement(rsi);
 }
 
+void TemplateTable::fast_aload_xaccess(TosState state) {
+  transition(vtos, state);
+  const int aload_length = Bytecodes::length_for(Bytecodes::_aload);
+  // get receiver
+  locals_index(rbx);
+  __ movptr(rax, aaddress(rbx));
+  // access constant pool cache of the getfield
+  __ get_cache_and_index_at_bcp(rcx, rdx, aload_length + 1);
+  __ movptr(rbx, Address(rcx,
+                         rdx,
+                         Address::times_ptr,
+                         in_bytes(ConstantPoolCache::base_offset() + ConstantPoolCacheEntry::f2_offset())));
+  // make sure exception is reported in correct bcp range (getfield is next instruction)
+  __ addptr(rsi, aload_length);
+  __ null_check(rax);
+  const Address lo = Address(rax, rbx, Address::times_1, 0*wordSize);
+  if (state == itos) {
+    __ movl(rax, lo);
+  } else if (state == atos) {
+    __ movptr(rax, lo);
+    __ verify_oop(rax);
+  } else if (state == ftos) {
+    __ fld_s(lo);
+  } else {
+    ShouldNotReachHere();
+  }
+  __ subptr(rsi, aload_length);
+}
+
 
 
 //----------------------------------------------------------------------------------------------------
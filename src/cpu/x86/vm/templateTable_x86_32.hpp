@@ -39,4 +39,12 @@
   static void index_check(Register array, Register index);
   static void index_check_without_pop(Register array, Register index);
 
+  // Superinstructions
+  static void fast_iload_iadd();
+  static void fast_iload2_iadd();
+  static void fast_iinc();
+  static void fast_iinc_goto();
+  static void fast_aload();
+  static void fast_aload_xaccess(TosState state);
+
 #endif // CPU_X86_VM_TEMPLATETABLE_X86_32_HPP
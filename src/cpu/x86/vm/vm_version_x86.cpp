@@ -585,6 +585,20 @@ void VM_Version::get_processor_features() {
     }
   }
 
+  // The counter mode stub also needs SSE4.1 to step the counter.
+#ifdef _LP64
+  if (UseAESIntrinsics && supports_sse4_1()) {
+    if (FLAG_IS_DEFAULT(UseAESCTRIntrinsics)) {
+      FLAG_SET_DEFAULT(UseAESCTRIntrinsics, true);
+    }
+  } else
+#endif
+  if (UseAESCTRIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAESCTRIntrinsics))
+      warning("AES-CTR intrinsics require AES intrinsics and SSE4.1 instructions. Intrinsics will be disabled.");
+    FLAG_SET_DEFAULT(UseAESCTRIntrinsics, false);
+  }
+
   // Use CLMUL instructions if available.
   if (supports_clmul()) {
     if (FLAG_IS_DEFAULT(UseCLMUL)) {
@@ -606,6 +620,63 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseCRC32Intrinsics, false);
   }
 
+#ifdef _LP64
+  if (supports_sse4_2() && UseCLMUL) {
+    if (FLAG_IS_DEFAULT(UseCRC32CIntrinsics)) {
+      UseCRC32CIntrinsics = true;
+    }
+  } else
+#endif
+  if (UseCRC32CIntrinsics) {
+    if (!FLAG_IS_DEFAULT(UseCRC32CIntrinsics))
+      warning("CRC32C Intrinsics require SSE4.2 and CLMUL instructions (not available on this CPU)");
+    FLAG_SET_DEFAULT(UseCRC32CIntrinsics, false);
+  }
+
+#ifdef _LP64
+  if (UseAVX > 1) {
+    if (FLAG_IS_DEFAULT(UseAdler32Intrinsics)) {
+      UseAdler32Intrinsics = true;
+    }
+  } else
+#endif
+  if (UseAdler32Intrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAdler32Intrinsics))
+      warning("Adler32 Intrinsics require AVX2 instructions (not available on this CPU)");
+    FLAG_SET_DEFAULT(UseAdler32Intrinsics, false);
+  }
+
+#ifdef _LP64
+  if (FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic)) {
+    UseVectorizedMismatchIntrinsic = true;
+  }
+#else
+  if (UseVectorizedMismatchIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseVectorizedMismatchIntrinsic))
+      warning("vectorizedMismatch intrinsic is not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseVectorizedMismatchIntrinsic, false);
+  }
+#endif
+
+#ifdef _LP64
+  if (FLAG_IS_DEFAULT(UseLibmIntrinsic)) {
+    UseLibmIntrinsic = true;
+  }
+#else
+  if (UseLibmIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseLibmIntrinsic))
+      warning("libm intrinsics are not available in 32-bit VM");
+    FLAG_SET_DEFAULT(UseLibmIntrinsic, false);
+  }
+#endif
+
+#ifndef _LP64
+  if (Tier3ProfileUpdateFreqLog != 0) {
+    warning("Tier3ProfileUpdateFreqLog is not supported in 32-bit VM");
+    FLAG_SET_DEFAULT(Tier3ProfileUpdateFreqLog, 0);
+  }
+#endif
+
   // GHASH/GCM intrinsics
   if (UseCLMUL && (UseSSE > 2)) {
     if (FLAG_IS_DEFAULT(UseGHASHIntrinsics)) {
@@ -673,6 +744,9 @@ void VM_Version::get_processor_features() {
     if (UseRTMDeopt) {
       FLAG_SET_DEFAULT(UseRTMDeopt, false);
     }
+    if (RTMLockingPerCallsite) {
+      FLAG_SET_DEFAULT(RTMLockingPerCallsite, false);
+    }
     if (PrintPreciseRTMLockingStatistics) {
       FLAG_SET_DEFAULT(PrintPreciseRTMLockingStatistics, false);
     }
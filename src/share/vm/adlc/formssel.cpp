@@ -4113,6 +4113,9 @@ bool MatchRule::is_vector() const {
     "SubVB","SubVS","SubVI","SubVL","SubVF","SubVD",
     "MulVS","MulVI","MulVF","MulVD",
     "DivVF","DivVD",
+    "AddReductionVI","AddReductionVL","AddReductionVF","AddReductionVD",
+    "MulReductionVI","MulReductionVF","MulReductionVD",
+    "MinReductionVI","MaxReductionVI",
     "AndV" ,"XorV" ,"OrV",
     "LShiftCntV","RShiftCntV",
     "LShiftVB","LShiftVS","LShiftVI","LShiftVL",
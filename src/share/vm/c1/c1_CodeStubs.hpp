@@ -115,6 +115,51 @@ public:
 
 };
 
+// Sampled branch profiling (Tier3ProfileUpdateFreqLog > 0, x86_64 only):
+// entered when the thread's sample counter ran out. The inline sample check
+// kills the condition codes, so the stub repeats the comparison of the If
+// before bumping its taken or not taken count.
+class ProfileBranchStub: public CodeStub {
+ private:
+  ciMethodData* _md;
+  int           _taken_count_offset;
+  int           _not_taken_count_offset;
+  LIR_Condition _cond;
+  LIR_Opr       _left;
+  LIR_Opr       _right;
+  LIR_Opr       _md_reg;
+  LIR_Opr       _tmp;
+
+ public:
+  ProfileBranchStub(ciMethodData* md, int taken_count_offset, int not_taken_count_offset,
+                    LIR_Condition cond, LIR_Opr left, LIR_Opr right, LIR_Opr md_reg, LIR_Opr tmp)
+    : _md(md), _taken_count_offset(taken_count_offset), _not_taken_count_offset(not_taken_count_offset)
+    , _cond(cond), _left(left), _right(right), _md_reg(md_reg), _tmp(tmp) {
+  }
+
+  ciMethodData* md() const              { return _md; }
+  int taken_count_offset() const        { return _taken_count_offset; }
+  int not_taken_count_offset() const    { return _not_taken_count_offset; }
+  LIR_Condition cond() const            { return _cond; }
+  LIR_Opr left() const                  { return _left; }
+  LIR_Opr right() const                 { return _right; }
+  LIR_Opr md_reg() const                { return _md_reg; }
+  LIR_Opr tmp() const                   { return _tmp; }
+
+  virtual void emit_code(LIR_Assembler* e);
+
+  virtual void visit(LIR_OpVisitState* visitor) {
+    visitor->do_input(_left);
+    visitor->do_input(_right);
+    visitor->do_temp(_md_reg);
+    visitor->do_temp(_tmp);
+  }
+
+#ifndef PRODUCT
+  virtual void print_name(outputStream* out) const { out->print("ProfileBranchStub"); }
+#endif // PRODUCT
+};
+
 class ConversionStub: public CodeStub {
  private:
   Bytecodes::Code _bytecode;
@@ -3668,6 +3668,30 @@ bool GraphBuilder::try_inline_intrinsics(ciMethod* callee) {
       preserves_state = true;
       break;
 
+    case vmIntrinsics::_updateBytesCRC32C:
+    case vmIntrinsics::_updateDirectByteBufferCRC32C:
+      if (!UseCRC32CIntrinsics) return false;
+      cantrap = false;
+      preserves_state = true;
+      break;
+
+    case vmIntrinsics::_updateBytesAdler32:
+    case vmIntrinsics::_updateByteBufferAdler32:
+      if (!UseAdler32Intrinsics) return false;
+      cantrap = false;
+      preserves_state = true;
+      break;
+
+    case vmIntrinsics::_equalsB:
+    case vmIntrinsics::_equalsZ:
+    case vmIntrinsics::_equalsS:
+    case vmIntrinsics::_equalsI:
+    case vmIntrinsics::_equalsJ:
+      if (!UseVectorizedMismatchIntrinsic) return false;
+      cantrap = false;
+      preserves_state = true;
+      break;
+
     case vmIntrinsics::_loadFence :
     case vmIntrinsics::_storeFence:
     case vmIntrinsics::_fullFence :
@@ -1239,6 +1239,165 @@ void LIRGenerator::do_Reference_get(Intrinsic* x) {
               NULL   /* info */);
 }
 
+// int CRC32C.updateBytes(int crc, byte[] b, int off, int end)
+// int CRC32C.updateDirectByteBuffer(int crc, long address, int off, int end)
+void LIRGenerator::do_update_CRC32C(Intrinsic* x) {
+  assert(UseCRC32CIntrinsics, "need SSE4.2 and CLMUL instructions support");
+  bool is_updateBytes = (x->id() == vmIntrinsics::_updateBytesCRC32C);
+  do_update_checksum_bytes(x, StubRoutines::updateBytesCRC32C(), is_updateBytes, true);
+}
+
+// int Adler32.updateBytes(int adler, byte[] b, int off, int len)
+// int Adler32.updateByteBuffer(int adler, long address, int off, int len)
+void LIRGenerator::do_update_Adler32(Intrinsic* x) {
+  assert(UseAdler32Intrinsics, "need AVX2 instructions support");
+  bool is_updateBytes = (x->id() == vmIntrinsics::_updateBytesAdler32);
+  do_update_checksum_bytes(x, StubRoutines::updateBytesAdler32(), is_updateBytes, false);
+}
+
+// Call a stub of the form int (int checksum, byte* buf, int len) on the
+// bytes of a byte[] or at a raw address.  The range is given either by
+// offset and length, or by offset and end index.
+void LIRGenerator::do_update_checksum_bytes(Intrinsic* x, address entry, bool is_array, bool has_end_index) {
+  // Make all state_for calls early since they can emit code
+  LIR_Opr result = rlock_result(x);
+
+  LIRItem crc(x->argument_at(0), this);
+  LIRItem buf(x->argument_at(1), this);
+  LIRItem off(x->argument_at(2), this);
+  LIRItem len(x->argument_at(3), this);
+  buf.load_item();
+  off.load_nonconstant();
+
+  LIR_Opr index = off.result();
+  int offset = is_array ? arrayOopDesc::base_offset_in_bytes(T_BYTE) : 0;
+  if (off.result()->is_constant()) {
+    index = LIR_OprFact::illegalOpr;
+    offset += off.result()->as_jint();
+  }
+  LIR_Opr base_op = buf.result();
+
+#ifndef _LP64
+  if (!is_array) { // long b raw address
+    base_op = new_register(T_INT);
+    __ convert(Bytecodes::_l2i, buf.result(), base_op);
+  }
+#else
+  if (index->is_valid()) {
+    LIR_Opr tmp = new_register(T_LONG);
+    __ convert(Bytecodes::_i2l, index, tmp);
+    index = tmp;
+  }
+#endif
+
+  LIR_Address* a = new LIR_Address(base_op,
+                                   index,
+                                   LIR_Address::times_1,
+                                   offset,
+                                   T_BYTE);
+  BasicTypeList signature(3);
+  signature.append(T_INT);
+  signature.append(T_ADDRESS);
+  signature.append(T_INT);
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  LIR_Opr addr = new_pointer_register();
+  __ leal(LIR_OprFact::address(a), addr);
+
+  crc.load_item_force(cc->at(0));
+  __ move(addr, cc->at(1));
+  if (has_end_index) {
+    // len = end - off
+    len.load_item();
+    LIR_Opr length = new_register(T_INT);
+    __ move(len.result(), length);
+    __ sub(length, off.result(), length);
+    __ move(length, cc->at(2));
+  } else {
+    len.load_item_force(cc->at(2));
+  }
+
+  __ call_runtime_leaf(entry, getThreadTemp(), result_reg, cc->args());
+  __ move(result_reg, result);
+}
+
+// boolean Arrays.equals(byte[] a, byte[] b), and likewise for boolean[],
+// short[], int[] and long[].  Identical, null and differently sized arrays
+// are decided inline, everything else by the vectorizedMismatch stub.
+// Each outcome gets its own tail so that no virtual register is live
+// across the call on the paths that branch around it.
+void LIRGenerator::do_ArraysEquals(Intrinsic* x) {
+  assert(UseVectorizedMismatchIntrinsic, "need vectorizedMismatch stub");
+  assert(x->number_of_arguments() == 2, "wrong type");
+
+  BasicType elem_type;
+  switch (x->id()) {
+  case vmIntrinsics::_equalsB: elem_type = T_BYTE;    break;
+  case vmIntrinsics::_equalsZ: elem_type = T_BOOLEAN; break;
+  case vmIntrinsics::_equalsS: elem_type = T_SHORT;   break;
+  case vmIntrinsics::_equalsI: elem_type = T_INT;     break;
+  case vmIntrinsics::_equalsJ: elem_type = T_LONG;    break;
+  default: ShouldNotReachHere(); return;
+  }
+
+  LIRItem a(x->argument_at(0), this);
+  LIRItem b(x->argument_at(1), this);
+  a.load_item();
+  b.load_item();
+  LIR_Opr result = rlock_result(x);
+
+  LabelObj* L_true  = new LabelObj();
+  LabelObj* L_false = new LabelObj();
+  LabelObj* L_done  = new LabelObj();
+
+  __ cmp(lir_cond_equal, a.result(), b.result());
+  __ branch(lir_cond_equal, T_OBJECT, L_true->label());
+  __ cmp(lir_cond_equal, a.result(), LIR_OprFact::oopConst(NULL));
+  __ branch(lir_cond_equal, T_OBJECT, L_false->label());
+  __ cmp(lir_cond_equal, b.result(), LIR_OprFact::oopConst(NULL));
+  __ branch(lir_cond_equal, T_OBJECT, L_false->label());
+
+  LIR_Opr length   = new_register(T_INT);
+  LIR_Opr length_b = new_register(T_INT);
+  __ move(new LIR_Address(a.result(), arrayOopDesc::length_offset_in_bytes(), T_INT), length);
+  __ move(new LIR_Address(b.result(), arrayOopDesc::length_offset_in_bytes(), T_INT), length_b);
+  __ cmp(lir_cond_notEqual, length, length_b);
+  __ branch(lir_cond_notEqual, T_INT, L_false->label());
+
+  int base_offset = arrayOopDesc::base_offset_in_bytes(elem_type);
+  LIR_Opr addr_a = new_pointer_register();
+  LIR_Opr addr_b = new_pointer_register();
+  __ leal(LIR_OprFact::address(new LIR_Address(a.result(), base_offset, elem_type)), addr_a);
+  __ leal(LIR_OprFact::address(new LIR_Address(b.result(), base_offset, elem_type)), addr_b);
+
+  BasicTypeList signature(4);
+  signature.append(T_ADDRESS);
+  signature.append(T_ADDRESS);
+  signature.append(T_INT);
+  signature.append(T_INT);
+  CallingConvention* cc = frame_map()->c_calling_convention(&signature);
+  const LIR_Opr result_reg = result_register_for(x->type());
+
+  __ move(addr_a, cc->at(0));
+  __ move(addr_b, cc->at(1));
+  __ move(length, cc->at(2));
+  __ move(LIR_OprFact::intConst(exact_log2(type2aelembytes(elem_type))), cc->at(3));
+  __ call_runtime_leaf(StubRoutines::vectorizedMismatch(), getThreadTemp(), result_reg, cc->args());
+  // The stub returns -1 when no element differs.
+  __ unsigned_shift_right(result_reg, 31, result);
+  __ branch(lir_cond_always, T_ILLEGAL, L_done->label());
+
+  __ branch_destination(L_false->label());
+  __ move(LIR_OprFact::intConst(0), result);
+  __ branch(lir_cond_always, T_ILLEGAL, L_done->label());
+
+  __ branch_destination(L_true->label());
+  __ move(LIR_OprFact::intConst(1), result);
+
+  __ branch_destination(L_done->label());
+}
+
 // Example: clazz.isInstance(object)
 void LIRGenerator::do_isInstance(Intrinsic* x) {
   assert(x->number_of_arguments() == 2, "wrong type");
@@ -3234,6 +3393,24 @@ void LIRGenerator::do_Intrinsic(Intrinsic* x) {
     do_update_CRC32(x);
     break;
 
+  case vmIntrinsics::_updateBytesCRC32C:
+  case vmIntrinsics::_updateDirectByteBufferCRC32C:
+    do_update_CRC32C(x);
+    break;
+
+  case vmIntrinsics::_updateBytesAdler32:
+  case vmIntrinsics::_updateByteBufferAdler32:
+    do_update_Adler32(x);
+    break;
+
+  case vmIntrinsics::_equalsB:
+  case vmIntrinsics::_equalsZ:
+  case vmIntrinsics::_equalsS:
+  case vmIntrinsics::_equalsI:
+  case vmIntrinsics::_equalsJ:
+    do_ArraysEquals(x);
+    break;
+
   default: ShouldNotReachHere(); break;
   }
 }
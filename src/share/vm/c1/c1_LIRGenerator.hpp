@@ -251,6 +251,10 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
   void do_FPIntrinsics(Intrinsic* x);
   void do_Reference_get(Intrinsic* x);
   void do_update_CRC32(Intrinsic* x);
+  void do_update_CRC32C(Intrinsic* x);
+  void do_update_Adler32(Intrinsic* x);
+  void do_update_checksum_bytes(Intrinsic* x, address entry, bool is_array, bool has_end_index);
+  void do_ArraysEquals(Intrinsic* x);
 
   void do_UnsafePrefetch(UnsafePrefetch* x, bool is_store);
 
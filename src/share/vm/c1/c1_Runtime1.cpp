@@ -301,6 +301,12 @@ const char* Runtime1::name_for_address(address entry) {
   FUNCTION_CASE(entry, JFR_TIME_FUNCTION);
 #endif
   FUNCTION_CASE(entry, StubRoutines::updateBytesCRC32());
+  FUNCTION_CASE(entry, StubRoutines::updateBytesCRC32C());
+  FUNCTION_CASE(entry, StubRoutines::updateBytesAdler32());
+  FUNCTION_CASE(entry, StubRoutines::vectorizedMismatch());
+  FUNCTION_CASE(entry, StubRoutines::dexp());
+  FUNCTION_CASE(entry, StubRoutines::dlog());
+  FUNCTION_CASE(entry, StubRoutines::dlog10());
 
 #undef FUNCTION_CASE
 
@@ -264,8 +264,9 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
  private:
   GlobalValueNumbering* _gvn;
   BlockList             _loop_blocks;
-  bool                  _too_complicated_loop;
-  bool                  _has_field_store[T_ARRAY + 1];
+  bool                  _has_memory_kill;
+  GrowableArray<ciField*> _field_stores;        // fields stored to in the loop
+  GrowableArray<ciField*> _all_offsets_stores;  // unresolved stores, kill all fields of the holder
   bool                  _has_indexed_store[T_ARRAY + 1];
 
   // simplified access to methods of GlobalValueNumbering
@@ -273,11 +274,20 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   ValueMap* value_map_of(BlockBegin* block)      { return _gvn->value_map_of(block); }
 
   // implementation for abstract methods of ValueNumberingVisitor
-  void      kill_memory()                                 { _too_complicated_loop = true; }
+  void      kill_memory()                                 {
+    // calls, monitors and volatile accesses in the loop: memory values
+    // are killed at the loop header, but invariant arithmetic can still
+    // be moved out of the loop
+    current_map()->kill_memory();
+    _has_memory_kill = true;
+  }
   void      kill_field(ciField* field, bool all_offsets)  {
     current_map()->kill_field(field, all_offsets);
-    assert(field->type()->basic_type() >= 0 && field->type()->basic_type() <= T_ARRAY, "Invalid type");
-    _has_field_store[field->type()->basic_type()] = true;
+    if (all_offsets) {
+      _all_offsets_stores.append(field);
+    } else {
+      _field_stores.append(field);
+    }
   }
   void      kill_array(ValueType* type)                   {
     current_map()->kill_array(type);
@@ -289,17 +299,32 @@ class ShortLoopOptimizer : public ValueNumberingVisitor {
   ShortLoopOptimizer(GlobalValueNumbering* gvn)
     : _gvn(gvn)
     , _loop_blocks(ValueMapMaxLoopSize)
-    , _too_complicated_loop(false)
+    , _has_memory_kill(false)
   {
     for (int i=0; i<= T_ARRAY; i++){
-      _has_field_store[i] = false;
       _has_indexed_store[i] = false;
     }
   }
 
-  bool has_field_store(BasicType type) {
-    assert(type >= 0 && type <= T_ARRAY, "Invalid type");
-    return _has_field_store[type];
+  bool has_memory_kill() {
+    return _has_memory_kill;
+  }
+
+  // Fields are aliased the same way ValueMap::kill_field kills them:
+  // by holder and offset, or by holder alone for unresolved stores.
+  bool has_field_store(ciField* field) {
+    for (int i = 0; i < _field_stores.length(); i++) {
+      ciField* f = _field_stores.at(i);
+      if (f->holder() == field->holder() && f->offset() == field->offset()) {
+        return true;
+      }
+    }
+    for (int i = 0; i < _all_offsets_stores.length(); i++) {
+      if (_all_offsets_stores.at(i)->holder() == field->holder()) {
+        return true;
+      }
+    }
+    return false;
   }
 
   bool has_indexed_store(BasicType type) {
@@ -378,16 +403,22 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
       assert(cur->as_Op2() != NULL, "must be Op2");
       Op2* op2 = (Op2*)cur;
       cur_invariant = !op2->can_trap() && is_invariant(op2->x()) && is_invariant(op2->y());
+    } else if (cur->as_NegateOp() != NULL) {
+      NegateOp* neg = cur->as_NegateOp();
+      cur_invariant = is_invariant(neg->x());
+    } else if (cur->as_Convert() != NULL) {
+      Convert* conv = cur->as_Convert();
+      cur_invariant = !conv->can_trap() && is_invariant(conv->value());
     } else if (cur->as_LoadField() != NULL) {
       LoadField* lf = (LoadField*)cur;
       // deoptimizes on NullPointerException
-      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()->type()->basic_type()) && is_invariant(lf->obj()) && _insert_is_pred;
+      cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_memory_kill() && !_short_loop_optimizer->has_field_store(lf->field()) && is_invariant(lf->obj()) && _insert_is_pred;
     } else if (cur->as_ArrayLength() != NULL) {
       ArrayLength *length = cur->as_ArrayLength();
       cur_invariant = is_invariant(length->array());
     } else if (cur->as_LoadIndexed() != NULL) {
       LoadIndexed *li = (LoadIndexed *)cur->as_LoadIndexed();
-      cur_invariant = !_short_loop_optimizer->has_indexed_store(as_BasicType(cur->type())) && is_invariant(li->array()) && is_invariant(li->index()) && _insert_is_pred;
+      cur_invariant = !_short_loop_optimizer->has_memory_kill() && !_short_loop_optimizer->has_indexed_store(as_BasicType(cur->type())) && is_invariant(li->array()) && is_invariant(li->index()) && _insert_is_pred;
     }
 
     if (cur_invariant) {
@@ -432,7 +463,12 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
 bool ShortLoopOptimizer::process(BlockBegin* loop_header) {
   TRACE_VALUE_NUMBERING(tty->print_cr("** loop header block"));
 
-  _too_complicated_loop = false;
+  _has_memory_kill = false;
+  _field_stores.clear();
+  _all_offsets_stores.clear();
+  for (int i = 0; i <= T_ARRAY; i++) {
+    _has_indexed_store[i] = false;
+  }
   _loop_blocks.clear();
   _loop_blocks.append(loop_header);
 
@@ -467,9 +503,6 @@ bool ShortLoopOptimizer::process(BlockBegin* loop_header) {
     // use the instruction visitor for killing values
     for (Value instr = block->next(); instr != NULL; instr = instr->next()) {
       instr->visit(this);
-      if (_too_complicated_loop) {
-        return false;
-      }
     }
   }
 
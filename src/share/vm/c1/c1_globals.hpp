@@ -149,7 +149,7 @@
   product(intx, ValueMapInitialSize, 11,                                    \
           "Initial size of a value map")                                    \
                                                                             \
-  product(intx, ValueMapMaxLoopSize, 8,                                     \
+  product(intx, ValueMapMaxLoopSize, 16,                                    \
           "maximum size of a loop optimized by global value numbering")     \
                                                                             \
   develop(bool, EliminateBlocks, true,                                      \
@@ -523,9 +523,10 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
         // or < 0 in the case of a type check failured for checkcast, aastore, instanceof.
         // The call site count is > 0 in the case of a polymorphic virtual call.
         if (morphism > 0 && morphism == result._limit) {
-           // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           // The morphism <= MorphismLimit.  A non-zero count means some
+           // receivers did not get a row, so all receivers are known only
+           // if the count is zero (a monomorphic site is trusted as before).
+           if (morphism == 1 || count == 0) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
@@ -282,6 +282,7 @@
   template(java_lang_invoke_MemberName,               "java/lang/invoke/MemberName")              \
   template(java_lang_invoke_MethodHandleNatives,      "java/lang/invoke/MethodHandleNatives")     \
   template(java_lang_invoke_LambdaForm,               "java/lang/invoke/LambdaForm")              \
+  template(java_lang_invoke_LambdaMetafactory,        "java/lang/invoke/LambdaMetafactory")       \
   template(java_lang_invoke_ForceInline_signature,    "Ljava/lang/invoke/ForceInline;")           \
   template(java_lang_invoke_DontInline_signature,     "Ljava/lang/invoke/DontInline;")            \
   template(java_lang_invoke_InjectedProfile_signature, "Ljava/lang/invoke/InjectedProfile;")      \
@@ -300,6 +301,8 @@
   template(setTargetNormal_name,                      "setTargetNormal")                          \
   template(setTargetVolatile_name,                    "setTargetVolatile")                        \
   template(setTarget_signature,                       "(Ljava/lang/invoke/MethodHandle;)V")       \
+  template(metafactory_name,                          "metafactory")                              \
+  template(altMetafactory_name,                       "altMetafactory")                           \
   NOT_LP64(  do_alias(intptr_signature,               int_signature)  )                           \
   LP64_ONLY( do_alias(intptr_signature,               long_signature) )                           \
                                                                                                   \
@@ -789,6 +792,16 @@
                                                                                                                         \
   do_intrinsic(_equalsC,                  java_util_Arrays,       equals_name,    equalsC_signature,             F_S)   \
    do_signature(equalsC_signature,                               "([C[C)Z")                                             \
+  do_intrinsic(_equalsB,                  java_util_Arrays,       equals_name,    equalsB_signature,             F_S)   \
+   do_signature(equalsB_signature,                               "([B[B)Z")                                             \
+  do_intrinsic(_equalsZ,                  java_util_Arrays,       equals_name,    equalsZ_signature,             F_S)   \
+   do_signature(equalsZ_signature,                               "([Z[Z)Z")                                             \
+  do_intrinsic(_equalsS,                  java_util_Arrays,       equals_name,    equalsS_signature,             F_S)   \
+   do_signature(equalsS_signature,                               "([S[S)Z")                                             \
+  do_intrinsic(_equalsI,                  java_util_Arrays,       equals_name,    equalsI_signature,             F_S)   \
+   do_signature(equalsI_signature,                               "([I[I)Z")                                             \
+  do_intrinsic(_equalsJ,                  java_util_Arrays,       equals_name,    equalsJ_signature,             F_S)   \
+   do_signature(equalsJ_signature,                               "([J[J)Z")                                             \
                                                                                                                         \
   do_intrinsic(_compareTo,                java_lang_String,       compareTo_name, string_int_signature,          F_R)   \
    do_name(     compareTo_name,                                  "compareTo")                                           \
@@ -844,6 +857,10 @@
    do_name(     decrypt_name,                                      "implDecrypt")                                       \
    do_signature(byteArray_int_int_byteArray_int_signature,         "([BII[BI)I")                                        \
                                                                                                                         \
+  do_class(com_sun_crypto_provider_counterMode,                    "com/sun/crypto/provider/CounterMode")               \
+   do_intrinsic(_counterMode_AESCrypt, com_sun_crypto_provider_counterMode, crypt_name, byteArray_int_int_byteArray_int_signature, F_R)   \
+   do_name(     crypt_name,                                        "implCrypt")                                         \
+                                                                                                                        \
   /* support for sun.security.provider.SHA */                                                                           \
   do_class(sun_security_provider_sha,                              "sun/security/provider/SHA")                         \
   do_intrinsic(_sha_implCompress, sun_security_provider_sha, implCompress_name, implCompress_signature, F_R)            \
@@ -881,6 +898,17 @@
    do_name(     updateByteBuffer_name,                           "updateByteBuffer")                                    \
    do_signature(updateByteBuffer_signature,                      "(IJII)I")                                             \
                                                                                                                         \
+  /* support for java.util.zip.CRC32C, whose Java methods take an end index instead of a length */                   \
+  do_class(java_util_zip_CRC32C,          "java/util/zip/CRC32C")                                                       \
+  do_intrinsic(_updateBytesCRC32C,         java_util_zip_CRC32C,  updateBytes_name, updateBytes_signature,       F_S)   \
+  do_intrinsic(_updateDirectByteBufferCRC32C, java_util_zip_CRC32C, updateDirectByteBuffer_name, updateByteBuffer_signature, F_S) \
+   do_name(     updateDirectByteBuffer_name,                     "updateDirectByteBuffer")                              \
+                                                                                                                        \
+  /* support for java.util.zip.Adler32 */                                                                               \
+  do_class(java_util_zip_Adler32,         "java/util/zip/Adler32")                                                      \
+  do_intrinsic(_updateBytesAdler32,        java_util_zip_Adler32, updateBytes_name, updateBytes_signature,       F_SN)  \
+  do_intrinsic(_updateByteBufferAdler32,   java_util_zip_Adler32, updateByteBuffer_name, updateByteBuffer_signature, F_SN) \
+                                                                                                                        \
   /* support for sun.misc.Unsafe */                                                                                     \
   do_class(sun_misc_Unsafe,               "sun/misc/Unsafe")                                                            \
                                                                                                                         \
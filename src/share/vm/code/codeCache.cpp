@@ -211,6 +211,19 @@ CodeBlob* CodeCache::allocate(int size, bool is_critical) {
   return cb;
 }
 
+CodeBlob* CodeCache::allocate_below(int size, address limit) {
+  guarantee(size >= 0, "allocation request must be reasonable");
+  assert_locked_or_safepoint(CodeCache_lock);
+  // Never expands the code cache; the block is taken from the free list only.
+  CodeBlob* cb = (CodeBlob*)_heap->allocate_below(size, limit);
+  if (cb != NULL) {
+    _number_of_blobs++;
+    verify_if_often();
+    print_trace("allocation", cb, size);
+  }
+  return cb;
+}
+
 void CodeCache::free(CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
   verify_if_often();
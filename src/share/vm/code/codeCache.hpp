@@ -78,6 +78,7 @@ class CodeCache : AllStatic {
 
   // Allocation/administration
   static CodeBlob* allocate(int size, bool is_critical = false); // allocates a new CodeBlob
+  static CodeBlob* allocate_below(int size, address limit); // allocates a CodeBlob from a free block below limit, used for compaction
   static void commit(CodeBlob* cb);                 // called when the allocated CodeBlob has been filled
   static int alignment_unit();                      // guaranteed alignment of all CodeBlobs
   static int alignment_offset();                    // guaranteed offset of first CodeBlob byte within alignment unit (i.e., allocation header)
@@ -170,6 +171,8 @@ class CodeCache : AllStatic {
   static size_t  capacity()                      { return _heap->capacity(); }
   static size_t  max_capacity()                  { return _heap->max_capacity(); }
   static size_t  unallocated_capacity()          { return _heap->unallocated_capacity(); }
+  static size_t  freelist_capacity()             { return _heap->freelist_capacity(); }
+  static size_t  largest_free_block()            { return _heap->largest_free_block(); }
   static double  reverse_free_ratio();
 
   static bool needs_cache_clean()                { return _needs_cache_clean; }
@@ -214,3 +214,12 @@ void CollectionSetChooser::clear() {
   _length = 0;
   _remaining_reclaimable_bytes = 0;
 };
+
+void CollectionSetChooser::iterate(HeapRegionClosure* cl) {
+  for (uint i = _curr_index; i < _length; i++) {
+    HeapRegion* r = regions_at(i);
+    if (cl->doHeapRegion(r)) {
+      break;
+    }
+  }
+}
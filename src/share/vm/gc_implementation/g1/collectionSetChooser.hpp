@@ -26,6 +26,7 @@
 #define SHARE_VM_GC_IMPLEMENTATION_G1_COLLECTIONSETCHOOSER_HPP
 
 #include "gc_implementation/g1/heapRegion.hpp"
+#include "gc_implementation/g1/heapRegionRemSet.hpp"
 #include "utilities/growableArray.hpp"
 
 class CollectionSetChooser: public CHeapObj<mtGC> {
@@ -82,6 +83,20 @@ public:
     return res;
   }
 
+  // Return the candidate region the given number of positions after
+  // the current one, or NULL if there are not that many candidates
+  // left. Does not remove the region from the CSet chooser.
+  HeapRegion* peek_at(uint offset) {
+    HeapRegion* res = NULL;
+    if (_curr_index + offset < _length) {
+      res = regions_at(_curr_index + offset);
+      assert(res != NULL,
+             err_msg("Unexpected NULL hr in _regions at index %u",
+                     _curr_index + offset));
+    }
+    return res;
+  }
+
   // Remove the given region from the CSet chooser and move to the
   // next one. The given region should be the current candidate region
   // in the CSet chooser.
@@ -104,13 +119,15 @@ public:
 
   // Determine whether to add the given region to the CSet chooser or
   // not. Currently, we skip humongous regions (we never add them to
-  // the CSet, we only reclaim them during cleanup) and regions whose
-  // live bytes are over the threshold.
+  // the CSet, we only reclaim them during cleanup), regions whose
+  // live bytes are over the threshold and regions without a complete
+  // remembered set.
   bool should_add(HeapRegion* hr) {
     assert(hr->is_marked(), "pre-condition");
     assert(!hr->is_young(), "should never consider young regions");
     return !hr->isHumongous() &&
-            hr->live_bytes() < _region_live_threshold_bytes;
+            hr->live_bytes() < _region_live_threshold_bytes &&
+            hr->rem_set()->is_complete();
   }
 
   // Returns the number candidate old regions added
@@ -135,6 +152,9 @@ public:
 
   void clear();
 
+  // Apply the closure to the candidate regions that remain to be collected.
+  void iterate(HeapRegionClosure* cl);
+
   // Return the number of candidate regions that remain to be collected.
   uint remaining_regions() { return _length - _curr_index; }
 
@@ -570,6 +570,8 @@ ConcurrentMark::ConcurrentMark(G1CollectedHeap* g1h, G1RegionToSpaceMapper* prev
 
   _count_card_bitmaps(NULL),
   _count_marked_bytes(NULL),
+  _top_at_rebuild_starts(NULL),
+  _num_regions_selected_for_rebuild(0),
   _completed_initialization(false) {
   CMVerboseLevel verbose_level = (CMVerboseLevel) G1MarkingVerboseLevel;
   if (verbose_level < no_verbose) {
@@ -731,6 +733,11 @@ ConcurrentMark::ConcurrentMark(G1CollectedHeap* g1h, G1RegionToSpaceMapper* prev
   _active_tasks = _max_worker_id;
 
   size_t max_regions = (size_t) _g1h->max_regions();
+  _top_at_rebuild_starts = NEW_C_HEAP_ARRAY(HeapWord*, max_regions, mtGC);
+  for (size_t i = 0; i < max_regions; i++) {
+    _top_at_rebuild_starts[i] = NULL;
+  }
+
   for (uint i = 0; i < _max_worker_id; ++i) {
     CMTaskQueue* task_queue = new CMTaskQueue();
     task_queue->initialize();
@@ -1347,6 +1354,8 @@ void ConcurrentMark::checkpointRootsFinal(bool clear_all_soft_refs) {
     // while marking.
     aggregate_count_data();
 
+    update_remset_tracking_before_rebuild();
+
     SATBMarkQueueSet& satb_mq_set = JavaThread::satb_mark_queue_set();
     // We're done with marking.
     // This is the end of  the marking cycle, we're expected all
@@ -1383,6 +1392,69 @@ void ConcurrentMark::checkpointRootsFinal(bool clear_all_soft_refs) {
   g1h->gc_tracer_cm()->report_object_count_after_gc(&is_alive);
 }
 
+class G1UpdateRemSetTrackingBeforeRebuild : public HeapRegionClosure {
+  ConcurrentMark* _cm;
+  G1RemSetTrackingPolicy* _tracker;
+  HeapWord** _top_at_rebuild_starts;
+  uint _num_regions_selected_for_rebuild;
+
+public:
+  G1UpdateRemSetTrackingBeforeRebuild(ConcurrentMark* cm,
+                                      G1RemSetTrackingPolicy* tracker,
+                                      HeapWord** top_at_rebuild_starts) :
+    _cm(cm), _tracker(tracker), _top_at_rebuild_starts(top_at_rebuild_starts),
+    _num_regions_selected_for_rebuild(0) { }
+
+  bool doHeapRegion(HeapRegion* r) {
+    if (_tracker->update_before_rebuild(r, r->next_live_bytes())) {
+      _num_regions_selected_for_rebuild++;
+    }
+    // Humongous objects are scanned from their start region.
+    bool needs_scan = _tracker->needs_scan_for_rebuild(r) && !r->continuesHumongous();
+    _top_at_rebuild_starts[r->hrm_index()] = needs_scan ? r->top() : NULL;
+    return false;
+  }
+
+  uint num_selected_for_rebuild() const { return _num_regions_selected_for_rebuild; }
+};
+
+void ConcurrentMark::update_remset_tracking_before_rebuild() {
+  G1UpdateRemSetTrackingBeforeRebuild cl(this,
+                                         _g1h->g1_policy()->remset_tracker(),
+                                         _top_at_rebuild_starts);
+  _g1h->heap_region_iterate(&cl);
+  _num_regions_selected_for_rebuild = cl.num_selected_for_rebuild();
+}
+
+HeapWord* ConcurrentMark::top_at_rebuild_start(uint region) const {
+  assert(region < _g1h->max_regions(), err_msg("Tried to access TARS for region %u out of bounds", region));
+  return _top_at_rebuild_starts[region];
+}
+
+void ConcurrentMark::humongous_object_eagerly_reclaimed(HeapRegion* r) {
+  assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
+  _top_at_rebuild_starts[r->hrm_index()] = NULL;
+}
+
+void ConcurrentMark::reset_top_at_rebuild_starts() {
+  for (uint i = 0; i < _g1h->max_regions(); i++) {
+    _top_at_rebuild_starts[i] = NULL;
+  }
+  _num_regions_selected_for_rebuild = 0;
+}
+
+void ConcurrentMark::rebuild_rem_set_concurrently() {
+  if (_num_regions_selected_for_rebuild == 0) {
+    // Nothing to do; remembered sets of all other regions are either
+    // complete or not tracked at all.
+    return;
+  }
+
+  uint active_workers = MAX2(1U, calc_parallel_marking_threads());
+  FlexibleWorkGang* workers = use_parallel_marking_threads() ? _parallel_workers : NULL;
+  _g1h->g1_rem_set()->rebuild_rem_set(this, workers, active_workers);
+}
+
 // Base class of the closures that finalize and verify the
 // liveness counting data.
 class CMCountDataClosureBase: public HeapRegionClosure {
@@ -1886,6 +1958,7 @@ public:
         _g1->free_region(hr, _local_cleanup_list, true);
       }
     } else {
+      _g1->g1_policy()->remset_tracker()->update_after_rebuild(hr);
       hr->rem_set()->do_cleanup_work(_hrrs_cleanup_task);
     }
 
@@ -2019,6 +2092,9 @@ void ConcurrentMark::cleanup() {
 
   HeapRegionRemSet::reset_for_cleanup_tasks();
 
+  // The remembered set rebuild is over.
+  reset_top_at_rebuild_starts();
+
   uint n_workers;
 
   // Do counting once more with the world stopped for good measure.
@@ -3393,6 +3469,9 @@ void ConcurrentMark::abort() {
 
   // Clear the liveness counting data
   clear_all_count_data();
+  // The full collection dropped or completed all remembered sets
+  // that were being rebuilt.
+  reset_top_at_rebuild_starts();
   // Empty mark stack
   reset_marking_state();
   for (uint i = 0; i < _max_worker_id; ++i) {
@@ -622,6 +622,19 @@ protected:
   // the card bitmaps.
   intptr_t _heap_bottom_card_num;
 
+  // Top pointer for each region at the start of the concurrent remembered
+  // set rebuild; objects above it have their references recorded by the
+  // regular mechanisms. NULL for regions that do not need to be scanned.
+  HeapWord** _top_at_rebuild_starts;
+
+  // Number of regions selected for remembered set rebuild at the last remark.
+  uint _num_regions_selected_for_rebuild;
+
+  // Select the regions whose remembered sets are to be rebuilt and
+  // record the rebuild limits of all regions. Called at remark.
+  void update_remset_tracking_before_rebuild();
+  void reset_top_at_rebuild_starts();
+
   // Set to true when initialization is complete
   bool _completed_initialization;
 
@@ -770,6 +783,17 @@ public:
 
   void checkpointRootsFinal(bool clear_all_soft_refs);
   void checkpointRootsFinalWork();
+
+  // Scan the regions that need it for references into the regions
+  // selected for remembered set rebuild at remark.
+  void rebuild_rem_set_concurrently();
+
+  HeapWord* top_at_rebuild_start(uint region) const;
+
+  // Eager reclaim of a humongous object during the rebuild; make sure
+  // the rebuild does not look at the region again.
+  void humongous_object_eagerly_reclaimed(HeapRegion* r);
+
   void cleanup();
   void completeCleanup();
 
@@ -807,7 +831,7 @@ public:
     return _prevMarkBitMap->isMarked(addr);
   }
 
-  inline bool do_yield_check(uint worker_i = 0);
+  bool do_yield_check(uint worker_i = 0);
 
   // Called to abort the marking cycle after a Full GC takes palce.
   void abort();
@@ -169,6 +169,22 @@ void ConcurrentMarkThread::run() {
         }
       } while (cm()->restart_for_overflow());
 
+      if (!cm()->has_aborted()) {
+        double rebuild_start_sec = os::elapsedTime();
+        if (G1Log::fine()) {
+          gclog_or_tty->gclog_stamp(cm()->concurrent_gc_id());
+          gclog_or_tty->print_cr("[GC concurrent-rebuild-remembered-sets-start]");
+        }
+
+        _cm->rebuild_rem_set_concurrently();
+
+        if (G1Log::fine()) {
+          gclog_or_tty->gclog_stamp(cm()->concurrent_gc_id());
+          gclog_or_tty->print_cr("[GC concurrent-rebuild-remembered-sets-end, %1.7lf secs]",
+                                 os::elapsedTime() - rebuild_start_sec);
+        }
+      }
+
       double end_time = os::elapsedVTime();
       // Update the total virtual time before doing this, since it will try
       // to measure it to get the vtime for this marking.  We purposely
@@ -47,15 +47,18 @@ void G1Allocator::reuse_retained_old_region(EvacuationInfo& evacuation_info,
 
   // We will discard the current GC alloc region if:
   // a) it's in the collection set (it can happen!),
-  // b) it's already full (no point in using it),
-  // c) it's empty (this means that it was emptied during
+  // b) it's an optional collection set region, which may still
+  // be added to the collection set during this pause,
+  // c) it's already full (no point in using it),
+  // d) it's empty (this means that it was emptied during
   // a cleanup and it should be on the free list now), or
-  // d) it's humongous (this means that it was emptied
+  // e) it's humongous (this means that it was emptied
   // during a cleanup and was added to the free list, but
   // has been subsequently used to allocate a humongous
   // object that may be less than the region size).
   if (retained_region != NULL &&
       !retained_region->in_collection_set() &&
+      !_g1h->is_optional_cset_region(retained_region) &&
       !(retained_region->top() == retained_region->end()) &&
       !retained_region->is_empty() &&
       !retained_region->isHumongous()) {
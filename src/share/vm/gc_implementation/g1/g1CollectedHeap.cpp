@@ -63,6 +63,7 @@
 #include "oops/oop.pcgc.inline.hpp"
 #include "runtime/orderAccess.inline.hpp"
 #include "runtime/vmThread.hpp"
+#include "utilities/quickSort.hpp"
 
 size_t G1CollectedHeap::_humongous_object_threshold_in_words = 0;
 
@@ -653,6 +654,7 @@ G1CollectedHeap::humongous_obj_allocate_initialize_regions(uint first,
   // first region.
   first_hr->set_startsHumongous(new_top, new_end);
   first_hr->set_allocation_context(context);
+  g1_policy()->remset_tracker()->update_at_allocate(first_hr);
   // Then, if there are any, we will set up the "continues
   // humongous" regions.
   HeapRegion* hr = NULL;
@@ -660,6 +662,7 @@ G1CollectedHeap::humongous_obj_allocate_initialize_regions(uint first,
     hr = region_at(i);
     hr->set_continuesHumongous(first_hr);
     hr->set_allocation_context(context);
+    g1_policy()->remset_tracker()->update_at_allocate(hr);
   }
   // If we have "continues humongous" regions (hr != NULL), then the
   // end of the last one should match new_end.
@@ -808,6 +811,8 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size, AllocationCo
                                                        word_size, context);
     assert(result != NULL, "it should always return a valid result");
 
+    g1_policy()->add_bytes_allocated_in_old_since_last_gc((size_t) obj_regions * HeapRegion::GrainBytes);
+
     // A successful humongous object allocation changes the used space
     // information of the old generation so we need to recalculate the
     // sizes and update the jstat counters here.
@@ -1161,6 +1166,13 @@ public:
 
     _g1h->reset_gc_time_stamps(r);
     hrrs->clear();
+    // Set up the remembered set tracking state before the remembered
+    // sets are recreated after compaction.
+    if (r->is_free()) {
+      hrrs->set_state_empty();
+    } else {
+      _g1h->g1_policy()->remset_tracker()->update_at_allocate(r);
+    }
     // You might think here that we could clear just the cards
     // corresponding to the used region.  But no: if we leave a dirty card
     // in a region we might allocate into, then it would prevent that card
@@ -1888,12 +1900,16 @@ G1CollectedHeap::G1CollectedHeap(G1CollectorPolicy* policy_) :
   _worker_cset_start_region = NEW_C_HEAP_ARRAY(HeapRegion*, n_queues, mtGC);
   _worker_cset_start_region_time_stamp = NEW_C_HEAP_ARRAY(uint, n_queues, mtGC);
   _evacuation_failed_info_array = NEW_C_HEAP_ARRAY(EvacuationFailedInfo, n_queues, mtGC);
+  _optional_refs = NEW_C_HEAP_ARRAY(GrowableArray<StarTask>*, n_queues, mtGC);
+  _optional_refs_to_scan = NEW_C_HEAP_ARRAY(GrowableArray<StarTask>*, n_queues, mtGC);
 
   for (int i = 0; i < n_queues; i++) {
     RefToScanQueue* q = new RefToScanQueue();
     q->initialize();
     _task_queues->register_queue(i, q);
     ::new (&_evacuation_failed_info_array[i]) EvacuationFailedInfo();
+    _optional_refs[i] = new (ResourceObj::C_HEAP, mtGC) GrowableArray<StarTask>(16, true, mtGC);
+    _optional_refs_to_scan[i] = new (ResourceObj::C_HEAP, mtGC) GrowableArray<StarTask>(16, true, mtGC);
   }
   clear_cset_start_regions();
 
@@ -4580,6 +4596,8 @@ void G1ParCopyClosure<barrier, do_mark_object>::do_oop_work(T* p) {
   } else {
     if (state.is_humongous()) {
       _g1->set_humongous_is_live(obj);
+    } else if (state.is_optional()) {
+      _par_scan_state->remember_reference_into_optional_region(p);
     }
     // The object is not in collection set. If we're a root scanning
     // closure during an initial mark pause then attempt to mark the object.
@@ -4831,6 +4849,86 @@ public:
   }
 };
 
+// Evacuates the optional regions just added to the collection set: the
+// references into them recorded during the previous evacuation round and
+// their remembered sets form the roots of the evacuation.
+class G1ParOptionalEvacTask : public AbstractGangTask {
+  G1CollectedHeap*       _g1h;
+  RefToScanQueueSet*     _queues;
+  G1RootProcessor*       _root_processor;
+  HeapRegion* const*     _regions;
+  uint                   _num_regions;
+  bool                   _first_round;
+  ParallelTaskTerminator _terminator;
+  uint                   _n_workers;
+
+  void record_time_secs(G1GCPhaseTimes::GCParPhases phase, uint worker_id, double secs) {
+    G1GCPhaseTimes* phase_times = _g1h->g1_policy()->phase_times();
+    if (_first_round) {
+      phase_times->record_time_secs(phase, worker_id, secs);
+    } else {
+      phase_times->add_time_secs(phase, worker_id, secs);
+    }
+  }
+
+public:
+  G1ParOptionalEvacTask(G1CollectedHeap* g1h, RefToScanQueueSet* task_queues,
+                        G1RootProcessor* root_processor,
+                        HeapRegion* const* regions, uint num_regions,
+                        bool first_round)
+    : AbstractGangTask("G1 optional collection"),
+      _g1h(g1h),
+      _queues(task_queues),
+      _root_processor(root_processor),
+      _regions(regions),
+      _num_regions(num_regions),
+      _first_round(first_round),
+      _terminator(0, _queues)
+  {}
+
+  virtual void set_for_termination(int active_workers) {
+    _root_processor->set_num_workers(active_workers);
+    _terminator.reset_for_reuse(active_workers);
+    _n_workers = active_workers;
+  }
+
+  void work(uint worker_id) {
+    if (worker_id >= _n_workers) return;  // no work needed this round
+
+    ResourceMark rm;
+    HandleMark   hm;
+
+    ReferenceProcessor*             rp = _g1h->ref_processor_stw();
+
+    G1ParScanThreadState            pss(_g1h, worker_id, rp);
+    G1ParScanHeapEvacFailureClosure evac_failure_cl(_g1h, &pss, rp);
+
+    pss.set_evac_failure_closure(&evac_failure_cl);
+
+    G1ParCopyClosure<G1BarrierNone, G1MarkNone> scan_only_root_cl(_g1h, &pss, rp);
+
+    double start = os::elapsedTime();
+    _g1h->scan_optional_refs(&pss, &scan_only_root_cl, worker_id);
+
+    G1ParPushHeapRSClosure push_heap_rs_cl(_g1h, &pss);
+    _root_processor->scan_optional_remembered_sets(&push_heap_rs_cl,
+                                                   &scan_only_root_cl,
+                                                   _regions, _num_regions,
+                                                   worker_id);
+    double scan_rs_end = os::elapsedTime();
+    record_time_secs(G1GCPhaseTimes::OptScanRS, worker_id, scan_rs_end - start);
+
+    G1ParEvacuateFollowersClosure evac(_g1h, &pss, _queues, &_terminator);
+    evac.do_void();
+    double elapsed_sec = os::elapsedTime() - scan_rs_end;
+    double term_sec = pss.term_time();
+    record_time_secs(G1GCPhaseTimes::OptObjCopy, worker_id, elapsed_sec - term_sec);
+    record_time_secs(G1GCPhaseTimes::OptTermination, worker_id, term_sec);
+
+    assert(pss.queue_is_empty(), "should be empty");
+  }
+};
+
 class G1StringSymbolTableUnlinkTask : public AbstractGangTask {
 private:
   BoolObjectClosure* _is_alive;
@@ -5848,6 +5946,10 @@ void G1CollectedHeap::evacuate_collection_set(EvacuationInfo& evacuation_info) {
         (os::elapsedTime() - end_par_time_sec) * 1000.0;
   phase_times->record_code_root_fixup_time(code_root_fixup_time_ms);
 
+  if (g1_policy()->has_optional_regions()) {
+    evacuate_optional_collection_set(evacuation_info);
+  }
+
   set_par_threads(0);
 
   // Process any discovered reference objects - we have
@@ -5908,6 +6010,91 @@ void G1CollectedHeap::evacuate_collection_set(EvacuationInfo& evacuation_info) {
   COMPILER2_PRESENT(DerivedPointerTable::update_pointers());
 }
 
+void G1CollectedHeap::evacuate_optional_collection_set(EvacuationInfo& evacuation_info) {
+  G1CollectorPolicy* policy = g1_policy();
+  G1GCPhaseTimes* phase_times = policy->phase_times();
+  double start_sec = os::elapsedTime();
+
+  ResourceMark rm;
+  GrowableArray<HeapRegion*> regions;
+  uint total_regions = 0;
+  bool first_round = true;
+
+  while (!evacuation_failed() && policy->has_optional_regions()) {
+    double time_remaining_ms = policy->optional_evacuation_time_remaining_ms();
+    regions.clear();
+    uint num_regions = policy->add_optional_regions_to_cset(time_remaining_ms, &regions);
+    if (num_regions == 0) {
+      break;
+    }
+    total_regions += num_regions;
+
+    // The references recorded during the previous round are the roots
+    // of this one; the references found into the remaining optional
+    // regions are recorded afresh.
+    GrowableArray<StarTask>** tmp = _optional_refs;
+    _optional_refs = _optional_refs_to_scan;
+    _optional_refs_to_scan = tmp;
+
+    if (first_round) {
+      phase_times->note_optional_evacuation_start();
+    }
+
+    {
+      G1RootProcessor root_processor(this);
+      G1ParOptionalEvacTask task(this, _task_queues, &root_processor,
+                                 regions.adr_at(0), num_regions, first_round);
+      if (G1CollectedHeap::use_parallel_gc_threads()) {
+        workers()->run_task(&task);
+      } else {
+        task.set_for_termination(n_par_threads());
+        task.work(0);
+      }
+    }
+    first_round = false;
+  }
+
+  policy->abandon_optional_regions();
+  clear_optional_refs();
+
+  phase_times->record_optional_evacuation((os::elapsedTime() - start_sec) * 1000.0, total_regions);
+  evacuation_info.set_collectionset_regions(policy->cset_region_length());
+}
+
+void G1CollectedHeap::scan_optional_refs(G1ParScanThreadState* pss, OopClosure* root_cl, uint worker_id) {
+  GrowableArray<StarTask>* refs = _optional_refs_to_scan[worker_id];
+  for (int i = 0; i < refs->length(); i++) {
+    StarTask ref = refs->at(i);
+    // References from the heap go through the task queue so that the
+    // remembered set of the referencing region is updated after the
+    // copy; the others are roots.
+    if (ref.is_narrow()) {
+      narrowOop* p = (narrowOop*) ref;
+      if (is_in_reserved(p)) {
+        pss->push_on_queue(p);
+      } else {
+        root_cl->do_oop(p);
+      }
+    } else {
+      oop* p = (oop*) ref;
+      if (is_in_reserved(p)) {
+        pss->push_on_queue(p);
+      } else {
+        root_cl->do_oop(p);
+      }
+    }
+  }
+  refs->clear();
+}
+
+void G1CollectedHeap::clear_optional_refs() {
+  int n_queues = MAX2((int)ParallelGCThreads, 1);
+  for (int i = 0; i < n_queues; i++) {
+    _optional_refs[i]->clear();
+    _optional_refs_to_scan[i]->clear();
+  }
+}
+
 void G1CollectedHeap::free_region(HeapRegion* hr,
                                   FreeRegionList* free_list,
                                   bool par,
@@ -5977,28 +6164,83 @@ void G1CollectedHeap::decrement_summary_bytes(size_t bytes) {
   _allocator->decrease_used(bytes);
 }
 
+// Clears the card table of the regions on the dirty cards region list.
+// The card ranges of these regions are concatenated in region (and so
+// card) order and split into fixed size chunks claimed by the workers,
+// independent of the number and size of the regions.
 class G1ParCleanupCTTask : public AbstractGangTask {
+  static const size_t ChunkSizeInCards = 16 * K;
+
   G1SATBCardTableModRefBS* _ct_bs;
   G1CollectedHeap* _g1h;
-  HeapRegion* volatile _su_head;
+  uint* _dirty_regions;
+  uint _num_dirty_regions;
+  volatile jint _next_chunk;
+
+  static int compare_region_idx(uint a, uint b) {
+    return a < b ? -1 : (a == b ? 0 : 1);
+  }
+
+  void add_dirty_region(uint region_idx) {
+    assert(_num_dirty_regions < _g1h->max_regions(), "too many dirty regions");
+    _dirty_regions[_num_dirty_regions++] = region_idx;
+  }
+
 public:
   G1ParCleanupCTTask(G1SATBCardTableModRefBS* ct_bs,
                      G1CollectedHeap* g1h) :
     AbstractGangTask("G1 Par Cleanup CT Task"),
-    _ct_bs(ct_bs), _g1h(g1h) { }
+    _ct_bs(ct_bs), _g1h(g1h), _num_dirty_regions(0), _next_chunk(0) {
+    _dirty_regions = NEW_C_HEAP_ARRAY(uint, _g1h->max_regions(), mtGC);
+  }
 
-  void work(uint worker_id) {
+  ~G1ParCleanupCTTask() {
+    FREE_C_HEAP_ARRAY(uint, _dirty_regions, mtGC);
+  }
+
+  // Empty the dirty cards region list into the array of regions to clear.
+  void collect_dirty_regions() {
     HeapRegion* r;
-    while (r = _g1h->pop_dirty_cards_region()) {
-      clear_cards(r);
+    while ((r = _g1h->pop_dirty_cards_region()) != NULL) {
+      // Cards of the survivors should have already been dirtied.
+      if (r->is_survivor()) {
+        continue;
+      }
+      // The card range of a "starts humongous" region extends over all
+      // regions of the humongous object.
+      uint num_regions = r->startsHumongous() ? r->region_num() : 1;
+      for (uint i = 0; i < num_regions; i++) {
+        add_dirty_region(r->hrm_index() + i);
+      }
     }
+    QuickSort::sort<uint>(_dirty_regions, (int)_num_dirty_regions, compare_region_idx, false);
   }
 
-  void clear_cards(HeapRegion* r) {
-    // Cards of the survivors should have already been dirtied.
-    if (!r->is_survivor()) {
-      _ct_bs->clear(MemRegion(r->bottom(), r->end()));
+  void work(uint worker_id) {
+    G1GCParPhaseTimesTracker x(_g1h->g1_policy()->phase_times(), G1GCPhaseTimes::ClearCardTable, worker_id);
+
+    const size_t cards_per_region = HeapRegion::CardsPerRegion;
+    const size_t total_cards = (size_t)_num_dirty_regions * cards_per_region;
+    size_t cleared_cards = 0;
+
+    while (true) {
+      size_t chunk = (size_t)(Atomic::add(1, &_next_chunk) - 1);
+      size_t cur = chunk * ChunkSizeInCards;
+      if (cur >= total_cards) {
+        break;
+      }
+      size_t const end = MIN2(cur + ChunkSizeInCards, total_cards);
+      while (cur < end) {
+        HeapRegion* r = _g1h->region_at(_dirty_regions[cur / cards_per_region]);
+        size_t const offset = cur % cards_per_region;
+        size_t const num_cards = MIN2(cards_per_region - offset, end - cur);
+        HeapWord* const start = r->bottom() + offset * CardTableModRefBS::card_size_in_words;
+        _ct_bs->clear(MemRegion(start, num_cards * CardTableModRefBS::card_size_in_words));
+        cleared_cards += num_cards;
+        cur += num_cards;
+      }
     }
+    _g1h->g1_policy()->phase_times()->record_thread_work_item(G1GCPhaseTimes::ClearCardTable, worker_id, cleared_cards);
   }
 };
 
@@ -6206,22 +6448,14 @@ void G1CollectedHeap::cleanUpCardTable() {
   {
     // Iterate over the dirty cards region list.
     G1ParCleanupCTTask cleanup_task(ct_bs, this);
+    cleanup_task.collect_dirty_regions();
 
     if (G1CollectedHeap::use_parallel_gc_threads()) {
       set_par_threads();
       workers()->run_task(&cleanup_task);
       set_par_threads(0);
     } else {
-      while (_dirty_cards_region_list) {
-        HeapRegion* r = _dirty_cards_region_list;
-        cleanup_task.clear_cards(r);
-        _dirty_cards_region_list = r->get_next_dirty_cards_region();
-        if (_dirty_cards_region_list == r) {
-          // The last region.
-          _dirty_cards_region_list = NULL;
-        }
-        r->set_next_dirty_cards_region(NULL);
-      }
+      cleanup_task.work(0);
     }
 #ifndef PRODUCT
     if (G1VerifyCTCleanup || VerifyAfterGC) {
@@ -6439,6 +6673,7 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
     if (next_bitmap->isMarked(r->bottom())) {
       next_bitmap->clear(r->bottom());
     }
+    g1h->concurrent_mark()->humongous_object_eagerly_reclaimed(r);
     _freed_bytes += r->used();
     r->set_containing_set(NULL);
     _humongous_regions_removed.increment(1u, r->capacity());
@@ -6735,6 +6970,7 @@ HeapRegion* G1CollectedHeap::new_mutator_alloc_region(size_t word_size,
                                               false /* do_expand */);
     if (new_alloc_region != NULL) {
       set_region_short_lived_locked(new_alloc_region);
+      g1_policy()->remset_tracker()->update_at_allocate(new_alloc_region);
       _hr_printer.alloc(new_alloc_region, G1HRPrinter::Eden, young_list_full);
       check_bitmaps("Mutator Region Allocation", new_alloc_region);
       return new_alloc_region;
@@ -6799,6 +7035,7 @@ HeapRegion* G1CollectedHeap::new_gc_alloc_region(size_t word_size,
         _hr_printer.alloc(new_alloc_region, G1HRPrinter::Old);
         check_bitmaps("Old Region Allocation", new_alloc_region);
       }
+      g1_policy()->remset_tracker()->update_at_allocate(new_alloc_region);
       bool during_im = g1_policy()->during_initial_mark_pause();
       new_alloc_region->note_start_of_copying(during_im);
       return new_alloc_region;
@@ -6817,6 +7054,7 @@ void G1CollectedHeap::retire_gc_alloc_region(HeapRegion* alloc_region,
     young_list()->add_survivor_region(alloc_region);
   } else {
     _old_set.add(alloc_region);
+    g1_policy()->add_bytes_allocated_in_old_since_last_gc(allocated_bytes);
   }
   _hr_printer.retire(alloc_region);
 }
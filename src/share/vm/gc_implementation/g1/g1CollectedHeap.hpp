@@ -76,6 +76,7 @@ class STWGCTimer;
 class G1NewTracer;
 class G1OldTracer;
 class EvacuationFailedInfo;
+class G1ParScanThreadState;
 class nmethod;
 
 typedef OverflowTaskQueue<StarTask, mtGC>         RefToScanQueue;
@@ -199,6 +200,7 @@ class G1CollectedHeap : public SharedHeap {
   friend class G1ParScanClosureSuper;
   friend class G1ParEvacuateFollowersClosure;
   friend class G1ParTask;
+  friend class G1ParOptionalEvacTask;
   friend class G1ParGCAllocator;
   friend class G1DefaultParGCAllocator;
   friend class G1FreeGarbageRegionClosure;
@@ -335,6 +337,17 @@ private:
 
   void setup_surviving_young_words();
   void update_surviving_young_words(size_t* surv_young_words);
+
+  // Record a location that refers into an optional collection set region.
+  template <class T> void remember_reference_into_optional_region(T* p, uint worker_id) {
+    _optional_refs[worker_id]->push(StarTask(p));
+  }
+
+  // Process the references into optional regions the given worker
+  // recorded during the previous evacuation round: heap locations are
+  // pushed on the worker's queue, roots are handed to root_cl.
+  void scan_optional_refs(G1ParScanThreadState* pss, OopClosure* root_cl, uint worker_id);
+
   void cleanup_surviving_young_words();
 
   // It decides whether an explicit GC should start a concurrent cycle
@@ -683,6 +696,17 @@ public:
   void register_old_region_with_in_cset_fast_test(HeapRegion* r) {
     _in_cset_fast_test.set_in_old(r->hrm_index());
   }
+  // Optional regions are old regions that are only evacuated if there
+  // is pause time left after evacuating the rest of the collection set.
+  void register_optional_region_with_in_cset_fast_test(HeapRegion* r) {
+    _in_cset_fast_test.set_optional(r->hrm_index());
+  }
+  void clear_optional_region_in_cset_fast_test(HeapRegion* r) {
+    _in_cset_fast_test.clear_optional(r->hrm_index());
+  }
+  bool is_optional_cset_region(HeapRegion* r) {
+    return _in_cset_fast_test.get_by_index(r->hrm_index()).is_optional();
+  }
 
   // This is a fast test on whether a reference points into the
   // collection set or not. Assume that the reference
@@ -784,6 +808,12 @@ protected:
   // Actually do the work of evacuating the collection set.
   void evacuate_collection_set(EvacuationInfo& evacuation_info);
 
+  // Evacuate optional collection set regions in increments for as long
+  // as the pause time goal allows, after the rest of the collection set
+  // has been evacuated. Regions that are left over stay candidates for
+  // the next mixed GC.
+  void evacuate_optional_collection_set(EvacuationInfo& evacuation_info);
+
   // The g1 remembered set of the heap.
   G1RemSet* _g1_rem_set;
 
@@ -822,6 +852,15 @@ protected:
   // The parallel task queues
   RefToScanQueueSet *_task_queues;
 
+  // Locations of references into optional collection set regions found
+  // during evacuation, one list per worker. References found during the
+  // current evacuation round are added to _optional_refs; the ones found
+  // during the previous round are in _optional_refs_to_scan.
+  GrowableArray<StarTask>** _optional_refs;
+  GrowableArray<StarTask>** _optional_refs_to_scan;
+
+  void clear_optional_refs();
+
   // True iff a evacuation has failed in the current collection.
   bool _evacuation_failed;
 
@@ -134,6 +134,7 @@ G1CollectorPolicy::G1CollectorPolicy() :
   _eden_cset_region_length(0),
   _survivor_cset_region_length(0),
   _old_cset_region_length(0),
+  _optional_cset_region_length(0),
 
   _collection_set(NULL),
   _collection_set_bytes_used_before(0),
@@ -314,6 +315,20 @@ G1CollectorPolicy::G1CollectorPolicy() :
   _reserve_regions = 0;
 
   _collectionSetChooser = new CollectionSetChooser();
+
+  _ihop_control = create_ihop_control();
+  _bytes_allocated_in_old_since_last_gc = 0;
+}
+
+G1IHOPControl* G1CollectorPolicy::create_ihop_control() {
+  if (G1UseAdaptiveIHOP) {
+    return new G1AdaptiveIHOPControl((double) InitiatingHeapOccupancyPercent,
+                                     this,
+                                     G1ReservePercent,
+                                     G1HeapWastePercent);
+  } else {
+    return new G1StaticIHOPControl((double) InitiatingHeapOccupancyPercent);
+  }
 }
 
 void G1CollectorPolicy::initialize_alignments() {
@@ -503,6 +518,8 @@ void G1CollectorPolicy::record_new_heap_size(uint new_number_of_regions) {
   _reserve_regions = (uint) ceil(reserve_regions_d);
 
   _young_gen_sizer->heap_size_changed(new_number_of_regions);
+
+  _ihop_control->update_target_occupancy(new_number_of_regions * HeapRegion::GrainBytes);
 }
 
 uint G1CollectorPolicy::calculate_young_list_desired_min_length(
@@ -829,6 +846,10 @@ void G1CollectorPolicy::record_full_collection_end() {
   _survivor_surv_rate_group->reset();
   update_young_list_target_length();
   _collectionSetChooser->clear();
+
+  // A Full GC ends any concurrent cycle; its marking length is of no use.
+  _initial_mark_to_mixed.reset();
+  _bytes_allocated_in_old_since_last_gc = 0;
 }
 
 void G1CollectorPolicy::record_stop_world_start() {
@@ -885,6 +906,7 @@ void G1CollectorPolicy::record_concurrent_mark_remark_end() {
   _concurrent_mark_remark_times_ms->add(elapsed_time_ms);
   _cur_mark_stop_world_time_ms += elapsed_time_ms;
   _prev_collection_pause_end_ms += elapsed_time_ms;
+  _initial_mark_to_mixed.add_pause(end_time_sec - _mark_remark_start_sec);
 
   _mmu_tracker->add_pause(_mark_remark_start_sec, end_time_sec, true);
 }
@@ -911,7 +933,9 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
   }
 
   size_t marking_initiating_used_threshold =
-    (_g1->capacity() / 100) * InitiatingHeapOccupancyPercent;
+    _ihop_control->get_conc_mark_start_threshold();
+  double marking_initiating_used_threshold_perc =
+    (double) marking_initiating_used_threshold * 100.0 / (double) _g1->capacity();
   size_t cur_used_bytes = _g1->non_young_capacity_bytes();
   size_t alloc_byte_size = alloc_word_size * HeapWordSize;
 
@@ -927,7 +951,7 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
         cur_used_bytes,
         alloc_byte_size,
         marking_initiating_used_threshold,
-        (double) InitiatingHeapOccupancyPercent,
+        marking_initiating_used_threshold_perc,
         source);
       return true;
     } else {
@@ -941,7 +965,7 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
         cur_used_bytes,
         alloc_byte_size,
         marking_initiating_used_threshold,
-        (double) InitiatingHeapOccupancyPercent,
+        marking_initiating_used_threshold_perc,
         source);
     }
   }
@@ -952,6 +976,35 @@ bool G1CollectorPolicy::need_to_start_conc_mark(const char* source, size_t alloc
 // Anything below that is considered to be zero
 #define MIN_TIMER_GRANULARITY 0.0000001
 
+void G1CollectorPolicy::update_ihop_prediction(double mutator_time_s,
+                                               size_t mutator_alloc_bytes,
+                                               size_t young_gen_size) {
+  bool report = false;
+
+  if (!_last_gc_was_young && _initial_mark_to_mixed.has_result()) {
+    double marking_to_mixed_time = _initial_mark_to_mixed.last_marking_time();
+    // Ignore samples that are too short to be meaningful, e.g. if the
+    // mixed GC immediately followed the cleanup pause.
+    if (marking_to_mixed_time > MIN_TIMER_GRANULARITY) {
+      _ihop_control->update_marking_length(marking_to_mixed_time);
+      report = true;
+    }
+  }
+
+  // Use only young-only GCs for the old gen allocation rate: mixed GCs
+  // promote at a different rate, and the young gen size is restrained
+  // during them. Also skip very short mutator periods, e.g. caused by
+  // back-to-back GCs, that would give meaningless rates.
+  if (_last_gc_was_young && mutator_time_s > MIN_TIMER_GRANULARITY) {
+    _ihop_control->update_allocation_info(mutator_time_s, mutator_alloc_bytes, young_gen_size);
+    report = true;
+  }
+
+  if (report) {
+    _ihop_control->print();
+  }
+}
+
 void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, EvacuationInfo& evacuation_info) {
   double end_time_sec = os::elapsedTime();
   assert(_cur_collection_pause_used_regions_at_start >= cset_region_length(),
@@ -972,6 +1025,23 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
 #endif // PRODUCT
 
   last_pause_included_initial_mark = during_initial_mark_pause();
+
+  // Update the IHOP control before deciding below whether to start a
+  // new concurrent cycle.
+  if (!_last_gc_was_young) {
+    _initial_mark_to_mixed.record_mixed_gc_start(phase_times()->cur_collection_start_sec());
+  } else if (last_pause_included_initial_mark) {
+    _initial_mark_to_mixed.record_initial_mark_end(end_time_sec);
+  } else {
+    _initial_mark_to_mixed.add_pause(pause_time_ms / 1000.0);
+  }
+  double mutator_time_s =
+    phase_times()->cur_collection_start_sec() - _prev_collection_pause_end_ms / 1000.0;
+  update_ihop_prediction(mutator_time_s,
+                         _bytes_allocated_in_old_since_last_gc,
+                         (size_t) young_list_target_length() * HeapRegion::GrainBytes);
+  _bytes_allocated_in_old_since_last_gc = 0;
+
   if (last_pause_included_initial_mark) {
     record_concurrent_mark_init_end(0.0);
   } else if (need_to_start_conc_mark("end of GC")) {
@@ -1055,11 +1125,16 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
       if (next_gc_should_be_mixed("start mixed GCs",
                                   "do not start mixed GCs")) {
         set_gcs_are_young(false);
+      } else {
+        clear_collection_set_candidates();
+        // No mixed GC will end the current marking length sample.
+        _initial_mark_to_mixed.reset();
       }
     } else {
       ergo_verbose0(ErgoMixedGCs,
                     "do not start mixed GCs",
                     ergo_format_reason("concurrent cycle is about to start"));
+      clear_collection_set_candidates();
     }
     _last_young_gc = false;
   }
@@ -1071,6 +1146,7 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
     if (!next_gc_should_be_mixed("continue mixed GCs",
                                  "do not continue mixed GCs")) {
       set_gcs_are_young(true);
+      clear_collection_set_candidates();
     }
   }
 
@@ -1130,6 +1206,9 @@ void G1CollectorPolicy::record_collection_pause_end(double pause_time_ms, Evacua
     if (_collection_set_bytes_used_before > freed_bytes) {
       size_t copied_bytes = _collection_set_bytes_used_before - freed_bytes;
       double average_copy_time = phase_times()->average_time_ms(G1GCPhaseTimes::ObjCopy);
+      if (phase_times()->cur_optional_evac_regions() > 0) {
+        average_copy_time += phase_times()->average_time_ms(G1GCPhaseTimes::OptObjCopy);
+      }
       double cost_per_byte_ms = average_copy_time / (double) copied_bytes;
       if (_in_marking_window) {
         _cost_per_byte_ms_during_cm_seq->add(cost_per_byte_ms);
@@ -1359,6 +1438,7 @@ G1CollectorPolicy::init_cset_region_lengths(uint eden_cset_region_length,
   _eden_cset_region_length     = eden_cset_region_length;
   _survivor_cset_region_length = survivor_cset_region_length;
   _old_cset_region_length      = 0;
+  _optional_cset_region_length = 0;
 }
 
 void G1CollectorPolicy::set_recorded_rs_lengths(size_t rs_lengths) {
@@ -1542,10 +1622,12 @@ G1CollectorPolicy::decide_on_conc_mark_initiation() {
 class KnownGarbageClosure: public HeapRegionClosure {
   G1CollectedHeap* _g1h;
   CollectionSetChooser* _hrSorted;
+  G1RemSetTrackingPolicy* _remset_tracker;
 
 public:
   KnownGarbageClosure(CollectionSetChooser* hrSorted) :
-    _g1h(G1CollectedHeap::heap()), _hrSorted(hrSorted) { }
+    _g1h(G1CollectedHeap::heap()), _hrSorted(hrSorted),
+    _remset_tracker(_g1h->g1_policy()->remset_tracker()) { }
 
   bool doHeapRegion(HeapRegion* r) {
     // We only include humongous regions in collection
@@ -1559,8 +1641,12 @@ public:
       // before we fill them up).
       if (_hrSorted->should_add(r) && !_g1h->is_old_gc_alloc_region(r)) {
         _hrSorted->add_region(r);
+        return false;
       }
     }
+    // Not going to be collected by the next mixed GCs; no need to keep
+    // its remembered set around.
+    _remset_tracker->update_for_non_candidate(r);
     return false;
   }
 };
@@ -1568,12 +1654,14 @@ public:
 class ParKnownGarbageHRClosure: public HeapRegionClosure {
   G1CollectedHeap* _g1h;
   CSetChooserParUpdater _cset_updater;
+  G1RemSetTrackingPolicy* _remset_tracker;
 
 public:
   ParKnownGarbageHRClosure(CollectionSetChooser* hrSorted,
                            uint chunk_size) :
     _g1h(G1CollectedHeap::heap()),
-    _cset_updater(hrSorted, true /* parallel */, chunk_size) { }
+    _cset_updater(hrSorted, true /* parallel */, chunk_size),
+    _remset_tracker(_g1h->g1_policy()->remset_tracker()) { }
 
   bool doHeapRegion(HeapRegion* r) {
     // Do we have any marking information for this region?
@@ -1583,8 +1671,10 @@ public:
       // before we fill them up).
       if (_cset_updater.should_add(r) && !_g1h->is_old_gc_alloc_region(r)) {
         _cset_updater.add_region(r);
+        return false;
       }
     }
+    _remset_tracker->update_for_non_candidate(r);
     return false;
   }
 };
@@ -1654,12 +1744,17 @@ G1CollectorPolicy::record_concurrent_mark_cleanup_end(int no_of_gc_threads) {
   _concurrent_mark_cleanup_times_ms->add(elapsed_time_ms);
   _cur_mark_stop_world_time_ms += elapsed_time_ms;
   _prev_collection_pause_end_ms += elapsed_time_ms;
+  _initial_mark_to_mixed.add_pause(end_sec - _mark_cleanup_start_sec);
   _mmu_tracker->add_pause(_mark_cleanup_start_sec, end_sec, true);
 }
 
 // Add the heap region at the head of the non-incremental collection set
 void G1CollectorPolicy::add_old_region_to_cset(HeapRegion* hr) {
   assert(_inc_cset_build_state == Active, "Precondition");
+  link_old_region_into_cset(hr);
+}
+
+void G1CollectorPolicy::link_old_region_into_cset(HeapRegion* hr) {
   assert(hr->is_old(), "the region should be old");
 
   assert(!hr->in_collection_set(), "should not already be in the CSet");
@@ -1864,6 +1959,24 @@ double G1CollectorPolicy::reclaimable_bytes_perc(size_t reclaimable_bytes) {
   return (double) reclaimable_bytes * 100.0 / (double) capacity_bytes;
 }
 
+class G1DropCandidateRemSetClosure : public HeapRegionClosure {
+  G1RemSetTrackingPolicy* _remset_tracker;
+public:
+  G1DropCandidateRemSetClosure(G1RemSetTrackingPolicy* remset_tracker) :
+    _remset_tracker(remset_tracker) { }
+
+  bool doHeapRegion(HeapRegion* r) {
+    _remset_tracker->update_for_non_candidate(r);
+    return false;
+  }
+};
+
+void G1CollectorPolicy::clear_collection_set_candidates() {
+  G1DropCandidateRemSetClosure cl(&_remset_tracker);
+  _collectionSetChooser->iterate(&cl);
+  _collectionSetChooser->clear();
+}
+
 bool G1CollectorPolicy::next_gc_should_be_mixed(const char* true_action_str,
                                                 const char* false_action_str) {
   CollectionSetChooser* cset_chooser = _collectionSetChooser;
@@ -2081,6 +2194,12 @@ void G1CollectorPolicy::finalize_cset(double target_pause_time_ms, EvacuationInf
                           ergo_format_region("min"),
                           predicted_time_ms, time_remaining_ms,
                           old_cset_region_length(), min_old_cset_length);
+            if (G1UseOptionalCSet) {
+              // The prediction may well be too pessimistic; leave the
+              // decision about the next few candidates to the end of
+              // the evacuation, when the actual time spent is known.
+              select_optional_regions(max_old_cset_length - old_cset_region_length());
+            }
             break;
           }
 
@@ -2155,6 +2274,91 @@ void G1CollectorPolicy::finalize_cset(double target_pause_time_ms, EvacuationInf
   evacuation_info.set_collectionset_regions(cset_region_length());
 }
 
+void G1CollectorPolicy::select_optional_regions(uint max_optional_regions) {
+  assert(_optional_cset_region_length == 0, "optional regions already selected");
+  CollectionSetChooser* cset_chooser = _collectionSetChooser;
+
+  // Do not select regions that would take the remaining reclaimable
+  // space below G1HeapWastePercent, as finalize_cset() would not have
+  // added them either.
+  size_t reclaimable_bytes = cset_chooser->remaining_reclaimable_bytes();
+  double threshold = (double) G1HeapWastePercent;
+  uint num_optional = 0;
+  HeapRegion* hr = cset_chooser->peek_at(num_optional);
+  while (hr != NULL && num_optional < max_optional_regions) {
+    if (reclaimable_bytes_perc(reclaimable_bytes) <= threshold) {
+      break;
+    }
+    _g1->register_optional_region_with_in_cset_fast_test(hr);
+    reclaimable_bytes -= hr->reclaimable_bytes();
+    num_optional++;
+    hr = cset_chooser->peek_at(num_optional);
+  }
+  _optional_cset_region_length = num_optional;
+
+  if (num_optional > 0) {
+    ergo_verbose2(ErgoCSetConstruction,
+                  "select optional regions",
+                  ergo_format_region("optional")
+                  ergo_format_region("max"),
+                  num_optional, max_optional_regions);
+  }
+}
+
+double G1CollectorPolicy::optional_evacuation_time_remaining_ms() {
+  double elapsed_ms = (os::elapsedTime() - phase_times()->cur_collection_start_sec()) * 1000.0;
+  double remaining_ms = max_pause_time_ms() - elapsed_ms - predict_constant_other_time_ms();
+  return MAX2(remaining_ms, 0.0);
+}
+
+uint G1CollectorPolicy::add_optional_regions_to_cset(double time_remaining_ms,
+                                                     GrowableArray<HeapRegion*>* added_regions) {
+  assert(_inc_cset_build_state == Inactive, "collection set must have been finalized");
+  CollectionSetChooser* cset_chooser = _collectionSetChooser;
+
+  uint num_added = 0;
+  while (_optional_cset_region_length > 0) {
+    HeapRegion* hr = cset_chooser->peek();
+    assert(hr != NULL && _g1->is_optional_cset_region(hr),
+           "the current candidate must be the first optional region");
+
+    double predicted_time_ms = predict_region_elapsed_time_ms(hr, false) +
+                               predict_non_young_other_time_ms(1);
+    if (predicted_time_ms > time_remaining_ms) {
+      break;
+    }
+    time_remaining_ms -= predicted_time_ms;
+
+    cset_chooser->remove_and_move_to_next(hr);
+    _g1->old_set_remove(hr);
+    _g1->clear_optional_region_in_cset_fast_test(hr);
+    hr->rem_set()->reset_for_par_iteration();
+    link_old_region_into_cset(hr);
+    added_regions->append(hr);
+
+    _optional_cset_region_length--;
+    num_added++;
+  }
+
+  ergo_verbose3(ErgoCSetConstruction,
+                "add optional regions to CSet",
+                ergo_format_region("added")
+                ergo_format_region("remaining optional")
+                ergo_format_ms("remaining time"),
+                num_added, _optional_cset_region_length, time_remaining_ms);
+  return num_added;
+}
+
+void G1CollectorPolicy::abandon_optional_regions() {
+  CollectionSetChooser* cset_chooser = _collectionSetChooser;
+  for (uint i = 0; i < _optional_cset_region_length; i++) {
+    HeapRegion* hr = cset_chooser->peek_at(i);
+    assert(hr != NULL, "optional regions must still be candidates");
+    _g1->clear_optional_region_in_cset_fast_test(hr);
+  }
+  _optional_cset_region_length = 0;
+}
+
 void TraceGen0TimeData::record_start_collection(double time_to_stop_the_world_ms) {
   if(TraceGen0Time) {
     _all_stop_world_times_ms.add(time_to_stop_the_world_ms);
@@ -27,7 +27,9 @@
 
 #include "gc_implementation/g1/collectionSetChooser.hpp"
 #include "gc_implementation/g1/g1Allocator.hpp"
+#include "gc_implementation/g1/g1IHOPControl.hpp"
 #include "gc_implementation/g1/g1MMUTracker.hpp"
+#include "gc_implementation/g1/g1RemSetTrackingPolicy.hpp"
 #include "memory/collectorPolicy.hpp"
 
 // A G1CollectorPolicy makes policy decisions that determine the
@@ -183,6 +185,25 @@ private:
 
   CollectionSetChooser* _collectionSetChooser;
 
+  G1RemSetTrackingPolicy _remset_tracker;
+
+  // Decides the non-young occupancy at which a concurrent cycle is started.
+  G1IHOPControl* _ihop_control;
+
+  // Mutator time from the end of initial mark to the first mixed gc, the
+  // marking length sample for the IHOP control.
+  G1InitialMarkToMixedTimeTracker _initial_mark_to_mixed;
+
+  // Bytes promoted or allocated as humongous objects since the end of the
+  // last GC, the old gen allocation sample for the IHOP control.
+  size_t _bytes_allocated_in_old_since_last_gc;
+
+  G1IHOPControl* create_ihop_control();
+  // Update the IHOP control with the samples gathered since the last GC.
+  void update_ihop_prediction(double mutator_time_s,
+                              size_t mutator_alloc_bytes,
+                              size_t young_gen_size);
+
   double _full_collection_start_sec;
   uint   _cur_collection_pause_used_regions_at_start;
 
@@ -262,6 +283,12 @@ private:
   uint survivor_cset_region_length() { return _survivor_cset_region_length; }
   uint old_cset_region_length()      { return _old_cset_region_length;      }
 
+  // The number of candidate regions following the current one in the
+  // CSet chooser that finalize_cset() marked as optional. They are only
+  // evacuated if time remains in the pause after the collection set
+  // proper has been evacuated.
+  uint _optional_cset_region_length;
+
   uint _free_regions_at_end_of_collection;
 
   size_t _recorded_rs_lengths;
@@ -442,6 +469,10 @@ public:
     return _mmu_tracker;
   }
 
+  G1RemSetTrackingPolicy* remset_tracker() {
+    return &_remset_tracker;
+  }
+
   double max_pause_time_ms() {
     return _mmu_tracker->max_gc_time() * 1000.0;
   }
@@ -717,12 +748,23 @@ public:
     return _bytes_copied_during_gc;
   }
 
+  // Record space allocated into the old gen, either by promotion during
+  // a GC or by a humongous allocation.
+  void add_bytes_allocated_in_old_since_last_gc(size_t bytes) {
+    _bytes_allocated_in_old_since_last_gc += bytes;
+  }
+
   // Determine whether there are candidate regions so that the
   // next GC should be mixed. The two action strings are used
   // in the ergo output when the method returns true or false.
   bool next_gc_should_be_mixed(const char* true_action_str,
                                const char* false_action_str);
 
+  // Drop the remaining candidate regions of the CSet chooser together
+  // with their remembered sets, as they will not be collected by mixed
+  // GCs anymore.
+  void clear_collection_set_candidates();
+
   // Choose a new collection set.  Marks the chosen regions as being
   // "in_collection_set", and links them together.  The head and number of
   // the collection set are available via access methods.
@@ -737,6 +779,31 @@ public:
   // Add old region "hr" to the CSet.
   void add_old_region_to_cset(HeapRegion* hr);
 
+private:
+  void link_old_region_into_cset(HeapRegion* hr);
+
+  // Mark up to the given number of candidate regions following the ones
+  // just added to the CSet as optional.
+  void select_optional_regions(uint max_optional_regions);
+
+public:
+  bool has_optional_regions() const { return _optional_cset_region_length > 0; }
+
+  // The pause time left for evacuating optional regions, taking into
+  // account the work still to be done after evacuation.
+  double optional_evacuation_time_remaining_ms();
+
+  // Move optional regions, in CSet chooser order, into the collection
+  // set for as long as their predicted evacuation time fits into
+  // time_remaining_ms. The regions added are appended to added_regions.
+  // Returns the number of regions added.
+  uint add_optional_regions_to_cset(double time_remaining_ms,
+                                    GrowableArray<HeapRegion*>* added_regions);
+
+  // Give up on the optional regions that have not been added to the
+  // collection set; they stay candidates for the next mixed GC.
+  void abandon_optional_regions();
+
   // Incremental CSet Support
 
   // The head of the incrementally built collection set.
@@ -281,15 +281,26 @@ G1GCPhaseTimes::G1GCPhaseTimes(uint max_gc_threads) :
   _update_rs_processed_buffers = new WorkerDataArray<size_t>(max_gc_threads, "Processed Buffers", true, G1Log::LevelFiner, 3);
   _gc_par_phases[UpdateRS]->link_thread_work_items(_update_rs_processed_buffers);
 
+  _scan_rs_scanned_cards = new WorkerDataArray<size_t>(max_gc_threads, "Scanned Cards", true, G1Log::LevelFiner, 3);
+  _gc_par_phases[ScanRS]->link_thread_work_items(_scan_rs_scanned_cards);
+
   _termination_attempts = new WorkerDataArray<size_t>(max_gc_threads, "Termination Attempts", true, G1Log::LevelFinest, 3);
   _gc_par_phases[Termination]->link_thread_work_items(_termination_attempts);
 
+  _gc_par_phases[OptScanRS] = new WorkerDataArray<double>(max_gc_threads, "Optional Scan RS (ms)", true, G1Log::LevelFiner, 2);
+  _gc_par_phases[OptObjCopy] = new WorkerDataArray<double>(max_gc_threads, "Optional Object Copy (ms)", true, G1Log::LevelFiner, 2);
+  _gc_par_phases[OptTermination] = new WorkerDataArray<double>(max_gc_threads, "Optional Termination (ms)", true, G1Log::LevelFiner, 2);
+
   _gc_par_phases[StringDedupQueueFixup] = new WorkerDataArray<double>(max_gc_threads, "Queue Fixup (ms)", true, G1Log::LevelFiner, 2);
   _gc_par_phases[StringDedupTableFixup] = new WorkerDataArray<double>(max_gc_threads, "Table Fixup (ms)", true, G1Log::LevelFiner, 2);
 
   _gc_par_phases[RedirtyCards] = new WorkerDataArray<double>(max_gc_threads, "Parallel Redirty", true, G1Log::LevelFinest, 3);
   _redirtied_cards = new WorkerDataArray<size_t>(max_gc_threads, "Redirtied Cards", true, G1Log::LevelFinest, 3);
   _gc_par_phases[RedirtyCards]->link_thread_work_items(_redirtied_cards);
+
+  _gc_par_phases[ClearCardTable] = new WorkerDataArray<double>(max_gc_threads, "Parallel Clear CT", true, G1Log::LevelFinest, 2);
+  _cleared_cards = new WorkerDataArray<size_t>(max_gc_threads, "Cleared Cards", true, G1Log::LevelFinest, 3);
+  _gc_par_phases[ClearCardTable]->link_thread_work_items(_cleared_cards);
 }
 
 void G1GCPhaseTimes::note_gc_start(uint active_gc_threads, bool mark_in_progress) {
@@ -303,6 +314,18 @@ void G1GCPhaseTimes::note_gc_start(uint active_gc_threads, bool mark_in_progress
 
   _gc_par_phases[StringDedupQueueFixup]->set_enabled(G1StringDedup::is_enabled());
   _gc_par_phases[StringDedupTableFixup]->set_enabled(G1StringDedup::is_enabled());
+
+  for (int i = OptParPhasesFirst; i <= OptParPhasesLast; i++) {
+    _gc_par_phases[i]->set_enabled(false);
+  }
+  _cur_optional_evac_time_ms = 0.0;
+  _cur_optional_evac_regions = 0;
+}
+
+void G1GCPhaseTimes::note_optional_evacuation_start() {
+  for (int i = OptParPhasesFirst; i <= OptParPhasesLast; i++) {
+    _gc_par_phases[i]->set_enabled(true);
+  }
 }
 
 void G1GCPhaseTimes::note_gc_end() {
@@ -349,6 +372,9 @@ double G1GCPhaseTimes::accounted_time_ms() {
     // Now subtract the time taken to fix up roots in generated code
     misc_time_ms += _cur_collection_code_root_fixup_time_ms;
 
+    // Time spent evacuating optional collection set regions
+    misc_time_ms += _cur_optional_evac_time_ms;
+
     // Strong code root purge time
     misc_time_ms += _cur_strong_code_root_purge_time_ms;
 
@@ -525,6 +551,15 @@ void G1GCPhaseTimes::print(double pause_time_sec) {
     par_phase_printer.print((GCParPhases) i);
   }
 
+  if (_cur_optional_evac_regions > 0) {
+    print_stats(1, "Optional Evacuation", _cur_optional_evac_time_ms);
+    if (G1Log::finest()) {
+      print_stats(2, "Optional Regions", (size_t) _cur_optional_evac_regions);
+    }
+    for (int i = OptParPhasesFirst; i <= OptParPhasesLast; i++) {
+      par_phase_printer.print((GCParPhases) i);
+    }
+  }
   print_stats(1, "Code Root Fixup", _cur_collection_code_root_fixup_time_ms);
   print_stats(1, "Code Root Purge", _cur_strong_code_root_purge_time_ms);
   if (G1StringDedup::is_enabled()) {
@@ -534,6 +569,7 @@ void G1GCPhaseTimes::print(double pause_time_sec) {
     }
   }
   print_stats(1, "Clear CT", _cur_clear_ct_time_ms);
+  par_phase_printer.print(ClearCardTable);
   double misc_time_ms = pause_time_sec * MILLIUNITS - accounted_time_ms();
   print_stats(1, "Other", misc_time_ms);
   if (_cur_verify_before_time_ms > 0.0) {
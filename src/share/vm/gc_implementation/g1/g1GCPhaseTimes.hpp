@@ -64,22 +64,30 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     Other,
     GCWorkerTotal,
     GCWorkerEnd,
+    OptScanRS,
+    OptObjCopy,
+    OptTermination,
     StringDedupQueueFixup,
     StringDedupTableFixup,
     RedirtyCards,
+    ClearCardTable,
     GCParPhasesSentinel
   };
 
  private:
   // Markers for grouping the phases in the GCPhases enum above
   static const int GCMainParPhasesLast = GCWorkerEnd;
+  static const int OptParPhasesFirst = OptScanRS;
+  static const int OptParPhasesLast = OptTermination;
   static const int StringDedupPhasesFirst = StringDedupQueueFixup;
   static const int StringDedupPhasesLast = StringDedupTableFixup;
 
   WorkerDataArray<double>* _gc_par_phases[GCParPhasesSentinel];
   WorkerDataArray<size_t>* _update_rs_processed_buffers;
+  WorkerDataArray<size_t>* _scan_rs_scanned_cards;
   WorkerDataArray<size_t>* _termination_attempts;
   WorkerDataArray<size_t>* _redirtied_cards;
+  WorkerDataArray<size_t>* _cleared_cards;
 
   double _cur_collection_par_time_ms;
   double _cur_collection_code_root_fixup_time_ms;
@@ -91,6 +99,9 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   double _cur_string_dedup_fixup_time_ms;
 
+  double _cur_optional_evac_time_ms;
+  uint   _cur_optional_evac_regions;
+
   double _cur_clear_ct_time_ms;
   double _cur_ref_proc_time_ms;
   double _cur_ref_enq_time_ms;
@@ -183,6 +194,16 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _cur_string_dedup_fixup_time_ms = ms;
   }
 
+  void record_optional_evacuation(double ms, uint regions) {
+    _cur_optional_evac_time_ms = ms;
+    _cur_optional_evac_regions = regions;
+  }
+
+  // Enables the per-worker phases of the optional evacuation; they
+  // are only verified and printed for pauses that evacuated optional
+  // regions.
+  void note_optional_evacuation_start();
+
   void record_ref_proc_time(double ms) {
     _cur_ref_proc_time_ms = ms;
   }
@@ -244,6 +265,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     return _cur_collection_start_sec;
   }
 
+  uint cur_optional_evac_regions() {
+    return _cur_optional_evac_regions;
+  }
+
   double cur_collection_par_time_ms() {
     return _cur_collection_par_time_ms;
   }
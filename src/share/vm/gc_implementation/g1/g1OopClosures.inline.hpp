@@ -89,6 +89,8 @@ inline void G1ParScanClosure::do_oop_nv(T* p) {
     } else {
       if (state.is_humongous()) {
         _g1->set_humongous_is_live(obj);
+      } else if (state.is_optional()) {
+        _par_scan_state->remember_reference_into_optional_region(p);
       }
       _par_scan_state->update_rs(_from, p, _worker_id);
     }
@@ -222,4 +224,24 @@ inline void G1UpdateRSOrPushRefOopClosure::do_oop_nv(T* p) {
   }
 }
 
+template <class T>
+inline void G1RebuildRemSetClosure::do_oop_nv(T* p) {
+  T const o = oopDesc::load_heap_oop(p);
+  if (oopDesc::is_null(o)) {
+    return;
+  }
+  oop const obj = oopDesc::decode_heap_oop_not_null(o);
+
+  HeapRegion* from = _g1->heap_region_containing((HeapWord*)p);
+  HeapRegion* to = _g1->heap_region_containing(obj);
+  if (from == to) {
+    return;
+  }
+
+  HeapRegionRemSet* rem_set = to->rem_set();
+  if (rem_set->is_updating()) {
+    rem_set->add_reference(p, HeapRegionRemSet::rebuild_par_id(_worker_id));
+  }
+}
+
 #endif // SHARE_VM_GC_IMPLEMENTATION_G1_G1OOPCLOSURES_INLINE_HPP
@@ -123,6 +123,12 @@ class G1ParScanThreadState : public StackObj {
    }
   }
 
+  // The referenced object is in an optional collection set region; keep the
+  // location in case that region is evacuated later during this pause.
+  template <class T> void remember_reference_into_optional_region(T* p) {
+    _g1h->remember_reference_into_optional_region(p, queue_num());
+  }
+
   void set_evac_failure_closure(OopsInHeapRegionClosure* evac_failure_cl) {
     _evac_failure_cl = evac_failure_cl;
   }
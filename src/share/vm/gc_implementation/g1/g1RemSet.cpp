@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc_implementation/g1/concurrentG1Refine.hpp"
 #include "gc_implementation/g1/concurrentG1RefineThread.hpp"
+#include "gc_implementation/g1/concurrentMark.inline.hpp"
 #include "gc_implementation/g1/g1BlockOffsetTable.inline.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/g1CollectorPolicy.hpp"
@@ -34,9 +35,12 @@
 #include "gc_implementation/g1/g1RemSet.inline.hpp"
 #include "gc_implementation/g1/heapRegionManager.inline.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
+#include "gc_implementation/shared/suspendibleThreadSet.hpp"
 #include "memory/iterator.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/intHisto.hpp"
+#include "utilities/quickSort.hpp"
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
 
@@ -116,23 +120,45 @@ class ScanRSClosure : public HeapRegionClosure {
   uint   _worker_i;
   int    _block_size;
   bool   _try_claimed;
+  // Scanning the remembered sets of optional regions added to the
+  // collection set after the initial evacuation. The cards have already
+  // been claimed and the dirty cards refined by then, so neither the card
+  // claim nor the dirty card check may filter cards in this mode.
+  bool   _optional;
+
+  // The cards of the block currently claimed by this worker. They are
+  // scanned in ascending card order once the whole block is known.
+  size_t* _block_cards;
+  uint    _num_block_cards;
+
+  static int compare_cards(size_t a, size_t b) {
+    return a < b ? -1 : (a == b ? 0 : 1);
+  }
 
 public:
   ScanRSClosure(G1ParPushHeapRSClosure* oc,
                 CodeBlobClosure* code_root_cl,
-                uint worker_i) :
+                uint worker_i,
+                bool optional = false) :
     _oc(oc),
     _code_root_cl(code_root_cl),
     _strong_code_root_scan_time_sec(0.0),
     _cards(0),
     _cards_done(0),
     _worker_i(worker_i),
-    _try_claimed(false)
+    _try_claimed(false),
+    _optional(optional),
+    _num_block_cards(0)
   {
     _g1h = G1CollectedHeap::heap();
     _bot_shared = _g1h->bot_shared();
     _ct_bs = _g1h->g1_barrier_set();
     _block_size = MAX2<int>(G1RSetScanBlockSize, 1);
+    _block_cards = NEW_C_HEAP_ARRAY(size_t, _block_size, mtGC);
+  }
+
+  ~ScanRSClosure() {
+    FREE_C_HEAP_ARRAY(size_t, _block_cards, mtGC);
   }
 
   void set_try_claimed() { _try_claimed = true; }
@@ -147,7 +173,13 @@ public:
     MemRegion card_region(_bot_shared->address_for_index(index), G1BlockOffsetSharedArray::N_words);
     MemRegion pre_gc_allocated(r->bottom(), r->scan_top());
     MemRegion mr = pre_gc_allocated.intersection(card_region);
-    if (!mr.is_empty() && !_ct_bs->is_card_claimed(index)) {
+    if (mr.is_empty()) {
+      return;
+    }
+    if (_optional) {
+      _cards_done++;
+      cl.do_MemRegion(mr);
+    } else if (!_ct_bs->is_card_claimed(index)) {
       // We make the card as "claimed" lazily (so races are possible
       // but they're benign), which reduces the number of duplicate
       // scans (the rsets of the regions in the cset can intersect).
@@ -168,6 +200,37 @@ public:
                            card_start, card_start + G1BlockOffsetSharedArray::N_words);
   }
 
+  // The remembered set iterator returns the cards of a block in no
+  // particular order. Sort them so that the heap is walked in address
+  // order, and prefetch the start of the next card while scanning.
+  void scan_claimed_block() {
+    if (_num_block_cards == 0) {
+      return;
+    }
+    QuickSort::sort<size_t>(_block_cards, (int)_num_block_cards, compare_cards, false);
+
+    for (uint i = 0; i < _num_block_cards; i++) {
+      size_t card_index = _block_cards[i];
+      if (i + 1 < _num_block_cards) {
+        Prefetch::read(_bot_shared->address_for_index(_block_cards[i + 1]), 0);
+      }
+      HeapWord* card_start = _bot_shared->address_for_index(card_index);
+      HeapRegion* card_region = _g1h->heap_region_containing(card_start);
+      _cards++;
+
+      if (!card_region->is_on_dirty_cards_region_list()) {
+        _g1h->push_dirty_cards_region(card_region);
+      }
+
+      // If the card is dirty, then we will scan it during updateRS.
+      if (!card_region->in_collection_set() &&
+          (_optional || !_ct_bs->is_card_dirty(card_index))) {
+        scanCard(card_index, card_region);
+      }
+    }
+    _num_block_cards = 0;
+  }
+
   void scan_strong_code_roots(HeapRegion* r) {
     double scan_start = os::elapsedTime();
     r->strong_code_roots_do(_code_root_cl);
@@ -196,28 +259,15 @@ public:
     size_t jump_to_card = hrrs->iter_claimed_next(_block_size);
     for (size_t current_card = 0; iter.has_next(card_index); current_card++) {
       if (current_card >= jump_to_card + _block_size) {
+        scan_claimed_block();
         jump_to_card = hrrs->iter_claimed_next(_block_size);
       }
       if (current_card < jump_to_card) continue;
-      HeapWord* card_start = _g1h->bot_shared()->address_for_index(card_index);
-#if 0
-      gclog_or_tty->print("Rem set iteration yielded card [" PTR_FORMAT ", " PTR_FORMAT ").\n",
-                          card_start, card_start + CardTableModRefBS::card_size_in_words);
-#endif
-
-      HeapRegion* card_region = _g1h->heap_region_containing(card_start);
-      _cards++;
-
-      if (!card_region->is_on_dirty_cards_region_list()) {
-        _g1h->push_dirty_cards_region(card_region);
-      }
-
-      // If the card is dirty, then we will scan it during updateRS.
-      if (!card_region->in_collection_set() &&
-          !_ct_bs->is_card_dirty(card_index)) {
-        scanCard(card_index, card_region);
-      }
+      assert(_num_block_cards < (uint)_block_size, "block overflow");
+      _block_cards[_num_block_cards++] = card_index;
     }
+    scan_claimed_block();
+
     if (!_try_claimed) {
       // Scan the strong code root list attached to the current region
       scan_strong_code_roots(r);
@@ -254,9 +304,30 @@ void G1RemSet::scanRS(G1ParPushHeapRSClosure* oc,
   _cards_scanned[worker_i] = scanRScl.cards_done();
 
   _g1p->phase_times()->record_time_secs(G1GCPhaseTimes::ScanRS, worker_i, scan_rs_time_sec);
+  _g1p->phase_times()->record_thread_work_item(G1GCPhaseTimes::ScanRS, worker_i, scanRScl.cards_done());
   _g1p->phase_times()->record_time_secs(G1GCPhaseTimes::CodeRoots, worker_i, scanRScl.strong_code_root_scan_time_sec());
 }
 
+void G1RemSet::scan_optional_rem_sets(G1ParPushHeapRSClosure* oc,
+                                      CodeBlobClosure* code_root_cl,
+                                      HeapRegion* const* regions,
+                                      uint num_regions,
+                                      uint worker_i) {
+  assert(num_regions > 0, "no optional regions to scan");
+  ScanRSClosure scanRScl(oc, code_root_cl, worker_i, true /* optional */);
+
+  // Spread the workers over the regions in the same way as
+  // start_cset_region_for_worker() does for the collection set.
+  uint n_workers = MAX2(_g1->n_par_threads(), 1u);
+  uint start = (uint) (((size_t) num_regions * worker_i) / n_workers);
+  for (uint pass = 0; pass < 2; pass++) {
+    for (uint i = 0; i < num_regions; i++) {
+      scanRScl.doHeapRegion(regions[(start + i) % num_regions]);
+    }
+    scanRScl.set_try_claimed();
+  }
+}
+
 // Closure used for updating RSets and recording references that
 // point into the collection set. Only called during an
 // evacuation pause.
@@ -415,6 +486,130 @@ void G1RemSet::scrub_par(BitMap* region_bm, BitMap* card_bm,
                                        claim_val);
 }
 
+class G1RebuildRemSetTask: public AbstractGangTask {
+  // Large object arrays are scanned in chunks of this many words so that
+  // the worker can yield in between.
+  static const size_t ChunkWords = 256 * K / HeapWordSize;
+
+  G1CollectedHeap* _g1h;
+  ConcurrentMark* _cm;
+  volatile jint _next_region;
+
+  // Only regions that had a top at rebuild start recorded at remark need
+  // scanning; these were committed at that time and stay so until the
+  // next full collection, which aborts the rebuild.
+  HeapRegion* claim_next_region() {
+    uint index = (uint) Atomic::add(1, &_next_region) - 1;
+    while (index < _g1h->max_regions()) {
+      if (_cm->top_at_rebuild_start(index) != NULL) {
+        return _g1h->region_at(index);
+      }
+      index = (uint) Atomic::add(1, &_next_region) - 1;
+    }
+    return NULL;
+  }
+
+  // Yield if requested. Returns false if the rebuild of the given region
+  // must not continue, either because marking has been aborted or because
+  // the region has been freed in the meantime.
+  bool yield_and_continue(HeapRegion* r, uint worker_id, HeapWord** top_at_rebuild_start) {
+    if (!_cm->do_yield_check(worker_id)) {
+      return true;
+    }
+    if (_cm->has_aborted()) {
+      return false;
+    }
+    *top_at_rebuild_start = _cm->top_at_rebuild_start(r->hrm_index());
+    return *top_at_rebuild_start != NULL;
+  }
+
+  // Scan the part of the given object below the limit, in chunks if it is
+  // a large object array. Returns false if the rebuild of the region
+  // should be abandoned.
+  bool scan_object(HeapRegion* r, oop obj, G1RebuildRemSetClosure* cl,
+                   uint worker_id, HeapWord** top_at_rebuild_start) {
+    if (obj->is_typeArray()) {
+      return true;
+    }
+    HeapWord* start = (HeapWord*)obj;
+    if (!obj->is_objArray() || obj->size() <= (int)ChunkWords) {
+      obj->oop_iterate(cl, MemRegion(start, *top_at_rebuild_start));
+      return true;
+    }
+    HeapWord* end = MIN2(start + obj->size(), *top_at_rebuild_start);
+    for (HeapWord* cur = start; cur < end; cur += ChunkWords) {
+      HeapWord* chunk_end = MIN2(cur + ChunkWords, end);
+      obj->oop_iterate(cl, MemRegion(cur, chunk_end));
+      if (chunk_end < end && !yield_and_continue(r, worker_id, top_at_rebuild_start)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Objects below the next TAMS are live if they are marked; everything
+  // between next TAMS and the top at rebuild start is implicitly live.
+  void rebuild_rem_set_in_region(HeapRegion* r, uint worker_id) {
+    HeapWord* top_at_rebuild_start = _cm->top_at_rebuild_start(r->hrm_index());
+    if (top_at_rebuild_start == NULL) {
+      return;
+    }
+    assert(!r->continuesHumongous(), "should only scan humongous objects from their start region");
+
+    CMBitMapRO* const bitmap = _cm->nextMarkBitMap();
+    HeapWord* const ntams = r->next_top_at_mark_start();
+    G1RebuildRemSetClosure cl(_g1h, worker_id);
+
+    HeapWord* cur = r->bottom();
+    while (cur < top_at_rebuild_start) {
+      if (cur < ntams) {
+        HeapWord* limit = MIN2(ntams, top_at_rebuild_start);
+        cur = bitmap->getNextMarkedWordAddress(cur, limit);
+        if (cur >= limit) {
+          cur = limit;
+          continue;
+        }
+      }
+      oop obj = oop(cur);
+      size_t size = obj->size();
+      if (!scan_object(r, obj, &cl, worker_id, &top_at_rebuild_start)) {
+        return;
+      }
+      cur += size;
+      if (!yield_and_continue(r, worker_id, &top_at_rebuild_start)) {
+        return;
+      }
+    }
+  }
+
+public:
+  G1RebuildRemSetTask(G1CollectedHeap* g1h, ConcurrentMark* cm) :
+    AbstractGangTask("Rebuild Remembered Set"),
+    _g1h(g1h), _cm(cm), _next_region(0) { }
+
+  void work(uint worker_id) {
+    SuspendibleThreadSetJoiner sts;
+
+    HeapRegion* r = claim_next_region();
+    while (r != NULL && !_cm->has_aborted()) {
+      rebuild_rem_set_in_region(r, worker_id);
+      r = claim_next_region();
+    }
+  }
+};
+
+void G1RemSet::rebuild_rem_set(ConcurrentMark* cm,
+                               FlexibleWorkGang* workers,
+                               uint n_workers) {
+  G1RebuildRemSetTask cl(_g1, cm);
+  if (workers != NULL) {
+    workers->set_active_workers((int) n_workers);
+    workers->run_task(&cl);
+  } else {
+    cl.work(0);
+  }
+}
+
 G1TriggerClosure::G1TriggerClosure() :
   _triggered(false) { }
 
@@ -33,6 +33,8 @@
 class G1CollectedHeap;
 class CardTableModRefBarrierSet;
 class ConcurrentG1Refine;
+class ConcurrentMark;
+class FlexibleWorkGang;
 class G1ParPushHeapRSClosure;
 
 // A G1RemSet in which each heap region has a rem set that records the
@@ -111,6 +113,16 @@ public:
               CodeBlobClosure* code_root_cl,
               uint worker_i);
 
+  // Scan the remembered sets of the given optional regions that have
+  // just been added to the collection set. Unlike scanRS() this must
+  // revisit cards already claimed during the initial evacuation and
+  // cards that were refined by updateRS().
+  void scan_optional_rem_sets(G1ParPushHeapRSClosure* oc,
+                              CodeBlobClosure* code_root_cl,
+                              HeapRegion* const* regions,
+                              uint num_regions,
+                              uint worker_i);
+
   void updateRS(DirtyCardQueue* into_cset_dcq, uint worker_i);
 
   CardTableModRefBS* ct_bs() { return _ct_bs; }
@@ -133,6 +145,13 @@ public:
   void scrub_par(BitMap* region_bm, BitMap* card_bm,
                  uint worker_num, int claim_val);
 
+  // Rebuild the remembered sets of the regions selected at remark by
+  // scanning the live objects of all regions that may contain references
+  // into them. Runs concurrently with the mutator; "workers" may be NULL,
+  // in which case the work is done by the calling thread.
+  void rebuild_rem_set(ConcurrentMark* cm, FlexibleWorkGang* workers,
+                       uint n_workers);
+
   // Refine the card corresponding to "card_ptr".
   // If check_for_refs_into_cset is true, a true result is returned
   // if the given card contains oops that have references into the
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc_implementation/g1/g1_globals.hpp"
+#include "gc_implementation/g1/g1RemSetTrackingPolicy.hpp"
+#include "gc_implementation/g1/heapRegion.inline.hpp"
+#include "gc_implementation/g1/heapRegionRemSet.hpp"
+#include "runtime/safepoint.hpp"
+
+bool G1RemSetTrackingPolicy::needs_scan_for_rebuild(HeapRegion* r) const {
+  // All non-young regions need to be scanned for references; at every gc we
+  // gather references to other regions in young regions anyway. Free regions
+  // trivially do not need scanning because they do not contain live objects.
+  return !(r->is_young() || r->is_free());
+}
+
+void G1RemSetTrackingPolicy::update_at_allocate(HeapRegion* r) {
+  if (r->is_young()) {
+    // Always collect remembered set for young regions.
+    r->rem_set()->set_state_complete();
+  } else if (r->isHumongous()) {
+    // Collect remembered sets for humongous regions by default to allow eager reclaim.
+    r->rem_set()->set_state_complete();
+  } else if (r->is_old()) {
+    // By default, do not create remembered set for new old regions; they are
+    // only picked up for rebuild at the next remark.
+    if (G1RebuildRemSets) {
+      r->rem_set()->set_state_empty();
+    } else {
+      r->rem_set()->set_state_complete();
+    }
+  } else {
+    guarantee(false, err_msg("Unhandled region %u with heap region type %s",
+                             r->hrm_index(), r->get_type_str()));
+  }
+}
+
+bool G1RemSetTrackingPolicy::update_before_rebuild(HeapRegion* r, size_t live_bytes) {
+  assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
+
+  if (!G1RebuildRemSets || !r->is_old() || r->rem_set()->is_tracked()) {
+    return false;
+  }
+
+  // Only consider old regions that are likely to be added to the collection
+  // set candidates: they must contain some live data (completely empty
+  // regions are reclaimed at cleanup anyway) but not too much of it.
+  size_t const live_threshold = HeapRegion::GrainBytes * G1MixedGCLiveThresholdPercent / 100;
+  if (live_bytes > 0 && live_bytes < live_threshold) {
+    r->rem_set()->set_state_updating();
+    return true;
+  }
+  return false;
+}
+
+void G1RemSetTrackingPolicy::update_after_rebuild(HeapRegion* r) {
+  assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
+
+  if (r->rem_set()->is_updating()) {
+    r->rem_set()->set_state_complete();
+  }
+}
+
+void G1RemSetTrackingPolicy::update_for_non_candidate(HeapRegion* r) {
+  assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
+
+  if (G1RebuildRemSets && r->is_old() && r->rem_set()->is_tracked()) {
+    // Keep the code roots, they are needed to find oops in nmethods
+    // pointing into this region independent of the card set.
+    r->rem_set()->clear(true /* only_cardset */);
+    r->rem_set()->set_state_empty();
+  }
+}
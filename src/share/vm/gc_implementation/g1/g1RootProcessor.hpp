@@ -35,6 +35,7 @@ class G1CollectedHeap;
 class G1GCPhaseTimes;
 class G1ParPushHeapRSClosure;
 class G1RootClosures;
+class HeapRegion;
 class Monitor;
 class OopClosure;
 class SubTasksDone;
@@ -128,6 +129,15 @@ public:
                             OopClosure* scan_non_heap_weak_roots,
                             uint worker_i);
 
+  // Apply scan_rs to all locations in the remembered sets of the given
+  // optional regions, which have been added to the collection set after
+  // the initial evacuation of the pause.
+  void scan_optional_remembered_sets(G1ParPushHeapRSClosure* scan_rs,
+                                     OopClosure* scan_non_heap_weak_roots,
+                                     HeapRegion* const* regions,
+                                     uint num_regions,
+                                     uint worker_i);
+
   // Apply oops, clds and blobs to strongly and weakly reachable roots in the system,
   // the only thing different from process_all_roots is that we skip the string table
   // to avoid keeping every string live when doing class unloading.
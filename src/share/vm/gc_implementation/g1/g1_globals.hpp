@@ -289,6 +289,27 @@
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
                                                                             \
+  product(bool, G1RebuildRemSets, true,                                     \
+          "Only maintain remembered sets of old regions that are likely "   \
+          "to be collected, rebuilding them concurrently after marking.")   \
+                                                                            \
+  product(bool, G1UseAdaptiveIHOP, true,                                    \
+          "Adaptively adjust InitiatingHeapOccupancyPercent from the "      \
+          "initial value based on the predicted old gen allocation rate "   \
+          "and concurrent marking duration. If "                            \
+          "InitiatingHeapOccupancyPercent is set explicitly, this is "      \
+          "disabled unless also set explicitly.")                           \
+                                                                            \
+  experimental(uintx, G1AdaptiveIHOPNumInitialSamples, 3,                   \
+          "How many completed time periods from initial mark to first "     \
+          "mixed gc are required to use the input values for prediction "   \
+          "of the optimal occupancy to start marking.")                     \
+                                                                            \
+  product(bool, G1UseOptionalCSet, true,                                    \
+          "Let mixed GCs mark old regions beyond those that fit the pause " \
+          "time prediction as optional, and evacuate them at the end of "   \
+          "the pause only as long as pause time remains.")                  \
+                                                                            \
   experimental(ccstr, G1LogLevel, NULL,                                     \
           "Log level for G1 logging: fine, finer, finest")                  \
                                                                             \
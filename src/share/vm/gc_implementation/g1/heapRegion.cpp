@@ -171,6 +171,10 @@ void HeapRegion::hr_clear(bool par, bool clear_space, bool locked) {
   set_free();
   reset_pre_dummy_top();
 
+  // Stop tracking incoming references right away; in the parallel case the
+  // card set itself is only cleared later.
+  rem_set()->set_state_empty();
+
   if (!par) {
     // If this is parallel, this will be done later.
     HeapRegionRemSet* hrrs = rem_set();
@@ -703,6 +707,7 @@ void HeapRegion::print_on(outputStream* st) const {
   st->print(" TS %5d", _gc_time_stamp);
   st->print(" PTAMS " PTR_FORMAT " NTAMS " PTR_FORMAT,
             prev_top_at_mark_start(), next_top_at_mark_start());
+  st->print(" RS %-9s", rem_set()->get_state_str());
   G1OffsetTableContigSpace::print_on(st);
 }
 
@@ -831,7 +836,8 @@ public:
       HeapRegion* to   = _g1h->heap_region_containing(obj);
       if (from != NULL && to != NULL &&
           from != to &&
-          !to->isHumongous()) {
+          !to->isHumongous() &&
+          to->rem_set()->is_complete()) {
         jbyte cv_obj = *_bs->byte_for_const(_containing_obj);
         jbyte cv_field = *_bs->byte_for_const(p);
         const jbyte dirty = CardTableModRefBS::dirty_card_val();
@@ -857,15 +857,28 @@ OtherRegionsTable::do_cleanup_work(HRRSCleanupTask* hrrs_cleanup_task) {
 // Determines how many threads can add records to an rset in parallel.
 // This can be done by either mutator threads together with the
 // concurrent refinement threads or GC threads.
+// The concurrent remembered set rebuild runs alongside mutator and
+// refinement threads, so its workers get their own range of ids.
 uint HeapRegionRemSet::num_par_rem_sets() {
-  return MAX2(DirtyCardQueueSet::num_par_ids() + ConcurrentG1Refine::thread_num(), (uint)ParallelGCThreads);
+  uint n_conc_workers = MAX2((uint)ConcGCThreads, 1U);
+  return MAX2(DirtyCardQueueSet::num_par_ids() + ConcurrentG1Refine::thread_num() + n_conc_workers,
+              (uint)ParallelGCThreads);
 }
 
+uint HeapRegionRemSet::rebuild_par_id(uint worker_id) {
+  uint par_id = DirtyCardQueueSet::num_par_ids() + ConcurrentG1Refine::thread_num() + worker_id;
+  assert(par_id < num_par_rem_sets(), "out of range");
+  return par_id;
+}
+
+const char* HeapRegionRemSet::_state_strings[] =  {"Untracked", "Updating", "Complete"};
+
 HeapRegionRemSet::HeapRegionRemSet(G1BlockOffsetSharedArray* bosa,
                                    HeapRegion* hr)
   : _bosa(bosa),
     _m(Mutex::leaf, FormatBuffer<128>("HeapRegionRemSet lock #%u", hr->hrm_index()), true),
-    _code_roots(), _other_regions(hr, &_m), _iter_state(Unclaimed), _iter_claimed(0) {
+    _code_roots(), _other_regions(hr, &_m), _state(Untracked),
+    _iter_state(Unclaimed), _iter_claimed(0) {
   reset_for_par_iteration();
 }
 
@@ -890,11 +903,11 @@ bool HeapRegionRemSet::claim_iter() {
 }
 
 void HeapRegionRemSet::set_iter_complete() {
-  _iter_state = Complete;
+  _iter_state = Finished;
 }
 
 bool HeapRegionRemSet::iter_is_complete() {
-  return _iter_state == Complete;
+  return _iter_state == Finished;
 }
 
 #ifndef PRODUCT
@@ -923,13 +936,15 @@ void HeapRegionRemSet::cleanup() {
   SparsePRT::cleanup_all();
 }
 
-void HeapRegionRemSet::clear() {
+void HeapRegionRemSet::clear(bool only_cardset) {
   MutexLockerEx x(&_m, Mutex::_no_safepoint_check_flag);
-  clear_locked();
+  clear_locked(only_cardset);
 }
 
-void HeapRegionRemSet::clear_locked() {
-  _code_roots.clear();
+void HeapRegionRemSet::clear_locked(bool only_cardset) {
+  if (!only_cardset) {
+    _code_roots.clear();
+  }
   _other_regions.clear();
   assert(occupied_locked() == 0, "Should be clear.");
   reset_for_par_iteration();
@@ -1269,6 +1284,7 @@ void HeapRegionRemSet::test() {
   HeapWord* hr3_last = hr3->end() - 1;
 
   HeapRegionRemSet* hrrs = hr0->rem_set();
+  hrrs->set_state_complete();
 
   // Make three references from region 0x101...
   hrrs->add_reference((OopOrNarrowOopStar)hr1_start);
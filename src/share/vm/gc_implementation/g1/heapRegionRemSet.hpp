@@ -247,7 +247,21 @@ private:
 
   OtherRegionsTable _other_regions;
 
-  enum ParIterState { Unclaimed, Claimed, Complete };
+  // Tracking state of the remembered set. Only remembered sets in the
+  // Updating or Complete state record incoming references; see
+  // G1RemSetTrackingPolicy for the transitions between the states.
+  enum RemSetState {
+    Untracked,
+    Updating,
+    Complete
+  };
+
+  // Read by the concurrent mark and refinement threads
+  volatile RemSetState _state;
+
+  static const char* _state_strings[];
+
+  enum ParIterState { Unclaimed, Claimed, Finished };
   volatile ParIterState _iter_state;
   volatile jlong _iter_claimed;
 
@@ -270,6 +284,10 @@ public:
   HeapRegionRemSet(G1BlockOffsetSharedArray* bosa, HeapRegion* hr);
 
   static uint num_par_rem_sets();
+  // The id used by the given concurrent marking worker when adding
+  // references during the concurrent remembered set rebuild. These ids
+  // are disjoint from the ones used by mutator and refinement threads.
+  static uint rebuild_par_id(uint worker_id);
   static void setup_remset_size();
 
   HeapRegion* hr() const {
@@ -303,13 +321,48 @@ public:
 
   static jint n_coarsenings() { return OtherRegionsTable::n_coarsenings(); }
 
+  const char* get_state_str() const { return _state_strings[_state]; }
+
+  bool is_tracked() const { return _state != Untracked; }
+  bool is_updating() const { return _state == Updating; }
+  bool is_complete() const { return _state == Complete; }
+
+  // Stop recording incoming references. The caller is responsible for
+  // clearing any entries already recorded.
+  void set_state_empty() {
+    guarantee(SafepointSynchronize::is_at_safepoint() || !is_tracked(),
+              "Should only set to Untracked during safepoint");
+    if (_state == Untracked) {
+      return;
+    }
+    clear_fcc();
+    _state = Untracked;
+  }
+
+  // Start recording incoming references while the existing ones are
+  // collected by the concurrent remembered set rebuild.
+  void set_state_updating() {
+    guarantee(SafepointSynchronize::is_at_safepoint() && !is_tracked(),
+              "Should only set to Updating from Untracked during safepoint");
+    clear_fcc();
+    _state = Updating;
+  }
+
+  void set_state_complete() {
+    clear_fcc();
+    _state = Complete;
+  }
+
   // Used in the sequential case.
   void add_reference(OopOrNarrowOopStar from) {
-    _other_regions.add_reference(from, 0);
+    add_reference(from, 0);
   }
 
   // Used in the parallel case.
   void add_reference(OopOrNarrowOopStar from, int tid) {
+    if (!is_tracked()) {
+      return;
+    }
     _other_regions.add_reference(from, tid);
   }
 
@@ -318,9 +371,13 @@ public:
   void scrub(CardTableModRefBS* ctbs, BitMap* region_bm, BitMap* card_bm);
 
   // The region is being reclaimed; clear its remset, and any mention of
-  // entries for this region in other remsets.
-  void clear();
-  void clear_locked();
+  // entries for this region in other remsets. If only_cardset is true,
+  // the strong code roots are kept.
+  void clear(bool only_cardset = false);
+  void clear_locked(bool only_cardset = false);
+
+  // Specifically clear the from_card_cache.
+  void clear_fcc() { _other_regions.clear_fcc(); }
 
   // Attempt to claim the region.  Returns true iff this call caused an
   // atomic transition from Unclaimed to Claimed.
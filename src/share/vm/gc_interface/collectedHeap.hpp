@@ -42,6 +42,7 @@
 class AdaptiveSizePolicy;
 class BarrierSet;
 class CollectorPolicy;
+class FlexibleWorkGang;
 class GCHeapSummary;
 class GCTimer;
 class GCTracer;
@@ -588,6 +589,11 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Iterator for all GC threads (other than VM thread)
   virtual void gc_threads_do(ThreadClosure* tc) const = 0;
 
+  // Work gang that may be used for parallel safepoint cleanup, or NULL
+  // if this heap has none. Only used while the gang is otherwise idle,
+  // i.e. at a safepoint before the VM operation runs.
+  virtual FlexibleWorkGang* get_safepoint_workers() { return NULL; }
+
   // Print any relevant tracing info that flags imply.
   // Default implementation does nothing.
   virtual void print_tracing_info() const = 0;
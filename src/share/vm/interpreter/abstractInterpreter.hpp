@@ -100,6 +100,10 @@ class AbstractInterpreter: AllStatic {
     java_util_zip_CRC32_update,                                 // implementation of java.util.zip.CRC32.update()
     java_util_zip_CRC32_updateBytes,                            // implementation of java.util.zip.CRC32.updateBytes()
     java_util_zip_CRC32_updateByteBuffer,                       // implementation of java.util.zip.CRC32.updateByteBuffer()
+    java_util_zip_CRC32C_updateBytes,                           // implementation of java.util.zip.CRC32C.updateBytes(crc, b[], off, end)
+    java_util_zip_CRC32C_updateDirectByteBuffer,                // implementation of java.util.zip.CRC32C.updateDirectByteBuffer(crc, address, off, end)
+    java_util_zip_Adler32_updateBytes,                          // implementation of java.util.zip.Adler32.updateBytes()
+    java_util_zip_Adler32_updateByteBuffer,                     // implementation of java.util.zip.Adler32.updateByteBuffer()
     number_of_method_entries,
     invalid = -1
   };
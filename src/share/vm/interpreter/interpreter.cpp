@@ -204,6 +204,20 @@ AbstractInterpreter::MethodKind AbstractInterpreter::method_kind(methodHandle m)
       case vmIntrinsics::_updateByteBufferCRC32  : return java_util_zip_CRC32_updateByteBuffer;
     }
   }
+  if (UseCRC32CIntrinsics) {
+    // Use optimized stub code for CRC32C methods.
+    switch (m->intrinsic_id()) {
+      case vmIntrinsics::_updateBytesCRC32C             : return java_util_zip_CRC32C_updateBytes;
+      case vmIntrinsics::_updateDirectByteBufferCRC32C  : return java_util_zip_CRC32C_updateDirectByteBuffer;
+    }
+  }
+  if (UseAdler32Intrinsics && m->is_native()) {
+    // Use optimized stub code for Adler32 native methods.
+    switch (m->intrinsic_id()) {
+      case vmIntrinsics::_updateBytesAdler32       : return java_util_zip_Adler32_updateBytes;
+      case vmIntrinsics::_updateByteBufferAdler32  : return java_util_zip_Adler32_updateByteBuffer;
+    }
+  }
 #endif
 
   // Native method?
@@ -311,6 +325,10 @@ void AbstractInterpreter::print_method_kind(MethodKind kind) {
     case java_util_zip_CRC32_update           : tty->print("java_util_zip_CRC32_update"); break;
     case java_util_zip_CRC32_updateBytes      : tty->print("java_util_zip_CRC32_updateBytes"); break;
     case java_util_zip_CRC32_updateByteBuffer : tty->print("java_util_zip_CRC32_updateByteBuffer"); break;
+    case java_util_zip_CRC32C_updateBytes     : tty->print("java_util_zip_CRC32C_updateBytes"); break;
+    case java_util_zip_CRC32C_updateDirectByteBuffer : tty->print("java_util_zip_CRC32C_updateDirectByteBuffer"); break;
+    case java_util_zip_Adler32_updateBytes    : tty->print("java_util_zip_Adler32_updateBytes"); break;
+    case java_util_zip_Adler32_updateByteBuffer : tty->print("java_util_zip_Adler32_updateByteBuffer"); break;
     default:
       if (kind >= method_handle_invoke_FIRST &&
           kind <= method_handle_invoke_LAST) {
@@ -1620,6 +1620,22 @@ static void wrap_invokedynamic_exception(TRAPS) {
   }
 }
 
+// Each invokedynamic instruction has its own cache entry, even if several
+// of them name the same CONSTANT_InvokeDynamic.  For the LambdaMetafactory
+// bootstrap methods the call site only depends on the caller class and the
+// constant, and the lambda objects it produces need not be distinct, so a
+// site already linked for the same constant can be reused instead of
+// making another upcall and spinning another lambda class.  The cache maps
+// each such entry to the first one for its constant, which is linked along
+// with whichever of them is linked first.
+static ConstantPoolCacheEntry* find_linked_lambda_call_site(constantPoolHandle pool, ConstantPoolCacheEntry* cpce) {
+  ConstantPoolCacheEntry* site = pool->cache()->lambda_call_site_at(cpce);
+  if (site != cpce && !site->is_f1_null()) {
+    return site;
+  }
+  return NULL;
+}
+
 void LinkResolver::resolve_invokedynamic(CallInfo& result, constantPoolHandle pool, int index, TRAPS) {
   assert(EnableInvokeDynamic, "");
 
@@ -1632,6 +1648,13 @@ void LinkResolver::resolve_invokedynamic(CallInfo& result, constantPoolHandle po
   Handle bootstrap_specifier;
   // Check if CallSite has been bound already:
   ConstantPoolCacheEntry* cpce = pool->invokedynamic_cp_cache_entry_at(index);
+  if (cpce->is_f1_null() && ShareLambdaCallSites) {
+    // or if another instruction has bound it for the same constant
+    ConstantPoolCacheEntry* linked = find_linked_lambda_call_site(pool, cpce);
+    if (linked != NULL) {
+      cpce = linked;
+    }
+  }
   if (cpce->is_f1_null()) {
     int pool_index = cpce->constant_pool_index();
     oop bsm_info = pool->resolve_bootstrap_specifier_at(pool_index, THREAD);
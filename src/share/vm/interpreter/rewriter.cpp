@@ -95,6 +95,7 @@ void Rewriter::make_constant_pool_cache(TRAPS) {
                                         CHECK);
   _pool->set_cache(cache);
   cache->set_constant_pool(_pool());
+  cache->initialize_lambda_call_sites(loader_data, _invokedynamic_cp_cache_map.length(), CHECK);
 }
 
 
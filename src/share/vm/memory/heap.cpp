@@ -227,6 +227,24 @@ void* CodeHeap::allocate(size_t instance_size, bool is_critical) {
 }
 
 
+void* CodeHeap::allocate_below(size_t instance_size, void* limit) {
+  size_t number_of_segments = size_to_segments(instance_size + sizeof(HeapBlock));
+  assert(segments_to_size(number_of_segments) >= sizeof(FreeBlock), "not enough room for FreeList");
+
+  debug_only(verify());
+  HeapBlock* block = search_freelist(number_of_segments, false, limit);
+  debug_only(if (VerifyCodeCacheOften) verify());
+  if (block == NULL) {
+    return NULL;
+  }
+  assert((void*)following_block((FreeBlock*)block) <= limit, "must end below limit");
+#ifdef ASSERT
+  memset((void *)block->allocated_space(), badCodeHeapNewVal, instance_size);
+#endif
+  return block->allocated_space();
+}
+
+
 void CodeHeap::deallocate(void* p) {
   assert(p == find_start(p), "illegal deallocation");
   // Find start of HeapBlock
@@ -319,6 +337,16 @@ size_t CodeHeap::allocated_capacity() const {
   return segments_to_size(_next_segment - _freelist_segments);
 }
 
+size_t CodeHeap::largest_free_block() const {
+  size_t len = 0;
+  for (FreeBlock* b = _freelist; b != NULL; b = b->link()) {
+    if (b->length() > len) {
+      len = b->length();
+    }
+  }
+  return segments_to_size(len);
+}
+
 // Returns size of the unallocated heap block
 size_t CodeHeap::heap_unallocated_capacity() const {
   // Total number of segments - number currently used
@@ -397,8 +425,9 @@ void CodeHeap::add_to_freelist(HeapBlock *a) {
 }
 
 // Search freelist for an entry on the list with the best fit
-// Return NULL if no one was found
-FreeBlock* CodeHeap::search_freelist(size_t length, bool is_critical) {
+// Return NULL if no one was found. If limit is not NULL, only
+// entries that end at or below limit are considered.
+FreeBlock* CodeHeap::search_freelist(size_t length, bool is_critical, void* limit) {
   FreeBlock *best_block = NULL;
   FreeBlock *best_prev  = NULL;
   size_t best_length = 0;
@@ -408,6 +437,10 @@ FreeBlock* CodeHeap::search_freelist(size_t length, bool is_critical) {
   FreeBlock *cur = _freelist;
   while(cur != NULL) {
     size_t l = cur->length();
+    if (limit != NULL && (void*)following_block(cur) > limit) {
+      // the freelist is sorted by address - all consecutive entries end above limit.
+      break;
+    }
     if (l >= length && (best_block == NULL || best_length > l)) {
 
       // Non critical allocations are not allowed to use the last part of the code heap.
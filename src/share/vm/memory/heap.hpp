@@ -110,7 +110,7 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock *b);
-  FreeBlock* search_freelist(size_t length, bool is_critical);
+  FreeBlock* search_freelist(size_t length, bool is_critical, void* limit = NULL);
 
   // Iteration helpers
   void*      next_free(HeapBlock* b) const;
@@ -133,6 +133,7 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   // Memory allocation
   void* allocate  (size_t size, bool is_critical);  // allocates a block of size or returns NULL
+  void* allocate_below(size_t size, void* limit); // allocates a free list block that ends at or below limit or returns NULL
   void  deallocate(void* p);                     // deallocates a block
 
   // Attributes
@@ -158,6 +159,8 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t max_capacity() const;
   size_t allocated_capacity() const;
   size_t unallocated_capacity() const            { return max_capacity() - allocated_capacity(); }
+  size_t freelist_capacity() const               { return segments_to_size(_freelist_segments); }
+  size_t largest_free_block() const;
 
 private:
   size_t heap_unallocated_capacity() const;
@@ -42,9 +42,27 @@ GlobalTLABStats* ThreadLocalAllocBuffer::_global_stats   = NULL;
 
 void ThreadLocalAllocBuffer::clear_before_allocation() {
   _slow_refill_waste += (unsigned)remaining();
+  record_waste(remaining());
   make_parsable(true);   // also retire the TLAB
 }
 
+uint ThreadLocalAllocBuffer::waste_histogram_bucket(size_t waste, size_t size) {
+  size_t percent = size == 0 ? 0 : waste * 100 / size;
+  uint bucket = 0;
+  while (percent > 0 && bucket < WasteHistogramBuckets - 1) {
+    percent >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+void ThreadLocalAllocBuffer::record_waste(size_t waste) {
+  if (end() == NULL) {
+    return;
+  }
+  _waste_histogram[waste_histogram_bucket(waste, pointer_delta(hard_end(), start()))]++;
+}
+
 void ThreadLocalAllocBuffer::accumulate_statistics_before_gc() {
   global_stats()->initialize();
 
@@ -68,10 +86,17 @@ void ThreadLocalAllocBuffer::accumulate_statistics() {
   size_t used     = Universe::heap()->tlab_used(thread);
 
   _gc_waste += (unsigned)remaining();
+  record_waste(remaining());
   size_t total_allocated = thread->allocated_bytes();
   size_t allocated_since_last_gc = total_allocated - _allocated_before_last_gc;
   _allocated_before_last_gc = total_allocated;
 
+  if (TLABElasticSizing) {
+    // Sample idle threads too, so that their tlabs shrink instead of
+    // keeping eden space they do not use.
+    _allocation_rate.sample((float) (allocated_since_last_gc / HeapWordSize));
+  }
+
   if (PrintTLAB && (_number_of_refills > 0 || Verbose)) {
     print_stats("gc");
   }
@@ -98,6 +123,7 @@ void ThreadLocalAllocBuffer::accumulate_statistics() {
     global_stats()->update_gc_waste(_gc_waste);
     global_stats()->update_slow_refill_waste(_slow_refill_waste);
     global_stats()->update_fast_refill_waste(_fast_refill_waste);
+    global_stats()->update_waste_histogram(_waste_histogram);
 
   } else {
     assert(_number_of_refills == 0 && _fast_refill_waste == 0 &&
@@ -144,9 +170,14 @@ void ThreadLocalAllocBuffer::resize_all_tlabs() {
 void ThreadLocalAllocBuffer::resize() {
   // Compute the next tlab size using expected allocation amount
   assert(ResizeTLAB, "Should not call this otherwise");
-  size_t alloc = (size_t)(_allocation_fraction.average() *
-                          (Universe::heap()->tlab_capacity(myThread()) / HeapWordSize));
-  size_t new_size = alloc / _target_refills;
+  size_t capacity = Universe::heap()->tlab_capacity(myThread()) / HeapWordSize;
+  size_t new_size;
+  if (TLABElasticSizing) {
+    new_size = elastic_desired_size(capacity);
+  } else {
+    size_t alloc = (size_t)(_allocation_fraction.average() * capacity);
+    new_size = alloc / _target_refills;
+  }
 
   new_size = MIN2(MAX2(new_size, min_size()), max_size());
 
@@ -162,18 +193,37 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+// Size the tlab from what this thread allocated between the recent gcs,
+// so that threads with very different allocation rates get tlabs sized
+// for their own rate rather than for an equal share of eden.
+size_t ThreadLocalAllocBuffer::elastic_desired_size(size_t capacity) {
+  size_t alloc = MIN2((size_t) _allocation_rate.average(), capacity);
+  return alloc / _target_refills;
+}
+
 void ThreadLocalAllocBuffer::initialize_statistics() {
     _number_of_refills = 0;
     _fast_refill_waste = 0;
     _slow_refill_waste = 0;
     _gc_waste          = 0;
     _slow_allocations  = 0;
+    for (uint i = 0; i < WasteHistogramBuckets; i++) {
+      _waste_histogram[i] = 0;
+    }
 }
 
 void ThreadLocalAllocBuffer::fill(HeapWord* start,
                                   HeapWord* top,
                                   size_t    new_size) {
   _number_of_refills++;
+  if (TLABElasticSizing && ResizeTLAB &&
+      _number_of_refills % target_refills() == 0 &&
+      desired_size() < max_size()) {
+    // The thread allocates faster than its tlab size was learned for;
+    // grow the tlab now rather than taking many more slow path
+    // refills until the next gc resizes it.
+    set_desired_size(align_object_size(MIN2(desired_size() * 2, max_size())));
+  }
   if (PrintTLAB && Verbose) {
     print_stats("fill");
   }
@@ -209,6 +259,7 @@ void ThreadLocalAllocBuffer::initialize() {
     // Keep alloc_frac as float and not double to avoid the double to float conversion
     float alloc_frac = desired_size() * target_refills() / (float) capacity;
     _allocation_fraction.sample(alloc_frac);
+    _allocation_rate.sample((float) (desired_size() * target_refills()));
   }
 
   set_refill_waste_limit(initial_refill_waste_limit());
@@ -354,6 +405,13 @@ GlobalTLABStats::GlobalTLABStats() :
     cname = PerfDataManager::counter_name("tlab", "maxSlowAlloc");
     _perf_max_slow_allocations =
       PerfDataManager::create_variable(SUN_GC, cname, PerfData::U_None, CHECK);
+
+    for (uint i = 0; i < ThreadLocalAllocBuffer::WasteHistogramBuckets; i++) {
+      const char* ns = PerfDataManager::name_space("tlab.wasteHisto", (int) i);
+      cname = PerfDataManager::counter_name(ns, "tlabs");
+      _perf_waste_histogram[i] =
+        PerfDataManager::create_variable(SUN_GC, cname, PerfData::U_None, CHECK);
+    }
   }
 }
 
@@ -371,6 +429,9 @@ void GlobalTLABStats::initialize() {
   _max_fast_refill_waste   = 0;
   _total_slow_allocations  = 0;
   _max_slow_allocations    = 0;
+  for (uint i = 0; i < ThreadLocalAllocBuffer::WasteHistogramBuckets; i++) {
+    _waste_histogram[i] = 0;
+  }
 }
 
 void GlobalTLABStats::publish() {
@@ -388,6 +449,9 @@ void GlobalTLABStats::publish() {
     _perf_max_fast_refill_waste->set_value(_max_fast_refill_waste);
     _perf_slow_allocations     ->set_value(_total_slow_allocations);
     _perf_max_slow_allocations ->set_value(_max_slow_allocations);
+    for (uint i = 0; i < ThreadLocalAllocBuffer::WasteHistogramBuckets; i++) {
+      _perf_waste_histogram[i]->set_value(_waste_histogram[i]);
+    }
   }
 }
 
@@ -410,4 +474,9 @@ void GlobalTLABStats::print() {
                       _max_slow_refill_waste * HeapWordSize,
                       _total_fast_refill_waste * HeapWordSize,
                       _max_fast_refill_waste * HeapWordSize);
+  gclog_or_tty->print("TLAB waste histogram (<1%%, <2%%, <4%%, <8%%, <16%%, <32%%, <64%%, rest):");
+  for (uint i = 0; i < ThreadLocalAllocBuffer::WasteHistogramBuckets; i++) {
+    gclog_or_tty->print(" %u", _waste_histogram[i]);
+  }
+  gclog_or_tty->cr();
 }
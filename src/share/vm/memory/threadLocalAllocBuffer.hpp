@@ -38,6 +38,12 @@ class GlobalTLABStats;
 //            used to make it available for such multiplexing.
 class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   friend class VMStructs;
+public:
+  // Number of buckets of the waste histograms. Bucket 0 counts the
+  // retired TLABs that wasted less than 1% of their size, bucket i
+  // those that wasted [2^(i-1)%, 2^i%), and the last bucket the rest.
+  enum { WasteHistogramBuckets = 8 };
+
 private:
   HeapWord* _start;                              // address of TLAB
   HeapWord* _top;                                // address after last allocation
@@ -55,8 +61,10 @@ private:
   unsigned  _slow_refill_waste;
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
+  unsigned  _waste_histogram[WasteHistogramBuckets]; // retired tlabs by wasted fraction
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
+  AdaptiveWeightedAverage _allocation_rate;      // words allocated by the thread between gcs
 
   void accumulate_statistics();
   void initialize_statistics();
@@ -85,6 +93,14 @@ private:
 
   void initialize(HeapWord* start, HeapWord* top, HeapWord* end);
 
+  // Record the space left in the current tlab, which is about to be
+  // retired, in the waste histogram.
+  void record_waste(size_t waste);
+  static uint waste_histogram_bucket(size_t waste, size_t size);
+
+  // Size of the next tlab when TLABElasticSizing is on.
+  size_t elastic_desired_size(size_t capacity);
+
   void print_stats(const char* tag);
 
   Thread* myThread();
@@ -101,7 +117,9 @@ private:
   static GlobalTLABStats* global_stats() { return _global_stats; }
 
 public:
-  ThreadLocalAllocBuffer() : _allocation_fraction(TLABAllocationWeight), _allocated_before_last_gc(0) {
+  ThreadLocalAllocBuffer() : _allocation_fraction(TLABAllocationWeight),
+                             _allocation_rate(TLABAllocationWeight),
+                             _allocated_before_last_gc(0) {
     // do nothing.  tlabs must be inited by initialize() calls
   }
 
@@ -195,6 +213,7 @@ private:
   size_t   _max_fast_refill_waste;
   unsigned _total_slow_allocations;
   unsigned _max_slow_allocations;
+  unsigned _waste_histogram[ThreadLocalAllocBuffer::WasteHistogramBuckets];
 
   PerfVariable* _perf_allocating_threads;
   PerfVariable* _perf_total_refills;
@@ -208,6 +227,7 @@ private:
   PerfVariable* _perf_max_fast_refill_waste;
   PerfVariable* _perf_slow_allocations;
   PerfVariable* _perf_max_slow_allocations;
+  PerfVariable* _perf_waste_histogram[ThreadLocalAllocBuffer::WasteHistogramBuckets];
 
   AdaptiveWeightedAverage _allocating_threads_avg;
 
@@ -259,6 +279,11 @@ public:
     _total_slow_allocations += value;
     _max_slow_allocations    = MAX2(_max_slow_allocations, value);
   }
+  void update_waste_histogram(const unsigned* histogram) {
+    for (uint i = 0; i < ThreadLocalAllocBuffer::WasteHistogramBuckets; i++) {
+      _waste_histogram[i] += histogram[i];
+    }
+  }
 };
 
 #endif // SHARE_VM_MEMORY_THREADLOCALALLOCBUFFER_HPP
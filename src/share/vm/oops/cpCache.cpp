@@ -26,6 +26,8 @@
 #include "gc_implementation/shared/markSweep.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/rewriter.hpp"
+#include "memory/metadataFactory.hpp"
+#include "memory/resourceArea.hpp"
 #include "memory/universe.inline.hpp"
 #include "oops/cpCache.hpp"
 #include "oops/objArrayOop.hpp"
@@ -35,6 +37,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/orderAccess.inline.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/resourceHash.hpp"
 #if INCLUDE_ALL_GCS
 # include "gc_implementation/parallelScavenge/psPromotionManager.hpp"
 #endif // INCLUDE_ALL_GCS
@@ -291,6 +294,12 @@ void ConstantPoolCacheEntry::set_method_handle(constantPoolHandle cpool, const C
 
 void ConstantPoolCacheEntry::set_dynamic_call(constantPoolHandle cpool, const CallInfo &call_info) {
   set_method_handle_common(cpool, Bytecodes::_invokedynamic, call_info);
+  // Link the first instruction of a shared lambda call site as well, so
+  // that the others find it (see LinkResolver::resolve_invokedynamic())
+  ConstantPoolCacheEntry* site = cpool->cache()->lambda_call_site_at(this);
+  if (site != this) {
+    site->set_method_handle_common(cpool, Bytecodes::_invokedynamic, call_info);
+  }
 }
 
 void ConstantPoolCacheEntry::set_method_handle_common(constantPoolHandle cpool,
@@ -602,6 +611,72 @@ void ConstantPoolCache::initialize(const intArray& inverse_index_map,
   }
 }
 
+// True if the CONSTANT_InvokeDynamic at cp_index bootstraps with
+// LambdaMetafactory.metafactory or altMetafactory, whose call site only
+// depends on the caller class and the constant.
+static bool is_lambda_call_site(ConstantPool* cp, int cp_index) {
+  int bsm_index = cp->invoke_dynamic_bootstrap_method_ref_index_at(cp_index);
+  if (!cp->tag_at(bsm_index).is_method_handle() ||
+      cp->method_handle_ref_kind_at(bsm_index) != JVM_REF_invokeStatic) {
+    return false;
+  }
+  Symbol* bsm_name = cp->method_handle_name_ref_at(bsm_index);
+  if (bsm_name != vmSymbols::metafactory_name() &&
+      bsm_name != vmSymbols::altMetafactory_name()) {
+    return false;
+  }
+  int klass_index = cp->method_handle_klass_index_at(bsm_index);
+  return cp->klass_name_at(klass_index) == vmSymbols::java_lang_invoke_LambdaMetafactory();
+}
+
+void ConstantPoolCache::initialize_lambda_call_sites(ClassLoaderData* loader_data, int indy_count, TRAPS) {
+  assert(_lambda_call_sites == NULL, "only once");
+  if (!ShareLambdaCallSites || indy_count < 2) {
+    return;
+  }
+  Array<int>* sites = MetadataFactory::new_array<int>(loader_data, indy_count, CHECK);
+  ResourceMark rm(THREAD);
+  // Call sites are keyed by bootstrap specifier and name and type, so that
+  // equal CONSTANT_InvokeDynamic entries share one as well.
+  ResourceHashtable<juint, int> first_site;
+  ConstantPool* cp = constant_pool();
+  int indy_base = length() - indy_count;
+  for (int i = 0; i < indy_count; i++) {
+    int cache_index = indy_base + i;
+    int cp_index = entry_at(cache_index)->constant_pool_index();
+    int site = cache_index;
+    if (is_lambda_call_site(cp, cp_index)) {
+      juint key = ((juint) cp->invoke_dynamic_bootstrap_specifier_index(cp_index) << 16) |
+                  (juint) cp->invoke_dynamic_name_and_type_ref_index_at(cp_index);
+      int* first = first_site.get(key);
+      if (first != NULL) {
+        site = *first;
+      } else {
+        first_site.put(key, cache_index);
+      }
+    }
+    sites->at_put(i, site);
+  }
+  _lambda_call_sites = sites;
+}
+
+ConstantPoolCacheEntry* ConstantPoolCache::lambda_call_site_at(ConstantPoolCacheEntry* e) const {
+  if (_lambda_call_sites == NULL) {
+    return e;
+  }
+  int cache_index = e - entry_at(0);
+  int i = cache_index - (length() - _lambda_call_sites->length());
+  assert(0 <= i && i < _lambda_call_sites->length(), "not an invokedynamic entry");
+  return entry_at(_lambda_call_sites->at(i));
+}
+
+void ConstantPoolCache::deallocate_contents(ClassLoaderData* data) {
+  if (_lambda_call_sites != NULL) {
+    MetadataFactory::free_array<int>(data, _lambda_call_sites);
+    _lambda_call_sites = NULL;
+  }
+}
+
 #if INCLUDE_JVMTI
 // RedefineClasses() API support:
 // If any entry of this ConstantPoolCache points to any of
@@ -404,6 +404,9 @@ class ConstantPoolCache: public MetaspaceObj {
  private:
   int             _length;
   ConstantPool*   _constant_pool;          // the corresponding constant pool
+  // For each invokedynamic entry, the cache index of the first entry with
+  // the same LambdaMetafactory call site, or of itself; NULL if unused
+  Array<int>*     _lambda_call_sites;
 
   // Sizing
   debug_only(friend class ClassVerifier;)
@@ -414,7 +417,8 @@ class ConstantPoolCache: public MetaspaceObj {
                     const intStack& invokedynamic_inverse_index_map,
                     const intStack& invokedynamic_references_map) :
                           _length(length),
-                          _constant_pool(NULL) {
+                          _constant_pool(NULL),
+                          _lambda_call_sites(NULL) {
     initialize(inverse_index_map, invokedynamic_inverse_index_map,
                invokedynamic_references_map);
     for (int i = 0; i < length; i++) {
@@ -461,6 +465,12 @@ class ConstantPoolCache: public MetaspaceObj {
     return base() + i;
   }
 
+  // ShareLambdaCallSites support. The invokedynamic entries are the last
+  // indy_count ones; the constant pool must be set.
+  void initialize_lambda_call_sites(ClassLoaderData* loader_data, int indy_count, TRAPS);
+  // The entry whose call site the invokedynamic entry e shares, or e
+  ConstantPoolCacheEntry* lambda_call_site_at(ConstantPoolCacheEntry* e) const;
+
   // Code generation
   static ByteSize base_offset()                  { return in_ByteSize(sizeof(ConstantPoolCache)); }
   static ByteSize entry_offset(int raw_index) {
@@ -480,9 +490,9 @@ class ConstantPoolCache: public MetaspaceObj {
   void dump_cache();
 #endif // INCLUDE_JVMTI
 
-  // Deallocate - no fields to deallocate
+  // Deallocate
   DEBUG_ONLY(bool on_stack() { return false; })
-  void deallocate_contents(ClassLoaderData* data) {}
+  void deallocate_contents(ClassLoaderData* data);
   bool is_klass() const { return false; }
 
   // Printing
@@ -162,7 +162,8 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   if ((freq >= InlineFrequencyRatio) ||
       (call_site_count >= InlineFrequencyCount) ||
       is_unboxing_method(callee_method, C) ||
-      is_init_with_ea(callee_method, caller_method, C)) {
+      is_init_with_ea(callee_method, caller_method, C) ||
+      is_hot_call_site(callee_site_ratio(caller_bci))) {
 
     max_inline_size = C->freq_inline_size();
     if (size <= max_inline_size && TraceFrequencyInlining) {
@@ -347,8 +348,15 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     if (C->over_inlining_cutoff()) {
       if ((!callee_method->force_inline() && !caller_method->is_compiled_lambda_form())
           || !IncrementalInline) {
-        set_msg("NodeCountInliningCutoff");
-        return false;
+        if (IncrementalInline && IncrementalInlineOverCutoff &&
+            !C->inlining_incrementally()) {
+          // Retry once parsing is over and IGVN has removed the dead
+          // nodes; the live node count then decides.
+          should_delay = true;
+        } else {
+          set_msg("NodeCountInliningCutoff");
+          return false;
+        }
       } else {
         should_delay = true;
       }
@@ -379,7 +387,12 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     return false;
   }
   if (inline_level() > _max_inline_level) {
-    if (!callee_method->force_inline() || !IncrementalInline) {
+    if (inline_level() <= _max_inline_level + InlineHotCallSiteExtraLevel &&
+        is_hot_call_site(callee_site_ratio(caller_bci)) &&
+        callee_method->code_size_for_inlining() <= remaining_inline_budget()) {
+      // Hot call chains may go deeper while the budget lasts.
+      set_msg("hot call site, deep inlining");
+    } else if (!callee_method->force_inline() || !IncrementalInline) {
       set_msg("inlining too deep");
       return false;
     } else if (!C->inlining_incrementally()) {
@@ -431,6 +444,20 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     }
   }
 
+  // Large callees at cold call sites may only spend a share of the
+  // remaining budget proportional to the call site frequency, so that
+  // the budget is still available for the hot paths of the method.
+  if (InlineFrequencyBudget && size > C->max_inline_size() &&
+      !forced_inline() &&
+      !is_unboxing_method(callee_method, C) &&
+      !is_init_with_ea(callee_method, caller_method, C)) {
+    float site_ratio = callee_site_ratio(caller_bci);
+    if (site_ratio >= 0.0f && size > inline_budget_for(site_ratio)) {
+      set_msg("cold call site, inlining budget");
+      return false;
+    }
+  }
+
   // ok, inline this method
   return true;
 }
@@ -619,9 +646,41 @@ float InlineTree::compute_callee_frequency( int caller_bci ) const {
   return freq;
 }
 
+//------------------------------callee_site_ratio------------------------------
+float InlineTree::callee_site_ratio(int caller_bci) const {
+  int count = method()->interpreter_call_site_count(caller_bci);
+  if (count < 0 || _site_invoke_ratio < 0.0f) {
+    return -1.0f;  // unknown
+  }
+  return _site_invoke_ratio * compute_callee_frequency(caller_bci);
+}
+
+//------------------------------remaining_inline_budget------------------------
+// Bytecodes this compilation may still inline before DesiredMethodLimit.
+int InlineTree::remaining_inline_budget() const {
+  const InlineTree* top = this;
+  while (top->caller_tree() != NULL) {
+    top = top->caller_tree();
+  }
+  return MAX2((int)DesiredMethodLimit - (int)top->count_inline_bcs(), 0);
+}
+
+//------------------------------inline_budget_for------------------------------
+// Hot call sites may spend the whole remaining budget, colder ones only a
+// share proportional to how often they run per root method invocation.
+int InlineTree::inline_budget_for(float site_ratio) const {
+  int remaining = remaining_inline_budget();
+  if (site_ratio >= InlineHotCallSiteRatio) {
+    return remaining;
+  }
+  return (int)(remaining * (site_ratio / InlineHotCallSiteRatio));
+}
+
 //------------------------------build_inline_tree_for_callee-------------------
 InlineTree *InlineTree::build_inline_tree_for_callee( ciMethod* callee_method, JVMState* caller_jvms, int caller_bci) {
-  float recur_frequency = _site_invoke_ratio * compute_callee_frequency(caller_bci);
+  float recur_frequency = InlineFrequencyBudget ?
+    callee_site_ratio(caller_bci) :
+    _site_invoke_ratio * compute_callee_frequency(caller_bci);
   // Attempt inlining.
   InlineTree* old_ilt = callee_at(caller_bci, callee_method);
   if (old_ilt != NULL) {
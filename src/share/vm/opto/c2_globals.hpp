@@ -211,6 +211,11 @@
   product(bool, UseCountedLoopSafepoints, false,                            \
           "Force counted loops to keep a safepoint")                        \
                                                                             \
+  product(intx, LoopStripMiningIter, 0,                                     \
+          "Instead of dropping the backedge safepoint of a counted loop, "  \
+          "poll it in an outer loop every this many iterations of the "     \
+          "counted loop (0 to disable)")                                    \
+                                                                            \
   product(bool, UseLoopPredicate, true,                                     \
           "Generate a predicate to select fast/slow loop versions")         \
                                                                             \
@@ -242,6 +247,10 @@
   develop(bool, TraceOptimizeFill, false,                                   \
           "print detailed information about fill conversion")               \
                                                                             \
+  product(bool, OptimizeMathLoops, true,                                    \
+          "Convert loops storing Math.exp, log or log10 of a double array " \
+          "element into a call to a vectorized stub")                       \
+                                                                            \
   develop(bool, OptoCoalesce, true,                                         \
           "Use Conservative Copy Coalescing in the Register Allocator")     \
                                                                             \
@@ -327,6 +336,13 @@
   develop(bool, SuperWordRTDepCheck, false,                                 \
           "Enable runtime dependency checks.")                              \
                                                                             \
+  product(bool, SuperWordReductions, true,                                  \
+          "Enable reductions support in superword.")                        \
+                                                                            \
+  product(bool, VectorizedPostLoops, false,                                 \
+          "Split a narrower vectorized loop off super-unrolled main loops " \
+          "and skip pre-loop alignment when misaligned vectors are ok")     \
+                                                                            \
   notproduct(bool, TraceSuperWord, false,                                   \
           "Trace superword transforms")                                     \
                                                                             \
@@ -369,6 +385,13 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, true,                               \
+          "Profiling based inlining for more than two receivers")           \
+                                                                            \
+  product(intx, PolymorphicInliningLimit, 4,                                \
+          "Maximum number of receivers checked at a polymorphic call "      \
+          "site. Also the default TypeProfileWidth (max 8)")                \
+                                                                            \
   product(bool, InsertMemBarAfterArraycopy, true,                           \
           "Insert memory barrier after arraycopy call")                     \
                                                                             \
@@ -419,6 +442,17 @@
   develop(intx, WarmCallMaxSize, 999999,                                    \
           "size of the largest inlinable method")                           \
                                                                             \
+  product(bool, InlineFrequencyBudget, true,                                \
+          "Spend the per-compilation inlining budget (DesiredMethodLimit) " \
+          "according to profiled call site frequency")                      \
+                                                                            \
+  product(double, InlineHotCallSiteRatio, 1.0,                              \
+          "Calls per root method invocation at which a call site may "      \
+          "spend all of the remaining inlining budget")                     \
+                                                                            \
+  product(intx, InlineHotCallSiteExtraLevel, 2,                             \
+          "Additional inlining depth allowed below hot call sites")         \
+                                                                            \
   product(intx, MaxNodeLimit, 80000,                                        \
           "Maximum number of nodes")                                        \
                                                                             \
@@ -428,6 +462,10 @@
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
+  product(bool, UseSwitchProfiling, true,                                   \
+          "Replace switch cases never taken according to the profile "      \
+          "with uncommon traps")                                            \
+                                                                            \
   product(bool, UseDivMod, true,                                            \
           "Use combined DivMod instruction if available")                   \
                                                                             \
@@ -446,6 +484,10 @@
   product(bool, EliminateNestedLocks, true,                                 \
           "Eliminate nested locks of the same object when possible")        \
                                                                             \
+  product(bool, CoarsenLocksThroughBranches, true,                          \
+          "Coarsen adjacent locks of the same object which are separated "  \
+          "by branches that merge again")                                   \
+                                                                            \
   notproduct(bool, PrintLockStatistics, false,                              \
           "Print precise statistics on the dynamic lock usage")             \
                                                                             \
@@ -494,6 +536,18 @@
   product(intx, EliminateAllocationArraySizeLimit, 64,                      \
           "Array size (number of elements) limit for scalar replacement")   \
                                                                             \
+  product(bool, ReduceAllocationMerges, true,                               \
+          "Split field loads through Phis merging allocations so that "     \
+          "the allocations can be scalar replaced")                         \
+                                                                            \
+  product(bool, PartialEscapeAnalysis, true,                                \
+          "Put an uncommon trap on a rarely taken branch while a fresh "    \
+          "allocation is live, so that it does not escape on that path")    \
+                                                                            \
+  product(double, PartialEscapeRareBranchRatio, 0.001,                      \
+          "A branch taken less often than this fraction of the method "     \
+          "invocations is rare for PartialEscapeAnalysis")                  \
+                                                                            \
   product(bool, OptimizePtrCompare, true,                                   \
           "Use escape analysis to optimize pointers compare")               \
                                                                             \
@@ -650,6 +704,10 @@
   develop(bool, AlwaysIncrementalInline, false,                             \
           "do all inlining incrementally")                                  \
                                                                             \
+  product(bool, IncrementalInlineOverCutoff, true,                          \
+          "Delay inlining of call sites past NodeCountInliningCutoff "      \
+          "to incremental inlining, within LiveNodeCountInliningCutoff")    \
+                                                                            \
   product(intx, LiveNodeCountInliningCutoff, 40000,                         \
           "max number of live nodes in a method")                           \
                                                                             \
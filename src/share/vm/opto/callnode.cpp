@@ -1511,6 +1511,27 @@ static Node *next_control(Node *ctrl) {
   }
   return ctrl;
 }
+//
+// Skip backwards over if-then-else diamonds which merge again before
+// ctrl.  A branch of such a diamond contains no calls, safepoints or
+// uncommon traps, so holding a lock across it does not change what the
+// JVM state of any deoptimization point says about monitors.
+//
+static Node *skip_simple_diamonds(Node *ctrl) {
+  while (ctrl != NULL && ctrl->is_Region() && !ctrl->is_Loop() &&
+         ctrl->req() == 3 && ctrl->in(1) != NULL && ctrl->in(2) != NULL) {
+    Node *in1 = next_control(ctrl->in(1));
+    Node *in2 = next_control(ctrl->in(2));
+    if (((in1->is_IfTrue() && in2->is_IfFalse()) ||
+         (in2->is_IfTrue() && in1->is_IfFalse())) && (in1->in(0) == in2->in(0))) {
+      ctrl = next_control(in1->in(0)->in(0));
+    } else {
+      break;
+    }
+  }
+  return ctrl;
+}
+
 //
 // Given a control, see if it's the control projection of an Unlock which
 // operating on the same object as lock.
@@ -1695,6 +1716,12 @@ Node *LockNode::Ideal(PhaseGVN *phase, bool can_reshape) {
       GrowableArray<AbstractLockNode*>   lock_ops;
 
       Node *ctrl = next_control(in(0));
+      if (CoarsenLocksThroughBranches) {
+        // An inlined callee often evaluates a condition between two
+        // synchronized regions (e.g. String.valueOf() between two
+        // StringBuffer.append() calls).
+        ctrl = skip_simple_diamonds(ctrl);
+      }
 
       // now search back for a matching Unlock
       if (find_matching_unlock(ctrl, this, lock_ops)) {
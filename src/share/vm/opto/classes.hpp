@@ -300,6 +300,15 @@ macro(URShiftVL)
 macro(AndV)
 macro(OrV)
 macro(XorV)
+macro(AddReductionVI)
+macro(AddReductionVL)
+macro(AddReductionVF)
+macro(AddReductionVD)
+macro(MulReductionVI)
+macro(MulReductionVF)
+macro(MulReductionVD)
+macro(MinReductionVI)
+macro(MaxReductionVI)
 macro(LoadVector)
 macro(StoreVector)
 macro(Pack)
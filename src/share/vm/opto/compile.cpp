@@ -1108,13 +1108,22 @@ void Compile::Init(int aliaslevel) {
   set_do_count_invocations(false);
   set_do_method_data_update(false);
   set_rtm_state(NoRTM); // No RTM lock eliding by default
+  set_rtm_per_callsite(false);
   method_has_option_value("MaxNodeLimit", _max_node_limit);
 #if INCLUDE_RTM_OPT
   if (UseRTMLocking && has_method() && (method()->method_data_or_null() != NULL)) {
     int rtm_state = method()->method_data()->rtm_state();
-    if (method_has_option("NoRTMLockEliding") || ((rtm_state & NoRTM) != 0)) {
+    if (method_has_option("NoRTMLockEliding")) {
       // Don't generate RTM lock eliding code.
       set_rtm_state(NoRTM);
+    } else if ((rtm_state & NoRTM) != 0) {
+      // Some lock in this method aborted too often.
+      set_rtm_state(NoRTM);
+      if (UseRTMDeopt && RTMLockingPerCallsite) {
+        // Keep RTM lock eliding for the lock sites which did not abort
+        // too often themselves (see FastLockNode::create_rtm_lock_counter()).
+        set_rtm_per_callsite(true);
+      }
     } else if (method_has_option("UseRTMLockEliding") || ((rtm_state & UseRTM) != 0) || !UseRTMDeopt) {
       // Generate RTM lock eliding code without abort ratio calculation code.
       set_rtm_state(UseRTM);
@@ -2000,8 +2009,18 @@ void Compile::inline_incrementally_one(PhaseIterGVN& igvn) {
 
   int i = 0;
 
-  for (; i <_late_inlines.length() && !inlining_progress(); i++) {
+  // Method handle calls may only become inlinable after IGVN has run
+  // on the previous inlining, so stop at the first one once something
+  // was inlined.  Other calls are inlined in the same round as long as
+  // the live node count stays within LiveNodeCountInliningCutoff, which
+  // saves an IGVN pass over the whole graph per call.
+  for (; i <_late_inlines.length(); i++) {
     CallGenerator* cg = _late_inlines.at(i);
+    if (inlining_progress() &&
+        (!IncrementalInlineOverCutoff || cg->is_mh_late_inline() ||
+         live_nodes() > (uint)LiveNodeCountInliningCutoff)) {
+      break;
+    }
     _late_inlines_pos = i+1;
     cg->do_late_inline();
     if (failing())  return;
@@ -327,6 +327,7 @@ class Compile : public Phase {
   // JSR 292
   bool                  _has_method_handle_invokes; // True if this method has MethodHandle invokes.
   RTMState              _rtm_state;             // State of Restricted Transactional Memory usage
+  bool                  _rtm_per_callsite;      // RTM lock eliding is chosen per lock site
 
   // Compilation environment.
   Arena                 _comp_arena;            // Arena with lifetime equivalent to Compile
@@ -597,7 +598,9 @@ class Compile : public Phase {
   void          set_print_intrinsics(bool z)     { _print_intrinsics = z; }
   RTMState          rtm_state()  const           { return _rtm_state; }
   void          set_rtm_state(RTMState s)        { _rtm_state = s; }
-  bool              use_rtm() const              { return (_rtm_state & NoRTM) == 0; }
+  bool              rtm_per_callsite() const     { return _rtm_per_callsite; }
+  void          set_rtm_per_callsite(bool z)     { _rtm_per_callsite = z; }
+  bool              use_rtm() const              { return ((_rtm_state & NoRTM) == 0) || _rtm_per_callsite; }
   bool          profile_rtm() const              { return _rtm_state == ProfileRTM; }
   uint              max_node_limit() const       { return (uint)_max_node_limit; }
   void          set_max_node_limit(uint n)       { _max_node_limit = n; }
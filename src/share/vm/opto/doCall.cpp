@@ -61,6 +61,58 @@ void trace_type_profile(Compile* C, ciMethod *method, int depth, int bci, ciMeth
   }
 }
 
+// Type switch over all receivers of a polymorphic call site, most frequent
+// receiver checked first.  Returns NULL if a receiver can't be handled, or
+// can't be inlined and UseOnlyInlinedBimorphic is set.
+static CallGenerator* polymorphic_call_generator(Compile* C, ciMethod* callee, int vtable_index,
+                                                 JVMState* jvms, bool allow_inline,
+                                                 float prof_factor, ciCallProfile& profile) {
+  ciMethod* caller   = jvms->method();
+  int       bci      = jvms->bci();
+  int       morphism = profile.morphism();
+  assert(morphism > 2 && morphism <= ciCallProfile::MorphismLimit, "polymorphic call site");
+
+  ciMethod*      receiver_method[ciCallProfile::MorphismLimit];
+  CallGenerator* hit_cg[ciCallProfile::MorphismLimit];
+  for (int i = 0; i < morphism; i++) {
+    receiver_method[i] = callee->resolve_invoke(caller->holder(), profile.receiver(i));
+    if (receiver_method[i] == NULL) {
+      return NULL;
+    }
+    hit_cg[i] = C->call_generator(receiver_method[i], vtable_index, false, jvms,
+                                  allow_inline, prof_factor);
+    if (hit_cg[i] == NULL) {
+      return NULL;
+    }
+    if (!hit_cg[i]->is_inline() && UseOnlyInlinedBimorphic) {
+      // Same rule as for bimorphic sites: type checks only pay off if
+      // every receiver's method is inlined.
+      return NULL;
+    }
+  }
+
+  CallGenerator* cg;
+  if (!C->too_many_traps(caller, bci, Deoptimization::Reason_bimorphic)) {
+    // All receivers are known, a new one is unlikely.
+    cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_bimorphic,
+                                          Deoptimization::Action_maybe_recompile);
+  } else {
+    cg = CallGenerator::for_virtual_call(callee, vtable_index);
+  }
+  // Build the checks from the least frequent receiver outwards. Each hit
+  // probability is relative to the receivers not checked before it.
+  int remaining_count = 0;
+  for (int i = morphism - 1; i >= 0 && cg != NULL; i--) {
+    int receiver_count = profile.receiver_count(i);
+    remaining_count += receiver_count;
+    float hit_prob = MIN2((float)receiver_count / (float)remaining_count, PROB_MAX);
+    trace_type_profile(C, caller, jvms->depth() - 1, bci, receiver_method[i], profile.receiver(i),
+                       profile.count(), receiver_count);
+    cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cg[i], hit_prob);
+  }
+  return cg;
+}
+
 CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool call_does_dispatch,
                                        JVMState* jvms, bool allow_inline,
                                        float prof_factor, ciKlass* speculative_receiver_type,
@@ -223,6 +275,12 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = NULL;
         }
       }
+      if (speculative_receiver_type == NULL && UsePolymorphicInlining &&
+          morphism > 2 && morphism <= PolymorphicInliningLimit) {
+        CallGenerator* cg = polymorphic_call_generator(this, callee, vtable_index, jvms,
+                                                       allow_inline, prof_factor, profile);
+        if (cg != NULL)  return cg;
+      }
       if (receiver_method == NULL &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
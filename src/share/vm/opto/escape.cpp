@@ -86,6 +86,10 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   Compile::TracePhase t2("escapeAnalysis", &Phase::_t_escapeAnalysis, true);
   ResourceMark rm;
 
+  if (ReduceAllocationMerges && EliminateAllocations) {
+    reduce_allocation_merges(C, igvn);
+  }
+
   // Add ConP#NULL and ConN#NULL nodes before ConnectionGraph construction
   // to create space for them in ConnectionGraph::_nodes[].
   Node* oop_null = igvn->zerocon(T_OBJECT);
@@ -103,6 +107,130 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
     igvn->hash_delete(noop_null);
 }
 
+// EA does not scalar replace allocations which are merged by a Phi
+// (see adjust_scalar_replaceable_state()). In the common case
+//
+//   Foo f = cond ? new Foo(a) : new Foo(b);
+//   return f.x;
+//
+// the merged value is only used to load fields. Splitting those loads
+// through the Phi leaves every allocation with its own loads and kills
+// the Phi before the Connection Graph is built.
+bool ConnectionGraph::can_reduce_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn) {
+  Node* region = phi->in(0);
+  if (region == NULL || !region->is_Region() || region->is_Loop() ||
+      phi->type()->isa_instptr() == NULL) {
+    return false;
+  }
+  for (uint i = 1; i < phi->req(); i++) {
+    Node* in = phi->in(i);
+    if (in == NULL || region->in(i) == NULL ||
+        igvn->type(in) == Type::TOP || igvn->type(region->in(i)) == Type::TOP) {
+      return false;
+    }
+    AllocateNode* alloc = AllocateNode::Ideal_allocation(in, igvn);
+    if (alloc == NULL || alloc->is_AllocateArray() || alloc->result_cast() != in) {
+      return false;
+    }
+  }
+  Node* immutable_mem = igvn->C->immutable_memory();
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    if (!addp->is_AddP() ||
+        addp->in(AddPNode::Base) != phi ||
+        addp->in(AddPNode::Address) != phi ||
+        !addp->in(AddPNode::Offset)->is_Con() ||
+        addp->outcnt() == 0) {
+      return false;
+    }
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      Node* ld = addp->fast_out(j);
+      if (!ld->is_Load() || !ld->as_Load()->is_unordered() ||
+          ld->in(MemNode::Address) != addp) {
+        return false;
+      }
+      // Every path needs its own memory state, unless the load
+      // reads immutable memory (klass pointer).
+      Node* mem = ld->in(MemNode::Memory);
+      if (mem != immutable_mem && !(mem->is_Phi() && mem->in(0) == region)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void ConnectionGraph::reduce_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn) {
+  Compile* C = igvn->C;
+  Node* region = phi->in(0);
+  // Collect everything up front: replacing the last load kills the
+  // AddP nodes and the Phi itself.
+  Node_List bases;
+  for (uint i = 0; i < phi->req(); i++) {
+    bases.push(phi->in(i));
+  }
+  Node_List loads;
+  for (DUIterator_Fast imax, i = phi->fast_outs(imax); i < imax; i++) {
+    Node* addp = phi->fast_out(i);
+    for (DUIterator_Fast jmax, j = addp->fast_outs(jmax); j < jmax; j++) {
+      loads.push(addp->fast_out(j));
+    }
+  }
+#ifndef PRODUCT
+  if (PrintEscapeAnalysis || PrintEliminateAllocations) {
+    tty->print_cr("=== Reduce allocation merge Phi %d with %d loads", phi->_idx, loads.size());
+  }
+#endif
+  for (uint k = 0; k < loads.size(); k++) {
+    Node* ld = loads.at(k);
+    Node* mem = ld->in(MemNode::Memory);
+    Node* offset = ld->in(MemNode::Address)->in(AddPNode::Offset);
+    PhiNode* value_phi = PhiNode::make_blank(region, ld);
+    for (uint i = 1; i < region->req(); i++) {
+      Node* base = bases.at(i);
+      Node* adr = new (C) AddPNode(base, base, offset);
+      igvn->register_new_node_with_optimizer(adr);
+      Node* x = ld->clone();
+      x->set_req(0, (ld->in(0) == region) ? region->in(i) : NULL);
+      if (mem->is_Phi() && mem->in(0) == region) {
+        x->set_req(MemNode::Memory, mem->in(i));
+      }
+      x->set_req(MemNode::Address, adr);
+      igvn->register_new_node_with_optimizer(x);
+      value_phi->init_req(i, x);
+    }
+    igvn->register_new_node_with_optimizer(value_phi);
+    igvn->replace_node(ld, value_phi);
+  }
+}
+
+void ConnectionGraph::reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn) {
+  Unique_Node_List phis;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate() || n->is_AllocateArray()) {
+      continue;
+    }
+    Node* res = n->as_Allocate()->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    for (DUIterator_Fast jmax, j = res->fast_outs(jmax); j < jmax; j++) {
+      Node* use = res->fast_out(j);
+      if (use->is_Phi()) {
+        phis.push(use);
+      }
+    }
+  }
+  for (uint i = 0; i < phis.size(); i++) {
+    PhiNode* phi = phis.at(i)->as_Phi();
+    if (can_reduce_allocation_merge(phi, igvn)) {
+      reduce_allocation_merge(phi, igvn);
+      if (C->failing()) return;
+    }
+  }
+}
+
 bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
@@ -948,10 +1076,14 @@ void ConnectionGraph::process_call_arguments(CallNode *call) {
                  (strcmp(call->as_CallLeaf()->_name, "g1_wb_pre")  == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "g1_wb_post") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "updateBytesCRC32") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "updateBytesCRC32C") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "updateBytesAdler32") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "vectorizedMismatch") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "aescrypt_encryptBlock") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "aescrypt_decryptBlock") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "cipherBlockChaining_encryptAESCrypt") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "cipherBlockChaining_decryptAESCrypt") == 0 ||
+                  strcmp(call->as_CallLeaf()->_name, "counterMode_AESCrypt") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "ghash_processBlocks") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "sha1_implCompress") == 0 ||
                   strcmp(call->as_CallLeaf()->_name, "sha1_implCompressMB") == 0 ||
@@ -582,6 +582,12 @@ private:
   // Compute the escape information
   bool compute_escape();
 
+  // Split field loads through Phis which merge allocations so that
+  // the merge does not prevent scalar replacement.
+  static bool can_reduce_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn);
+  static void reduce_allocation_merge(PhiNode* phi, PhaseIterGVN* igvn);
+  static void reduce_allocation_merges(Compile* C, PhaseIterGVN* igvn);
+
 public:
   ConnectionGraph(Compile *C, PhaseIterGVN *igvn);
 
@@ -164,7 +164,16 @@ void FastLockNode::create_lock_counter(JVMState* state) {
 void FastLockNode::create_rtm_lock_counter(JVMState* state) {
 #if INCLUDE_RTM_OPT
   Compile* C = Compile::current();
-  if (C->profile_rtm() || (PrintPreciseRTMLockingStatistics && C->use_rtm())) {
+  _use_rtm = C->use_rtm();
+  if (C->rtm_per_callsite()) {
+    // Keep RTM lock eliding only if this lock site was profiled and did
+    // not abort too often.  A callee synchronized method inlined into
+    // several callers gets a separate decision in each of them.
+    RTMLockingCounters history;
+    _use_rtm = OptoRuntime::sum_rtm_named_counters(state, &history) &&
+               !history.abort_ratio_too_high();
+  }
+  if (_use_rtm && (C->profile_rtm() || PrintPreciseRTMLockingStatistics)) {
     RTMLockingNamedCounter* rlnc = (RTMLockingNamedCounter*)
            OptoRuntime::new_named_counter(state, NamedCounter::RTMLockingCounter);
     _rtm_counters = rlnc->counters();
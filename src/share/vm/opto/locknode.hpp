@@ -89,6 +89,7 @@ private:
   BiasedLockingCounters*        _counters;
   RTMLockingCounters*       _rtm_counters; // RTM lock counters for inflated locks
   RTMLockingCounters* _stack_rtm_counters; // RTM lock counters for stack locks
+  bool                           _use_rtm; // Generate RTM lock eliding code
 
 public:
   FastLockNode(Node *ctrl, Node *oop, Node *box) : CmpNode(oop,box) {
@@ -97,6 +98,7 @@ public:
     _counters = NULL;
     _rtm_counters = NULL;
     _stack_rtm_counters = NULL;
+    _use_rtm = false;
   }
   Node* obj_node() const { return in(1); }
   Node* box_node() const { return in(2); }
@@ -116,6 +118,7 @@ public:
   BiasedLockingCounters*        counters() const { return _counters; }
   RTMLockingCounters*       rtm_counters() const { return _rtm_counters; }
   RTMLockingCounters* stack_rtm_counters() const { return _stack_rtm_counters; }
+  bool                           use_rtm() const { return _use_rtm; }
 };
 
 
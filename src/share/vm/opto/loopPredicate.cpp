@@ -803,6 +803,19 @@ bool PhaseIdealLoop::loop_predication_impl(IdealLoopTree *loop) {
   }
 
   Node* entry = head->in(LoopNode::EntryControl);
+  IdealLoopTree* invar_loop = loop;
+  Node* strip_init  = NULL;
+  Node* strip_limit = NULL;
+  if (entry->is_Loop() && entry->as_Loop()->is_strip_mined()) {
+    // The predicates of a strip mined loop are above its outer loop and
+    // must hold for every strip: conditions must be invariant in the outer
+    // loop and range checks must cover the iteration space of all strips.
+    invar_loop = get_loop(entry);
+    if (cl != NULL && !strip_mined_range(cl, strip_init, strip_limit)) {
+      cl = NULL;
+    }
+    entry = entry->in(LoopNode::EntryControl);
+  }
   ProjNode *predicate_proj = NULL;
   // Loop limit check predicate should be near the loop.
   if (LoopLimitCheck) {
@@ -826,7 +839,7 @@ bool PhaseIdealLoop::loop_predication_impl(IdealLoopTree *loop) {
   set_ctrl(zero, C->root());
 
   ResourceArea *area = Thread::current()->resource_area();
-  Invariance invar(area, loop);
+  Invariance invar(area, invar_loop);
 
   // Create list of if-projs such that a newer proj dominates all older
   // projs in the list, and they all dominate loop->tail()
@@ -912,11 +925,6 @@ bool PhaseIdealLoop::loop_predication_impl(IdealLoopTree *loop) {
       bool ok = is_scaled_iv_plus_offset(idx, cl->phi(), &scale, &offset);
       assert(ok, "must be index expression");
 
-      Node* init    = cl->init_trip();
-      // Limit is not exact.
-      // Calculate exact limit here.
-      // Note, counted loop's test is '<' or '>'.
-      Node* limit   = exact_limit(loop);
       int  stride   = cl->stride()->get_int();
 
       // Build if's for the upper and lower bound tests.  The
@@ -928,6 +936,24 @@ bool PhaseIdealLoop::loop_predication_impl(IdealLoopTree *loop) {
       assert(upper_bound_proj->in(0)->as_If()->in(0) == lower_bound_proj, "should dominate");
       Node *ctrl = lower_bound_proj->in(0)->as_If()->in(0);
 
+      Node* init;
+      Node* limit;
+      if (strip_init != NULL) {
+        init  = strip_init;
+        limit = strip_limit;
+        if (LoopLimitCheck && ABS(stride) != 1) {
+          // Exact limit of the whole iteration space, as in exact_limit().
+          limit = new (C) LoopLimitNode(C, init, limit, cl->stride());
+          register_new_node(limit, ctrl);
+        }
+      } else {
+        init  = cl->init_trip();
+        // Limit is not exact.
+        // Calculate exact limit here.
+        // Note, counted loop's test is '<' or '>'.
+        limit = exact_limit(loop);
+      }
+
       // Perform cloning to keep Invariance state correct since the
       // late schedule will place invariant things in the loop.
       rng = invar.clone(rng, ctrl);
@@ -34,6 +34,7 @@
 #include "opto/rootnode.hpp"
 #include "opto/runtime.hpp"
 #include "opto/subnode.hpp"
+#include "opto/vectornode.hpp"
 
 //------------------------------is_loop_exit-----------------------------------
 // Given an IfNode, return the loop-exiting projection or NULL if both
@@ -753,6 +754,32 @@ bool IdealLoopTree::policy_unroll( PhaseIdealLoop *phase ) const {
   return true;
 }
 
+//------------------------------policy_vector_drain----------------------------
+// Return TRUE if the main loop is unrolled exactly as many times as the
+// narrowest vector over its memory operations holds elements, and is about
+// to be unrolled again.  A copy taken now vectorizes at that width and picks
+// up the iterations the wider main loop leaves over.  Without a pre-loop to
+// align it, the copy relies on misaligned vector accesses.
+bool IdealLoopTree::policy_vector_drain( PhaseIdealLoop *phase ) const {
+  if (!VectorizedPostLoops || !UseSuperWord) return false;
+  if (!Matcher::misaligned_vectors_ok()) return false;
+
+  CountedLoopNode *cl = _head->as_CountedLoop();
+  if (!cl->is_main_loop() || cl->has_vector_drain_loop()) return false;
+
+  int vlen = 0;
+  for (uint i = 0; i < _body.size(); i++) {
+    Node* n = _body.at(i);
+    if (!n->is_Mem() || n->is_LoadStore()) continue;
+    BasicType bt = n->as_Mem()->memory_type();
+    if (!is_java_primitive(bt)) continue;
+    int max_vlen = Matcher::max_vector_size(bt);
+    if (max_vlen < 2) continue;
+    vlen = (vlen == 0) ? max_vlen : MIN2(vlen, max_vlen);
+  }
+  return vlen >= 2 && cl->unrolled_count() == vlen;
+}
+
 //------------------------------policy_align-----------------------------------
 // Return TRUE or FALSE if the loop should be cache-line aligned.  Gather the
 // expression that does the alignment.  Note that only one array base can be
@@ -895,58 +922,13 @@ bool PhaseIdealLoop::cast_incr_before_loop(Node* incr, Node* ctrl, Node* loop) {
   return false;
 }
 
-//------------------------------insert_pre_post_loops--------------------------
-// Insert pre and post loops.  If peel_only is set, the pre-loop can not have
-// more iterations added.  It acts as a 'peel' only, no lower-bound RCE, no
-// alignment.  Useful to unroll loops that do no array accesses.
-void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only ) {
-
-#ifndef PRODUCT
-  if (TraceLoopOpts) {
-    if (peel_only)
-      tty->print("PeelMainPost ");
-    else
-      tty->print("PreMainPost  ");
-    loop->dump_head();
-  }
-#endif
-  C->set_major_progress();
-
-  // Find common pieces of the loop being guarded with pre & post loops
-  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
-  assert( main_head->is_normal_loop(), "" );
-  CountedLoopEndNode *main_end = main_head->loopexit();
-  guarantee(main_end != NULL, "no loop exit node");
-  assert( main_end->outcnt() == 2, "1 true, 1 false path only" );
-  uint dd_main_head = dom_depth(main_head);
-  uint max = main_head->outcnt();
-
-  Node *pre_header= main_head->in(LoopNode::EntryControl);
-  Node *init      = main_head->init_trip();
-  Node *incr      = main_end ->incr();
-  Node *limit     = main_end ->limit();
-  Node *stride    = main_end ->stride();
-  Node *cmp       = main_end ->cmp_node();
-  BoolTest::mask b_test = main_end->test_trip();
-
-  // Need only 1 user of 'bol' because I will be hacking the loop bounds.
-  Node *bol = main_end->in(CountedLoopEndNode::TestValue);
-  if( bol->outcnt() != 1 ) {
-    bol = bol->clone();
-    register_new_node(bol,main_end->in(CountedLoopEndNode::TestControl));
-    _igvn.hash_delete(main_end);
-    main_end->set_req(CountedLoopEndNode::TestValue, bol);
-  }
-  // Need only 1 user of 'cmp' because I will be hacking the loop bounds.
-  if( cmp->outcnt() != 1 ) {
-    cmp = cmp->clone();
-    register_new_node(cmp,main_end->in(CountedLoopEndNode::TestControl));
-    _igvn.hash_delete(bol);
-    bol->set_req(1, cmp);
-  }
-
-  //------------------------------
-  // Step A: Create Post-Loop.
+//------------------------------insert_post_loop-------------------------------
+// Clone the loop body of 'main_head' as a post loop placed on the main loop's
+// exit, behind a zero-trip guard comparing the main loop's exit value 'incr'
+// against 'limit'.  Returns the head of the new post loop.
+CountedLoopNode* PhaseIdealLoop::insert_post_loop( IdealLoopTree *loop, Node_List &old_new,
+                                                   CountedLoopNode *main_head, CountedLoopEndNode *main_end,
+                                                   Node *incr, Node *limit ) {
   Node* main_exit = main_end->proj_out(false);
   assert( main_exit->Opcode() == Op_IfFalse, "" );
   int dd_main_exit = dom_depth(main_exit);
@@ -956,6 +938,7 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   clone_loop( loop, old_new, dd_main_exit );
   assert( old_new[main_end ->_idx]->Opcode() == Op_CountedLoopEnd, "" );
   CountedLoopNode *post_head = old_new[main_head->_idx]->as_CountedLoop();
+  post_head->set_normal_loop();
   post_head->set_post_loop(main_head);
 
   // Reduce the post-loop trip count.
@@ -975,7 +958,7 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   // trip guard until all unrolling is done.
   Node *zer_opaq = new (C) Opaque1Node(C, incr);
   Node *zer_cmp  = new (C) CmpINode( zer_opaq, limit );
-  Node *zer_bol  = new (C) BoolNode( zer_cmp, b_test );
+  Node *zer_bol  = new (C) BoolNode( zer_cmp, main_end->test_trip() );
   register_new_node( zer_opaq, new_main_exit );
   register_new_node( zer_cmp , new_main_exit );
   register_new_node( zer_bol , new_main_exit );
@@ -1018,9 +1001,102 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
     }
   }
 
-  // Update local caches for next stanza
-  main_exit = new_main_exit;
+  // CastII for the post loop (see insert_pre_post_loops):
+  bool inserted = cast_incr_before_loop(zer_opaq->in(1), zer_taken, post_head);
+  assert(inserted, "no castII inserted");
+
+  return post_head;
+}
+
+//------------------------------insert_vector_drain_loop-----------------------
+// Insert a copy of the main loop, at its current unroll factor, between the
+// main and the post loop.  The copy keeps the main loop's current limit
+// while the main loop goes on to be unrolled further, so it only ever runs
+// whole trips of the narrower unroll and SuperWord vectorizes it at that
+// width.  The scalar post loop is then left with less than one vector of
+// iterations.
+void PhaseIdealLoop::insert_vector_drain_loop( IdealLoopTree *loop, Node_List &old_new ) {
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("VectorDrain  ");
+    loop->dump_head();
+  }
+#endif
+  C->set_major_progress();
+
+  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
+  assert(main_head->is_main_loop(), "only main loops get a drain loop");
+  CountedLoopEndNode *main_end = main_head->loopexit();
+  guarantee(main_end != NULL, "no loop exit node");
+  assert(main_end->outcnt() == 2, "1 true, 1 false path only");
+
+  // Mark the main loop before cloning it so the flag is inherited and
+  // neither loop grows another drain loop.
+  main_head->mark_has_vector_drain_loop();
+
+  CountedLoopNode *drain_head = insert_post_loop(loop, old_new, main_head, main_end,
+                                                 main_end->incr(), main_end->limit());
+  drain_head->mark_vector_drain_loop();
+  // It runs fewer trips than the main loop is unrolled beyond it, so
+  // guess that it is usually entered for a single trip.
+  drain_head->set_profile_trip_cnt(1.0);
+
+  loop->record_for_igvn();
+}
+
+//------------------------------insert_pre_post_loops--------------------------
+// Insert pre and post loops.  If peel_only is set, the pre-loop can not have
+// more iterations added.  It acts as a 'peel' only, no lower-bound RCE, no
+// alignment.  Useful to unroll loops that do no array accesses.
+void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only ) {
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    if (peel_only)
+      tty->print("PeelMainPost ");
+    else
+      tty->print("PreMainPost  ");
+    loop->dump_head();
+  }
+#endif
+  C->set_major_progress();
+
+  // Find common pieces of the loop being guarded with pre & post loops
+  CountedLoopNode *main_head = loop->_head->as_CountedLoop();
+  assert( main_head->is_normal_loop(), "" );
+  CountedLoopEndNode *main_end = main_head->loopexit();
+  guarantee(main_end != NULL, "no loop exit node");
+  assert( main_end->outcnt() == 2, "1 true, 1 false path only" );
+  uint dd_main_head = dom_depth(main_head);
+  uint max = main_head->outcnt();
+
+  Node *pre_header= main_head->in(LoopNode::EntryControl);
+  Node *init      = main_head->init_trip();
+  Node *incr      = main_end ->incr();
+  Node *limit     = main_end ->limit();
+  Node *stride    = main_end ->stride();
+  Node *cmp       = main_end ->cmp_node();
+  BoolTest::mask b_test = main_end->test_trip();
+
+  // Need only 1 user of 'bol' because I will be hacking the loop bounds.
+  Node *bol = main_end->in(CountedLoopEndNode::TestValue);
+  if( bol->outcnt() != 1 ) {
+    bol = bol->clone();
+    register_new_node(bol,main_end->in(CountedLoopEndNode::TestControl));
+    _igvn.hash_delete(main_end);
+    main_end->set_req(CountedLoopEndNode::TestValue, bol);
+  }
+  // Need only 1 user of 'cmp' because I will be hacking the loop bounds.
+  if( cmp->outcnt() != 1 ) {
+    cmp = cmp->clone();
+    register_new_node(cmp,main_end->in(CountedLoopEndNode::TestControl));
+    _igvn.hash_delete(bol);
+    bol->set_req(1, cmp);
+  }
 
+  //------------------------------
+  // Step A: Create Post-Loop.
+  CountedLoopNode *post_head = insert_post_loop(loop, old_new, main_head, main_end, incr, limit);
 
   //------------------------------
   // Step B: Create Pre-Loop.
@@ -1076,8 +1152,9 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   main_head->set_req(LoopNode::EntryControl, min_taken);
   set_idom(main_head, min_taken, dd_main_head);
 
-  visited.Clear();
-  clones.clear();
+  Arena *a = Thread::current()->resource_area();
+  VectorSet visited(a);
+  Node_Stack clones(a, main_head->back_control()->outcnt());
   // Step B3: Make the fall-in values to the main-loop come from the
   // fall-out values of the pre-loop.
   for (DUIterator_Fast i2max, i2 = main_head->fast_outs(i2max); i2 < i2max; i2++) {
@@ -1101,14 +1178,10 @@ void PhaseIdealLoop::insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_
   // test that was guarding the loop nest. We add a special CastII on
   // the if branch that enters the loop, between the input induction
   // variable value and the induction variable Phi to preserve correct
-  // dependencies.
-
-  // CastII for the post loop:
-  bool inserted = cast_incr_before_loop(zer_opaq->in(1), zer_taken, post_head);
-  assert(inserted, "no castII inserted");
+  // dependencies.  The post loop got its CastII in insert_post_loop().
 
   // CastII for the main loop:
-  inserted = cast_incr_before_loop(pre_incr, min_taken, main_head);
+  bool inserted = cast_incr_before_loop(pre_incr, min_taken, main_head);
   assert(inserted, "no castII inserted");
 
   // Step B4: Shorten the pre-loop to run only 1 iteration (for now).
@@ -1190,6 +1263,87 @@ bool IdealLoopTree::is_invariant(Node* n) const {
 }
 
 
+//------------------------------min_max_reduction------------------------------
+// Math.min/max and simple "if (x < m) m = x" loops reach us as a CMoveI
+// selecting between the two operands of its own compare.  Return the
+// equivalent MinI/MaxI opcode when one of the operands is the loop phi, so
+// the selection can be treated as a reduction; 0 otherwise.
+static int min_max_reduction(Node* cmov, Node* phi) {
+  if (cmov->Opcode() != Op_CMoveI) return 0;
+  Node* bol = cmov->in(CMoveNode::Condition);
+  if (!bol->is_Bool() || bol->outcnt() != 1) return 0;
+  Node* cmp = bol->in(1);
+  if (cmp->Opcode() != Op_CmpI) return 0;
+  Node* a = cmp->in(1);
+  Node* b = cmp->in(2);
+  if (a != phi && b != phi) return 0;
+  Node* if_true  = cmov->in(CMoveNode::IfTrue);
+  Node* if_false = cmov->in(CMoveNode::IfFalse);
+  if (!((if_true == a && if_false == b) || (if_true == b && if_false == a))) return 0;
+  switch (bol->as_Bool()->_test._test) {
+  case BoolTest::lt:
+  case BoolTest::le:
+    return (if_true == a) ? Op_MinI : Op_MaxI;
+  case BoolTest::gt:
+  case BoolTest::ge:
+    return (if_true == a) ? Op_MaxI : Op_MinI;
+  }
+  return 0;
+}
+
+//------------------------------mark_reductions--------------------------------
+// Flag the loop carried operations of reductions before the first unroll so
+// that every copy made by unrolling is known to SuperWord as part of a chain.
+void PhaseIdealLoop::mark_reductions(IdealLoopTree *loop) {
+  CountedLoopNode *loop_head = loop->_head->as_CountedLoop();
+  if (loop_head->unrolled_count() > 1) {
+    return; // Only the original loop body is inspected
+  }
+
+  Node* trip_phi = loop_head->phi();
+  for (DUIterator_Fast imax, i = loop_head->fast_outs(imax); i < imax; i++) {
+    Node* phi = loop_head->fast_out(i);
+    if (!phi->is_Phi() || phi->outcnt() == 0 || phi == trip_phi) continue;
+    Node* def_node = phi->in(LoopNode::LoopBackControl);
+    if (def_node == NULL || def_node->is_reduction() || !has_ctrl(def_node)) continue;
+    if (!loop->is_member(get_loop(get_ctrl(def_node)))) continue;
+
+    int min_max_opc = min_max_reduction(def_node, phi);
+    if (min_max_opc == 0 &&
+        ReductionNode::opcode(def_node->Opcode(), def_node->bottom_type()->basic_type()) == 0) {
+      continue;
+    }
+
+    // The operation must consume the phi and feed nothing but the phi
+    // inside the loop.
+    bool ok = false;
+    for (uint j = 1; !ok && j < def_node->req(); j++) {
+      ok = (def_node->in(j) == phi);
+    }
+    for (DUIterator_Fast jmax, j = def_node->fast_outs(jmax); ok && j < jmax; j++) {
+      Node* u = def_node->fast_out(j);
+      if (u != phi && loop->is_member(get_loop(ctrl_or_self(u)))) {
+        ok = false;
+      }
+    }
+    if (!ok) continue;
+
+    if (min_max_opc != 0) {
+      // Rewrite the selection as the equivalent MinI/MaxI of the phi and
+      // the other compare operand so it can be packed like other reductions.
+      Node* cmp = def_node->in(CMoveNode::Condition)->in(1);
+      Node* other = (cmp->in(1) == phi) ? cmp->in(2) : cmp->in(1);
+      Node* mm = (min_max_opc == Op_MinI) ? (Node*)new (C) MinINode(phi, other)
+                                          : (Node*)new (C) MaxINode(phi, other);
+      register_new_node(mm, get_ctrl(def_node));
+      _igvn.replace_node(def_node, mm);
+      def_node = mm;
+    }
+    def_node->add_flag(Node::Flag_is_reduction);
+    loop_head->mark_has_reductions();
+  }
+}
+
 //------------------------------do_unroll--------------------------------------
 // Unroll the loop body one step - make each trip do 2 iterations.
 void PhaseIdealLoop::do_unroll( IdealLoopTree *loop, Node_List &old_new, bool adjust_min_trip ) {
@@ -2327,8 +2481,14 @@ bool IdealLoopTree::iteration_split_impl( PhaseIdealLoop *phase, Node_List &old_
     // an even number of trips).  If we are peeling, we might enable some RCE
     // and we'd rather unroll the post-RCE'd loop SO... do not unroll if
     // peeling.
-    if (should_unroll && !should_peel)
+    if (should_unroll && !should_peel) {
+      if (UseSuperWord && SuperWordReductions) {
+        phase->mark_reductions(this);
+      }
+      if (policy_vector_drain(phase))
+        phase->insert_vector_drain_loop(this, old_new);
       phase->do_unroll(this,old_new, true);
+    }
 
     // Adjust the pre-loop limits to align the main body
     // iterations.
@@ -2804,3 +2964,320 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
 
   return true;
 }
+
+
+//=============================================================================
+// Process all the loops in the loop tree and replace loops that apply
+// one of the scalar libm stubs to each element of a double array with a
+// call to the vectorized version of the stub.
+bool PhaseIdealLoop::do_intrinsify_math() {
+  bool changed = false;
+  for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+    IdealLoopTree* lpt = iter.current();
+    changed |= intrinsify_math(lpt);
+  }
+  return changed;
+}
+
+
+// Decompose the address of a double array element indexed by the loop
+// phi: base + offset + (ConvI2L(CastII(phi)) << 3). The nodes of the
+// index expression are recorded in ok.
+static bool match_double_element(Node* adr, Node* phi, Node*& offset, Node*& shift,
+                                 VectorSet& ok) {
+  offset = NULL;
+  shift = NULL;
+  if (!adr->is_AddP()) {
+    return false;
+  }
+  Node* elements[4];
+  int count = adr->as_AddP()->unpack_offsets(elements, ARRAY_SIZE(elements));
+  if (count == -1) {
+    return false;
+  }
+  for (int e = 0; e < count; e++) {
+    Node* n = elements[e];
+    if (n->is_Con() && offset == NULL) {
+      offset = n;
+    } else if (n->Opcode() == Op_LShiftX && shift == NULL) {
+      if (!n->in(2)->is_Con() ||
+          n->in(2)->get_int() != exact_log2(type2aelembytes(T_DOUBLE))) {
+        return false;
+      }
+      Node* value = n->in(1);
+#ifdef _LP64
+      if (value->Opcode() == Op_ConvI2L) {
+        ok.set(value->_idx);
+        value = value->in(1);
+      }
+      if (value->Opcode() == Op_CastII &&
+          value->as_CastII()->has_range_check()) {
+        // Skip range check dependent CastII nodes
+        ok.set(value->_idx);
+        value = value->in(1);
+      }
+#endif
+      if (value != phi) {
+        return false;
+      }
+      shift = n;
+    } else {
+      return false;
+    }
+  }
+  if (offset == NULL || shift == NULL) {
+    return false;
+  }
+  ok.set(offset->_idx);
+  ok.set(shift->_idx);
+  return true;
+}
+
+
+// Examine an inner loop looking for a single store to a double array
+// of the scalar stub applied to the element of a double array at the
+// same index, in a unit stride loop.
+bool PhaseIdealLoop::match_math_loop(IdealLoopTree* lpt, Node*& store, Node*& load,
+                                     CallLeafNode*& call, address& stub) {
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+  if (head->stride_con() != 1) {
+    return false;
+  }
+
+  store = NULL;
+  for (uint i = 0; i < lpt->_body.size(); i++) {
+    Node* n = lpt->_body.at(i);
+    if (n->outcnt() == 0) continue; // Ignore dead
+    if (n->is_Store()) {
+      if (store != NULL) {
+        return false;               // multiple stores
+      }
+      store = n;
+    } else if (n->is_If() && n != head->loopexit()) {
+      return false;                 // extra control flow
+    }
+  }
+  if (store == NULL || store->Opcode() != Op_StoreD) {
+    return false;
+  }
+
+  Node* mem_phi = store->in(MemNode::Memory);
+  if (!mem_phi->is_Phi() || mem_phi->in(0) != head ||
+      mem_phi->in(LoopNode::LoopBackControl) != store) {
+    return false;
+  }
+
+  // The stored value is the result of one of the scalar stubs ...
+  Node* value = store->in(MemNode::ValueIn);
+  if (!value->is_Proj() || value->as_Proj()->_con != TypeFunc::Parms ||
+      !value->in(0)->is_CallLeaf()) {
+    return false;
+  }
+  call = value->in(0)->as_CallLeaf();
+  address entry = call->entry_point();
+  if (entry == NULL) {
+    return false;
+  } else if (entry == StubRoutines::dexp()) {
+    stub = StubRoutines::dexp_array();
+  } else if (entry == StubRoutines::dlog()) {
+    stub = StubRoutines::dlog_array();
+  } else if (entry == StubRoutines::dlog10()) {
+    stub = StubRoutines::dlog10_array();
+  } else {
+    return false;
+  }
+  if (stub == NULL) {
+    return false;
+  }
+
+  // ... applied to a double loaded from the same memory state.
+  load = call->in(TypeFunc::Parms);
+  if (load->Opcode() != Op_LoadD || load->in(MemNode::Memory) != mem_phi) {
+    return false;
+  }
+
+  // Both addresses are at the loop index with the same offset, so the
+  // arrays are either different or the loop updates in place; a value
+  // stored in one iteration is never loaded by a later one.
+  VectorSet ok(Thread::current()->resource_area());
+  Node* store_offset;
+  Node* store_shift;
+  Node* load_offset;
+  Node* load_shift;
+  if (!_igvn.type(store->in(MemNode::Address))->isa_aryptr() ||
+      !_igvn.type(load->in(MemNode::Address))->isa_aryptr() ||
+      !match_double_element(store->in(MemNode::Address), head->phi(),
+                            store_offset, store_shift, ok) ||
+      !match_double_element(load->in(MemNode::Address), head->phi(),
+                            load_offset, load_shift, ok) ||
+      store_offset != load_offset) {
+    return false;
+  }
+
+  // Make sure all the other nodes in the loop can be handled
+  CountedLoopEndNode* loop_exit = head->loopexit();
+  guarantee(loop_exit != NULL, "no loop exit node");
+  Node* call_ctrl = call->proj_out(TypeFunc::Control);
+  if (call_ctrl == NULL) {
+    return false;
+  }
+  ok.set(store->_idx);
+  ok.set(mem_phi->_idx);
+  ok.set(load->_idx);
+  ok.set(call->_idx);
+  ok.set(call_ctrl->_idx);
+  ok.set(value->_idx);
+  ok.set(head->_idx);
+  ok.set(loop_exit->_idx);
+  ok.set(head->phi()->_idx);
+  ok.set(head->incr()->_idx);
+  ok.set(loop_exit->cmp_node()->_idx);
+  ok.set(loop_exit->in(1)->_idx);
+
+  for (uint i = 0; i < lpt->_body.size(); i++) {
+    Node* n = lpt->_body.at(i);
+    if (n->outcnt() == 0) continue; // Ignore dead
+    if (ok.test(n->_idx)) continue;
+    // Backedge projection is ok
+    if (n->is_IfTrue() && n->in(0) == loop_exit) continue;
+    if (n->is_AddP()) continue;
+    // The memory state the parser hooked to the call
+    if (n->is_MergeMem() && n->outcnt() == 1 && n->unique_out() == call) continue;
+    return false;
+  }
+
+  // Make sure no unexpected values are used outside the loop
+  for (uint i = 0; i < lpt->_body.size(); i++) {
+    Node* n = lpt->_body.at(i);
+    if (n == store || n == loop_exit || n == head->incr() || n == mem_phi) continue;
+    for (SimpleDUIterator iter(n); iter.has_next(); iter.next()) {
+      if (!lpt->_body.contains(iter.get())) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+
+// Build the address of the first element covered by the loop.
+static Node* first_element_address(PhaseIterGVN& igvn, Compile* C, Node* adr, Node* init) {
+  Node* base = adr->as_AddP()->in(AddPNode::Base);
+  Node* elements[4];
+  int count = adr->as_AddP()->unpack_offsets(elements, ARRAY_SIZE(elements));
+  Node* offset = NULL;
+  Node* shift = NULL;
+  for (int e = 0; e < count; e++) {
+    if (elements[e]->is_Con()) {
+      offset = elements[e];
+    } else {
+      shift = elements[e];
+    }
+  }
+  assert(offset != NULL && shift != NULL, "checked by match_double_element");
+
+  Node* index = init;
+#ifdef _LP64
+  index = new (C) ConvI2LNode(index);
+  igvn.register_new_node_with_optimizer(index);
+#endif
+  index = new (C) LShiftXNode(index, shift->in(2));
+  igvn.register_new_node_with_optimizer(index);
+  index = new (C) AddPNode(base, base, index);
+  igvn.register_new_node_with_optimizer(index);
+  Node* from = new (C) AddPNode(base, index, offset);
+  igvn.register_new_node_with_optimizer(from);
+  return from;
+}
+
+
+bool PhaseIdealLoop::intrinsify_math(IdealLoopTree* lpt) {
+  // Only for counted inner loops
+  if (!lpt->is_counted() || !lpt->is_inner()) {
+    return false;
+  }
+
+  // Must have constant stride
+  CountedLoopNode* head = lpt->_head->as_CountedLoop();
+  if (!head->is_valid_counted_loop() || !head->is_normal_loop()) {
+    return false;
+  }
+
+  Node* store = NULL;
+  Node* load = NULL;
+  CallLeafNode* math_call = NULL;
+  address stub = NULL;
+  if (!match_math_loop(lpt, store, load, math_call, stub)) {
+    return false;
+  }
+
+  Node* exit = head->loopexit()->proj_out(0);
+  if (exit == NULL) {
+    return false;
+  }
+
+  const char* stub_name = (stub == StubRoutines::dexp_array()) ? "dexp_array" :
+                          (stub == StubRoutines::dlog_array()) ? "dlog_array" : "dlog10_array";
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("ArrayMath    ");
+    lpt->dump_head();
+  }
+#endif
+  if (C->print_intrinsics()) {
+    ResourceMark rm;
+    ttyLocker ttyl;
+    tty->print_cr("ArrayMath %s in %s::%s", stub_name,
+                  C->method()->holder()->name()->as_utf8(),
+                  C->method()->name()->as_utf8());
+  }
+
+  // Replace the whole loop by a call to the array stub that covers the
+  // same elements as the loop.
+  Node* src = first_element_address(_igvn, C, load->in(MemNode::Address), head->init_trip());
+  Node* dst = first_element_address(_igvn, C, store->in(MemNode::Address), head->init_trip());
+  Node* len = new (C) SubINode(head->limit(), head->init_trip());
+  _igvn.register_new_node_with_optimizer(len);
+#ifdef _LP64
+  len = new (C) ConvI2LNode(len);
+  _igvn.register_new_node_with_optimizer(len);
+#endif
+
+  Node* mem_phi = store->in(MemNode::Memory);
+  CallLeafNode* call = new (C) CallLeafNode(OptoRuntime::array_math_Type(), stub,
+                                            stub_name, TypeAryPtr::DOUBLES);
+  uint cnt = 0;
+  call->init_req(TypeFunc::Parms + cnt++, src);
+  call->init_req(TypeFunc::Parms + cnt++, dst);
+  call->init_req(TypeFunc::Parms + cnt++, len);
+#ifdef _LP64
+  call->init_req(TypeFunc::Parms + cnt++, C->top());
+#endif
+  call->init_req(TypeFunc::Control,   head->init_control());
+  call->init_req(TypeFunc::I_O,       C->top());       // Does no I/O.
+  call->init_req(TypeFunc::Memory,    mem_phi->in(LoopNode::EntryControl));
+  call->init_req(TypeFunc::ReturnAdr, C->start()->proj_out(TypeFunc::ReturnAdr));
+  call->init_req(TypeFunc::FramePtr,  C->start()->proj_out(TypeFunc::FramePtr));
+  _igvn.register_new_node_with_optimizer(call);
+  Node* result_ctrl = new (C) ProjNode(call, TypeFunc::Control);
+  _igvn.register_new_node_with_optimizer(result_ctrl);
+  Node* result_mem = new (C) ProjNode(call, TypeFunc::Memory);
+  _igvn.register_new_node_with_optimizer(result_mem);
+
+  // Redirect the old control and memory edges that are outside the loop.
+  _igvn.replace_node(mem_phi, result_mem);
+  lazy_replace(exit, result_ctrl);
+  _igvn.replace_node(store, result_mem);
+  // Any uses the increment outside of the loop become the loop limit.
+  _igvn.replace_node(head->incr(), head->limit());
+
+  // Disconnect the head from the loop.
+  for (uint i = 0; i < lpt->_body.size(); i++) {
+    Node* n = lpt->_body.at(i);
+    _igvn.replace_node(n, C->top());
+  }
+
+  return true;
+}
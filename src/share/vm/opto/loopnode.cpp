@@ -59,6 +59,7 @@ void LoopNode::dump_spec(outputStream *st) const {
   if (is_inner_loop()) st->print( "inner " );
   if (is_partial_peel_loop()) st->print( "partial_peel " );
   if (partial_peel_has_failed()) st->print( "partial_peel_failed " );
+  if (is_strip_mined()) st->print( "strip_mined " );
 }
 #endif
 
@@ -269,6 +270,10 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
   if (x->in(LoopNode::Self) == NULL || x->req() != 3 || loop->_irreducible) {
     return false;
   }
+  // The outer loop of a strip mined loop only exists to poll the safepoint.
+  if (x->is_Loop() && x->as_Loop()->is_strip_mined()) {
+    return false;
+  }
   Node *init_control = x->in(LoopNode::EntryControl);
   Node *back_control = x->in(LoopNode::LoopBackControl);
   if (init_control == NULL || back_control == NULL)    // Partially dead
@@ -596,6 +601,32 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
   }
   set_subtree_ctrl( limit );
 
+  if (LoopStripMiningIter > 0 && !UseCountedLoopSafepoints &&
+      loop->_child == NULL && trunc1 == NULL && bt != BoolTest::ne) {
+    Node* sfpt = x->in(LoopNode::LoopBackControl);
+    jlong span = (jlong)stride_con * LoopStripMiningIter;
+    // Loops known to be short keep an exact trip count (for maximal
+    // unrolling) and don't need the poll.
+    const TypeInt* canon_limit_t = gvn->type(limit)->is_int();
+    jlong max_trips = (stride_con > 0) ? ((jlong)canon_limit_t->_hi - init_t->_lo) / stride_con
+                                       : ((jlong)canon_limit_t->_lo - init_t->_hi) / stride_con;
+    if (sfpt->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt) &&
+        max_trips > (jlong)LoopStripMiningIter &&
+        span <= (jlong)max_jint && span >= (jlong)min_jint) {
+      // Keep the safepoint in an outer loop and make the strip the
+      // counted loop: from here on iff is the strip's loop-end test
+      // and the strip limit is the limit of the counted loop.
+      Node* strip_limit = NULL;
+      iff = strip_mine_loop(loop, sfpt, iff->as_If(), phi, incr, limit, stride_con, bt, cl_prob,
+                            strip_limit);
+      limit = strip_limit;
+      iftrue = iff->as_If()->proj_out(true);
+      iftrue_op = Op_IfTrue;
+      back_control = iftrue;
+      init_control = x->in(LoopNode::EntryControl);
+    }
+  }
+
   } else { // LoopLimitCheck
 
   // If compare points to incr, we are ok.  Otherwise the compare
@@ -821,6 +852,202 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
   return true;
 }
 
+//------------------------------strip_mine_loop--------------------------------
+// Loop strip mining.  Rather than dropping the backedge safepoint of a loop
+// about to become a counted loop, nest the loop in an outer loop that keeps
+// the safepoint on its backedge:
+//
+//   outer: phis merging the entry values of the loop phis
+//     strip_limit = MIN(limit, outer_iv + stride * LoopStripMiningIter)
+//     loop:  body; if (incr < strip_limit) goto loop;
+//     if (incr < limit) { safepoint; goto outer; }
+//
+// The exit test, in its canonical form, is kept as the outer loop test, so
+// the strip limit only bounds the number of iterations between two polls and
+// needs no overflow check of its own.  Returns the new loop-end test of the
+// loop and, in strip_limit, the limit the counted loop must be built with.
+IfNode* PhaseIdealLoop::strip_mine_loop(IdealLoopTree* loop, Node* sfpt, IfNode* iff, PhiNode* phi,
+                                        Node* incr, Node* limit, int stride_con, BoolTest::mask bt,
+                                        float cl_prob, Node*& strip_limit) {
+  PhaseGVN *gvn = &_igvn;
+  Node* x = loop->_head;
+  Node* init_control = x->in(LoopNode::EntryControl);
+
+  LoopNode* outer_head = new (C) LoopNode(init_control, sfpt);
+  outer_head->mark_strip_mined();
+  _igvn.register_new_node_with_optimizer(outer_head);
+
+  // Insert the outer loop in the loop tree, in place of the loop.
+  IdealLoopTree* outer = new IdealLoopTree(this, outer_head, sfpt);
+  IdealLoopTree* parent = loop->_parent;
+  outer->_parent   = parent;
+  outer->_next     = loop->_next;
+  outer->_child    = loop;
+  outer->_nest     = loop->_nest;
+  outer->_has_call = loop->_has_call;
+  outer->_has_sfpt = 1;
+  if (parent->_child == loop) {
+    parent->_child = outer;
+  } else {
+    IdealLoopTree* prev = parent->_child;
+    while (prev->_next != loop) {
+      prev = prev->_next;
+    }
+    prev->_next = outer;
+  }
+  loop->_parent = outer;
+  loop->_next   = NULL;
+  loop->_nest++;
+
+  // Sections of the dominator tree may share a depth, see dom_lca_internal.
+  uint dd = dom_depth(x);
+  set_loop(outer_head, outer);
+  set_idom(outer_head, init_control, dd);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  set_idom(x, outer_head, dd);
+
+  // Every loop phi gets an outer phi: it merges the entry value with the
+  // value on the backedge of the last iteration of the previous strip.
+  Node_List phis;
+  for (DUIterator_Fast imax, i = x->fast_outs(imax); i < imax; i++) {
+    Node* n = x->fast_out(i);
+    if (n->is_Phi() && n->in(0) == x) {
+      phis.push(n);
+    }
+  }
+  Node* outer_iv = NULL;
+  for (uint i = 0; i < phis.size(); i++) {
+    Node* inner_phi = phis.at(i);
+    Node* outer_phi = inner_phi->clone();
+    outer_phi->set_req(0, outer_head);
+    _igvn.register_new_node_with_optimizer(outer_phi);
+    set_ctrl(outer_phi, outer_head);
+    _igvn.replace_input_of(inner_phi, LoopNode::EntryControl, outer_phi);
+    if (inner_phi == phi) {
+      outer_iv = outer_phi;
+    }
+  }
+  assert(outer_iv != NULL, "trip counter is a loop phi");
+
+  // Clamp the trip counter before adding the span so that the sum cannot
+  // overflow: near the end of the int range the last strip then simply
+  // runs to the limit, which is less than a span away.
+  int span_con = stride_con * (int)LoopStripMiningIter;
+  Node* span = _igvn.intcon(span_con);
+  if (stride_con > 0) {
+    Node* clamp = _igvn.intcon(max_jint - span_con);
+    Node* base = gvn->transform(new (C) MinINode(outer_iv, clamp));
+    strip_limit = gvn->transform(new (C) AddINode(base, span));
+    strip_limit = gvn->transform(new (C) MinINode(limit, strip_limit));
+  } else {
+    Node* clamp = _igvn.intcon(min_jint - span_con);
+    Node* base = gvn->transform(new (C) MaxINode(outer_iv, clamp));
+    strip_limit = gvn->transform(new (C) AddINode(base, span));
+    strip_limit = gvn->transform(new (C) MaxINode(limit, strip_limit));
+  }
+  set_subtree_ctrl(strip_limit);
+
+  Node* cmp = gvn->transform(new (C) CmpINode(incr, strip_limit));
+  Node* bol = gvn->transform(new (C) BoolNode(cmp, bt));
+  set_subtree_ctrl(bol);
+
+  // New loop-end test of the strip, in front of the original test.
+  Node* body_ctrl = iff->in(0);
+  uint dd_iff = dom_depth(iff);
+  IfNode* strip_iff = new (C) IfNode(body_ctrl, bol, cl_prob, iff->_fcnt);
+  _igvn.register_new_node_with_optimizer(strip_iff);
+  Node* strip_back = _igvn.register_new_node_with_optimizer(new (C) IfTrueNode(strip_iff));
+  Node* strip_exit = _igvn.register_new_node_with_optimizer(new (C) IfFalseNode(strip_iff));
+  set_loop(strip_iff, loop);
+  set_idom(strip_iff, body_ctrl, dd_iff);
+  set_loop(strip_back, loop);
+  set_idom(strip_back, strip_iff, dd_iff + 1);
+  set_loop(strip_exit, outer);
+  set_idom(strip_exit, strip_iff, dd_iff + 1);
+
+  // The original test now runs once per strip and continues the outer loop
+  // through the safepoint.  Give it the canonical form of the exit test, so
+  // that loop predication can read the range of the whole loop from it.
+  BoolTest::mask outer_bt = (sfpt->in(TypeFunc::Control)->Opcode() == Op_IfTrue) ? bt : BoolTest(bt).negate();
+  Node* outer_cmp = gvn->transform(new (C) CmpINode(incr, limit));
+  Node* outer_bol = gvn->transform(new (C) BoolNode(outer_cmp, outer_bt));
+  set_subtree_ctrl(outer_bol);
+  _igvn.replace_input_of(iff, 1, outer_bol);
+  _igvn.replace_input_of(iff, 0, strip_exit);
+  set_loop(iff, outer);
+  set_idom(iff, strip_exit, dd_iff + 1);
+  set_loop(sfpt->in(TypeFunc::Control), outer);
+  set_loop(sfpt, outer);
+  _igvn.replace_input_of(x, LoopNode::LoopBackControl, strip_back);
+  if (loop->_safepts != NULL) {
+    loop->_safepts->yank(sfpt);
+  }
+  loop->_tail = strip_back;
+
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("StripMined   ");
+    loop->dump_head();
+  }
+#endif
+
+  C->set_major_progress();
+  return strip_iff;
+}
+
+//------------------------------strip_mined_range------------------------------
+// The strips of a strip mined loop together cover the iteration space of the
+// loop before strip mining.  Return the entry value of the trip counter and
+// the limit of that space, as found on the outer loop, or false if the outer
+// loop lost the shape strip_mine_loop gave it.
+bool PhaseIdealLoop::strip_mined_range(CountedLoopNode* cl, Node*& init, Node*& limit) {
+  Node* outer_head = cl->in(LoopNode::EntryControl);
+  assert(outer_head->is_Loop() && outer_head->as_Loop()->is_strip_mined(), "not a strip mined loop");
+  IdealLoopTree* outer = get_loop(outer_head);
+  Node* outer_iv = cl->init_trip();
+  if (!outer_iv->is_Phi() || outer_iv->in(0) != outer_head) {
+    return false;
+  }
+  // The outer test directly follows the exit of the strip and continues
+  // the outer loop.
+  Node* exit = cl->loopexit()->proj_out(false);
+  Node* outer_iff = (exit != NULL) ? exit->unique_ctrl_out() : NULL;
+  if (outer_iff == NULL || !outer_iff->is_If() || get_loop(outer_iff) != outer ||
+      !outer_iff->in(1)->is_Bool()) {
+    return false;
+  }
+  Node* back = outer_head->in(LoopNode::LoopBackControl);
+  if (back->Opcode() == Op_SafePoint) {
+    back = back->in(TypeFunc::Control);
+  }
+  if (!back->is_Proj() || back->in(0) != outer_iff) {
+    return false;
+  }
+  BoolNode* bol = outer_iff->in(1)->as_Bool();
+  BoolTest::mask bt = (back->Opcode() == Op_IfTrue) ? bol->_test._test : bol->_test.negate();
+  Node* cmp = bol->in(1);
+  if (bt != cl->loopexit()->test_trip() || cmp->Opcode() != Op_CmpI) {
+    return false;
+  }
+  // The outer test and the outer trip counter both use the value of the
+  // trip counter at the exit of the strip.
+  Node* incr = cmp->in(1);
+  if (incr != cl->incr() &&
+      (incr->Opcode() != Op_AddI || incr->in(1) != cl->phi() || incr->in(2) != cl->stride())) {
+    return false;
+  }
+  Node* outer_incr = outer_iv->in(LoopNode::LoopBackControl);
+  if (outer_incr != incr && outer_incr != cl->incr()) {
+    return false;
+  }
+  if (outer->is_member(get_loop(get_ctrl(cmp->in(2))))) {
+    return false;
+  }
+  init  = outer_iv->in(LoopNode::EntryControl);
+  limit = cmp->in(2);
+  return true;
+}
+
 //----------------------exact_limit-------------------------------------------
 Node* PhaseIdealLoop::exact_limit( IdealLoopTree *loop ) {
   assert(loop->_head->is_CountedLoop(), "");
@@ -1866,6 +2093,9 @@ void IdealLoopTree::remove_safepoints(PhaseIdealLoop* phase, bool keep_one) {
 //------------------------------counted_loop-----------------------------------
 // Convert to counted loops where possible
 void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
+  // Strip mining may nest this loop in a new outer loop that takes over
+  // its place among the siblings.
+  IdealLoopTree* next = _next;
 
   // For grins, set the inner-loop flag here
   if (!_child) {
@@ -1895,7 +2125,7 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
 
   // Recursively
   if (_child) _child->counted_loop( phase );
-  if (_next)  _next ->counted_loop( phase );
+  if (next)   next  ->counted_loop( phase );
 }
 
 #ifndef PRODUCT
@@ -2406,6 +2636,12 @@ void PhaseIdealLoop::build_and_optimize(bool do_split_ifs, bool skip_loop_opts)
     }
   }
 
+  if (OptimizeMathLoops && UseLoopPredicate && C->has_loops() && !C->major_progress()) {
+    if (do_intrinsify_math()) {
+      C->set_major_progress();
+    }
+  }
+
   // Perform iteration-splitting on inner loops.  Split iterations to avoid
   // range checks or one-shot null checks.
 
@@ -62,7 +62,11 @@ protected:
          HasExactTripCount=8,
          InnerLoop=16,
          PartialPeelLoop=32,
-         PartialPeelFailed=64 };
+         PartialPeelFailed=64,
+         HasReductions=128,
+         VectorDrainLoop=256,
+         HasVectorDrainLoop=512,
+         StripMined=1024 };
   char _unswitch_count;
   enum { _unswitch_max=3 };
 
@@ -77,6 +81,14 @@ public:
   void set_partial_peel_loop() { _loop_flags |= PartialPeelLoop; }
   int partial_peel_has_failed() const { return _loop_flags & PartialPeelFailed; }
   void mark_partial_peel_failed() { _loop_flags |= PartialPeelFailed; }
+  int is_reduction_loop() const { return _loop_flags & HasReductions; }
+  void mark_has_reductions() { _loop_flags |= HasReductions; }
+  int is_vector_drain_loop() const { return _loop_flags & VectorDrainLoop; }
+  void mark_vector_drain_loop() { _loop_flags |= VectorDrainLoop; }
+  int has_vector_drain_loop() const { return _loop_flags & HasVectorDrainLoop; }
+  void mark_has_vector_drain_loop() { _loop_flags |= HasVectorDrainLoop; }
+  int is_strip_mined() const { return _loop_flags & StripMined; }
+  void mark_strip_mined() { _loop_flags |= StripMined; }
 
   int unswitch_max() { return _unswitch_max; }
   int unswitch_count() { return _unswitch_count; }
@@ -460,6 +472,10 @@ public:
   // the loop is a CountedLoop and the body is small enough.
   bool policy_unroll( PhaseIdealLoop *phase ) const;
 
+  // Return TRUE if a vector drain loop should be split off the main loop
+  // before it is unrolled past the narrowest vector SuperWord can use.
+  bool policy_vector_drain( PhaseIdealLoop *phase ) const;
+
   // Return TRUE or FALSE if the loop should be range-check-eliminated.
   // Gather a list of IF tests that are dominated by iteration splitting;
   // also gather the end of the first split and the start of the 2nd split.
@@ -829,6 +845,10 @@ public:
   virtual Node *transform( Node *a_node ) { return 0; }
 
   bool is_counted_loop( Node *x, IdealLoopTree *loop );
+  IfNode* strip_mine_loop(IdealLoopTree* loop, Node* sfpt, IfNode* iff, PhiNode* phi,
+                          Node* incr, Node* limit, int stride_con, BoolTest::mask bt,
+                          float cl_prob, Node*& strip_limit);
+  bool strip_mined_range(CountedLoopNode* cl, Node*& init, Node*& limit);
 
   Node* exact_limit( IdealLoopTree *loop );
 
@@ -874,6 +894,15 @@ public:
   // Add pre and post loops around the given loop.  These loops are used
   // during RCE, unrolling and aligning loops.
   void insert_pre_post_loops( IdealLoopTree *loop, Node_List &old_new, bool peel_only );
+  // Clone the main loop as a post loop guarded by a zero-trip test on its
+  // exit and return the head of the clone.
+  CountedLoopNode* insert_post_loop( IdealLoopTree *loop, Node_List &old_new,
+                                     CountedLoopNode *main_head, CountedLoopEndNode *main_end,
+                                     Node *incr, Node *limit );
+  // Insert a copy of the main loop at its current unroll factor between the
+  // main and the post loop.  SuperWord vectorizes it at that narrower width,
+  // so the scalar post loop is left with less than one vector of work.
+  void insert_vector_drain_loop( IdealLoopTree *loop, Node_List &old_new );
   // If Node n lives in the back_ctrl block, we clone a private version of n
   // in preheader_ctrl block and return that, otherwise return n.
   Node *clone_up_backedge_goo( Node *back_ctrl, Node *preheader_ctrl, Node *n, VectorSet &visited, Node_Stack &clones );
@@ -887,6 +916,10 @@ public:
   // Unroll the loop body one step - make each trip do 2 iterations.
   void do_unroll( IdealLoopTree *loop, Node_List &old_new, bool adjust_min_trip );
 
+  // Mark the loop carried operations of simple reductions (sum, product,
+  // min, max) so SuperWord can vectorize them across the unrolled body.
+  void mark_reductions( IdealLoopTree *loop );
+
   // Return true if exp is a constant times an induction var
   bool is_scaled_iv(Node* exp, Node* iv, int* p_scale);
 
@@ -1055,6 +1088,12 @@ public:
   bool match_fill_loop(IdealLoopTree* lpt, Node*& store, Node*& store_value,
                        Node*& shift, Node*& offset);
 
+  // Conversion of dst[i] = Math.exp/log/log10(src[i]) loops into a stub call
+  bool do_intrinsify_math();
+  bool intrinsify_math(IdealLoopTree* lpt);
+  bool match_math_loop(IdealLoopTree* lpt, Node*& store, Node*& load,
+                       CallLeafNode*& call, address& stub);
+
 private:
   // Return a type based on condition control flow
   const TypeInt* filtered_type( Node *n, Node* n_ctrl);
@@ -703,7 +703,8 @@ public:
     Flag_avoid_back_to_back_after    = Flag_avoid_back_to_back_before << 1,
     Flag_has_call                    = Flag_avoid_back_to_back_after << 1,
     Flag_is_expensive                = Flag_has_call << 1,
-    _max_flags = (Flag_is_expensive << 1) - 1 // allow flags combination
+    Flag_is_reduction                = Flag_is_expensive << 1,
+    _max_flags = (Flag_is_reduction << 1) - 1 // allow flags combination
   };
 
 private:
@@ -730,6 +731,10 @@ public:
 
   const jushort flags() const { return _flags; }
 
+  void add_flag(jushort fl) { init_flags(fl); }
+
+  void remove_flag(jushort fl) { clear_flag(fl); }
+
   // Return a dense integer opcode number
   virtual int Opcode() const;
 
@@ -880,6 +885,8 @@ public:
   bool is_macro() const { return (_flags & Flag_is_macro) != 0; }
   // The node is expensive: the best control is set during loop opts
   bool is_expensive() const { return (_flags & Flag_is_expensive) != 0 && in(0) != NULL; }
+  // The node is the loop carried operation of a reduction (sum, product, min, max)
+  bool is_reduction() const { return (_flags & Flag_is_reduction) != 0; }
 
 //----------------- Optimization
 
@@ -55,6 +55,16 @@ class InlineTree : public ResourceObj {
   const int   _max_inline_level;  // the maximum inline level for this sub-tree (may be adjusted)
   float compute_callee_frequency( int caller_bci ) const;
 
+  // Frequency-driven inlining budget (see InlineFrequencyBudget).
+  // callee_site_ratio() is the site invoke ratio a callee at caller_bci
+  // would get, or a negative value if the call site was not profiled.
+  float callee_site_ratio(int caller_bci) const;
+  int   remaining_inline_budget() const;
+  int   inline_budget_for(float site_ratio) const;
+  bool  is_hot_call_site(float site_ratio) const {
+    return InlineFrequencyBudget && site_ratio >= InlineHotCallSiteRatio;
+  }
+
   GrowableArray<InlineTree*> _subtrees;
 
   void print_impl(outputStream* stj, int indent) const PRODUCT_RETURN;
@@ -552,7 +562,9 @@ class Parse : public GraphKit {
   float   dynamic_branch_prediction(float &cnt, BoolTest::mask btest, Node* test);
   float   branch_prediction(float &cnt, BoolTest::mask btest, int target_bci, Node* test);
   bool    seems_never_taken(float prob) const;
-  bool    path_is_suitable_for_uncommon_trap(float prob) const;
+  bool    seems_rare_with_live_allocation(float prob, Block* path) const;
+  bool    path_uses_fresh_allocation(Block* path) const;
+  bool    path_is_suitable_for_uncommon_trap(float prob, Block* path) const;
   bool    seems_stable_comparison() const;
 
   void    do_ifnull(BoolTest::mask btest, Node* c);
@@ -565,13 +577,16 @@ class Parse : public GraphKit {
                                 Node* val, const Type* tval);
   IfNode* jump_if_fork_int(Node* a, Node* b, BoolTest::mask mask);
   Node*   jump_if_join(Node* iffalse, Node* iftrue);
-  void    jump_if_true_fork(IfNode *ifNode, int dest_bci_if_true, int prof_table_index);
-  void    jump_if_false_fork(IfNode *ifNode, int dest_bci_if_false, int prof_table_index);
-  void    jump_if_always_fork(int dest_bci_if_true, int prof_table_index);
+  void    jump_if_true_fork(IfNode *ifNode, int dest_bci_if_true, int prof_table_index, bool never_taken = false);
+  void    jump_if_false_fork(IfNode *ifNode, int dest_bci_if_false, int prof_table_index, bool never_taken = false);
+  void    jump_if_always_fork(int dest_bci_if_true, int prof_table_index, bool never_taken = false);
+  void    switch_case_never_taken();
 
   friend class SwitchRange;
   void    do_tableswitch();
   void    do_lookupswitch();
+  ciMultiBranchData* switch_profile();
+  SwitchRange* merge_never_taken_ranges(SwitchRange* lo, SwitchRange* hi);
   void    jump_switch_ranges(Node* a, SwitchRange* lo, SwitchRange* hi, int depth = 0);
   bool    create_jump_tables(Node* a, SwitchRange* lo, SwitchRange* hi);
 
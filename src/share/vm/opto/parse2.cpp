@@ -192,13 +192,17 @@ Node* Parse::jump_if_join(Node* iffalse, Node* iftrue) {
 
 
 //------------------------------helper for tableswitch-------------------------
-void Parse::jump_if_true_fork(IfNode *iff, int dest_bci_if_true, int prof_table_index) {
+void Parse::jump_if_true_fork(IfNode *iff, int dest_bci_if_true, int prof_table_index, bool never_taken) {
   // True branch, use existing map info
   { PreserveJVMState pjvms(this);
     Node *iftrue  = _gvn.transform( new (C) IfTrueNode (iff) );
     set_control( iftrue );
-    profile_switch_case(prof_table_index);
-    merge_new_path(dest_bci_if_true);
+    if (never_taken) {
+      switch_case_never_taken();
+    } else {
+      profile_switch_case(prof_table_index);
+      merge_new_path(dest_bci_if_true);
+    }
   }
 
   // False branch
@@ -206,13 +210,17 @@ void Parse::jump_if_true_fork(IfNode *iff, int dest_bci_if_true, int prof_table_
   set_control( iffalse );
 }
 
-void Parse::jump_if_false_fork(IfNode *iff, int dest_bci_if_true, int prof_table_index) {
+void Parse::jump_if_false_fork(IfNode *iff, int dest_bci_if_true, int prof_table_index, bool never_taken) {
   // True branch, use existing map info
   { PreserveJVMState pjvms(this);
     Node *iffalse  = _gvn.transform( new (C) IfFalseNode (iff) );
     set_control( iffalse );
-    profile_switch_case(prof_table_index);
-    merge_new_path(dest_bci_if_true);
+    if (never_taken) {
+      switch_case_never_taken();
+    } else {
+      profile_switch_case(prof_table_index);
+      merge_new_path(dest_bci_if_true);
+    }
   }
 
   // False branch
@@ -220,10 +228,26 @@ void Parse::jump_if_false_fork(IfNode *iff, int dest_bci_if_true, int prof_table
   set_control( iftrue );
 }
 
-void Parse::jump_if_always_fork(int dest_bci, int prof_table_index) {
+void Parse::jump_if_always_fork(int dest_bci, int prof_table_index, bool never_taken) {
   // False branch, use existing map and control()
-  profile_switch_case(prof_table_index);
-  merge_new_path(dest_bci);
+  if (never_taken) {
+    switch_case_never_taken();
+  } else {
+    profile_switch_case(prof_table_index);
+    merge_new_path(dest_bci);
+  }
+}
+
+// Cases the profile never saw get an uncommon trap instead of a path
+// to their target, so a target reached only from such cases is never
+// parsed, nor are the calls in it inlined.  The switch key is pushed
+// back so the switch is reexecuted in the interpreter.
+void Parse::switch_case_never_taken() {
+  repush_if_args();
+  uncommon_trap(Deoptimization::Reason_unstable_if,
+                Deoptimization::Action_reinterpret,
+                NULL,
+                "switch case never taken");
 }
 
 
@@ -246,32 +270,44 @@ class SwitchRange : public StackObj {
   jint _hi;                     // inclusive upper limit
   int _dest;
   int _table_index;             // index into method data table
+  bool _never_taken;            // profile saw no key in this range
 
 public:
   jint lo() const              { return _lo;   }
   jint hi() const              { return _hi;   }
   int  dest() const            { return _dest; }
   int  table_index() const     { return _table_index; }
+  bool never_taken() const     { return _never_taken; }
   bool is_singleton() const    { return _lo == _hi; }
 
-  void setRange(jint lo, jint hi, int dest, int table_index) {
+  void setRange(jint lo, jint hi, int dest, int table_index, bool never_taken = false) {
     assert(lo <= hi, "must be a non-empty range");
-    _lo = lo, _hi = hi; _dest = dest; _table_index = table_index;
+    _lo = lo, _hi = hi; _dest = dest; _table_index = table_index; _never_taken = never_taken;
   }
-  bool adjoinRange(jint lo, jint hi, int dest, int table_index) {
+  bool adjoinRange(jint lo, jint hi, int dest, int table_index, bool never_taken = false) {
     assert(lo <= hi, "must be a non-empty range");
-    if (lo == _hi+1 && dest == _dest && table_index == _table_index) {
+    if (lo == _hi+1 && dest == _dest && table_index == _table_index &&
+        never_taken == _never_taken) {
       _hi = hi;
       return true;
     }
     return false;
   }
 
-  void set (jint value, int dest, int table_index) {
-    setRange(value, value, dest, table_index);
+  void set (jint value, int dest, int table_index, bool never_taken = false) {
+    setRange(value, value, dest, table_index, never_taken);
+  }
+  bool adjoin(jint value, int dest, int table_index, bool never_taken = false) {
+    return adjoinRange(value, value, dest, table_index, never_taken);
   }
-  bool adjoin(jint value, int dest, int table_index) {
-    return adjoinRange(value, value, dest, table_index);
+
+  // Both ranges end up in the same place: the same destination, or
+  // the uncommon trap if neither was ever taken.
+  bool same_target(const SwitchRange* r) const {
+    if (_never_taken || r->_never_taken) {
+      return _never_taken == r->_never_taken;
+    }
+    return _dest == r->_dest;
   }
 
   void print() {
@@ -283,10 +319,47 @@ public:
       tty->print(" {%d..}=>%d", lo(), dest());
     else
       tty->print(" {%d..%d}=>%d", lo(), hi(), dest());
+    if (never_taken())
+      tty->print("(never)");
   }
 };
 
 
+//--------------------------------switch_profile-------------------------------
+// Profile of the current tableswitch or lookupswitch, if it has seen enough
+// keys to tell a case that is never taken from a rare one.  NULL otherwise.
+ciMultiBranchData* Parse::switch_profile() {
+  if (!UseSwitchProfiling || method_data_update()) {
+    return NULL;
+  }
+  // Tier 3 code doesn't update MultiBranchData, so with tiered
+  // compilation a case that was taken may still have a zero count.
+  if (TieredCompilation) {
+    return NULL;
+  }
+  // Don't want to speculate on uncommon traps when running with -Xcomp,
+  // nor keep trapping at a switch whose profile is not stable.
+  if (!UseInterpreter || !seems_stable_comparison()) {
+    return NULL;
+  }
+  ciMethodData* methodData = method()->method_data();
+  if (!methodData->is_mature())  return NULL;
+  ciProfileData* data = methodData->bci_to_data(bci());
+  if (data == NULL || !data->is_MultiBranchData())  return NULL;
+  ciMultiBranchData* profile = (ciMultiBranchData*)data->as_MultiBranchData();
+
+  // Give up if too few counts to be meaningful, as for branches.
+  julong sum = profile->default_count();
+  for (int i = 0; i < profile->number_of_cases(); i++) {
+    sum += profile->count_at(i);
+  }
+  if (sum < 40) {
+    return NULL;
+  }
+  return profile;
+}
+
+
 //-------------------------------do_tableswitch--------------------------------
 void Parse::do_tableswitch() {
   Node* lookup = pop();
@@ -304,28 +377,32 @@ void Parse::do_tableswitch() {
     return;
   }
 
+  ciMultiBranchData* profile = switch_profile();
+  bool default_never_taken = (profile != NULL && profile->default_count() == 0);
+
   // generate decision tree, using trichotomy when possible
   int rnum = len+2;
   bool makes_backward_branch = false;
   SwitchRange* ranges = NEW_RESOURCE_ARRAY(SwitchRange, rnum);
   int rp = -1;
   if (lo_index != min_jint) {
-    ranges[++rp].setRange(min_jint, lo_index-1, default_dest, NullTableIndex);
+    ranges[++rp].setRange(min_jint, lo_index-1, default_dest, NullTableIndex, default_never_taken);
   }
   for (int j = 0; j < len; j++) {
     jint match_int = lo_index+j;
     int  dest      = iter().get_dest_table(j+3);
     makes_backward_branch |= (dest <= bci());
     int  table_index = method_data_update() ? j : NullTableIndex;
-    if (rp < 0 || !ranges[rp].adjoin(match_int, dest, table_index)) {
-      ranges[++rp].set(match_int, dest, table_index);
+    bool never_taken = (profile != NULL && profile->count_at(j) == 0);
+    if (rp < 0 || !ranges[rp].adjoin(match_int, dest, table_index, never_taken)) {
+      ranges[++rp].set(match_int, dest, table_index, never_taken);
     }
   }
   jint highest = lo_index+(len-1);
   assert(ranges[rp].hi() == highest, "");
   if (highest != max_jint
-      && !ranges[rp].adjoinRange(highest+1, max_jint, default_dest, NullTableIndex)) {
-    ranges[++rp].setRange(highest+1, max_jint, default_dest, NullTableIndex);
+      && !ranges[rp].adjoinRange(highest+1, max_jint, default_dest, NullTableIndex, default_never_taken)) {
+    ranges[++rp].setRange(highest+1, max_jint, default_dest, NullTableIndex, default_never_taken);
   }
   assert(rp < len+2, "not too many ranges");
 
@@ -350,14 +427,20 @@ void Parse::do_lookupswitch() {
     return;
   }
 
+  ciMultiBranchData* profile = switch_profile();
+  bool default_never_taken = (profile != NULL && profile->default_count() == 0);
+
   // generate decision tree, using trichotomy when possible
-  jint* table = NEW_RESOURCE_ARRAY(jint, len*2);
+  // (the profile counts cases in the order of the bytecode, so the
+  // original position of each pair is kept across the sort)
+  jint* table = NEW_RESOURCE_ARRAY(jint, len*3);
   {
     for( int j = 0; j < len; j++ ) {
-      table[j+j+0] = iter().get_int_table(2+j+j);
-      table[j+j+1] = iter().get_dest_table(2+j+j+1);
+      table[3*j+0] = iter().get_int_table(2+j+j);
+      table[3*j+1] = iter().get_dest_table(2+j+j+1);
+      table[3*j+2] = j;
     }
-    qsort( table, len, 2*sizeof(table[0]), jint_cmp );
+    qsort( table, len, 3*sizeof(table[0]), jint_cmp );
   }
 
   int rnum = len*2+1;
@@ -365,23 +448,24 @@ void Parse::do_lookupswitch() {
   SwitchRange* ranges = NEW_RESOURCE_ARRAY(SwitchRange, rnum);
   int rp = -1;
   for( int j = 0; j < len; j++ ) {
-    jint match_int   = table[j+j+0];
-    int  dest        = table[j+j+1];
+    jint match_int   = table[3*j+0];
+    int  dest        = table[3*j+1];
     int  next_lo     = rp < 0 ? min_jint : ranges[rp].hi()+1;
     int  table_index = method_data_update() ? j : NullTableIndex;
+    bool never_taken = (profile != NULL && profile->count_at(table[3*j+2]) == 0);
     makes_backward_branch |= (dest <= bci());
     if( match_int != next_lo ) {
-      ranges[++rp].setRange(next_lo, match_int-1, default_dest, NullTableIndex);
+      ranges[++rp].setRange(next_lo, match_int-1, default_dest, NullTableIndex, default_never_taken);
     }
-    if( rp < 0 || !ranges[rp].adjoin(match_int, dest, table_index) ) {
-      ranges[++rp].set(match_int, dest, table_index);
+    if( rp < 0 || !ranges[rp].adjoin(match_int, dest, table_index, never_taken) ) {
+      ranges[++rp].set(match_int, dest, table_index, never_taken);
     }
   }
-  jint highest = table[2*(len-1)];
+  jint highest = table[3*(len-1)];
   assert(ranges[rp].hi() == highest, "");
   if( highest != max_jint
-      && !ranges[rp].adjoinRange(highest+1, max_jint, default_dest, NullTableIndex) ) {
-    ranges[++rp].setRange(highest+1, max_jint, default_dest, NullTableIndex);
+      && !ranges[rp].adjoinRange(highest+1, max_jint, default_dest, NullTableIndex, default_never_taken) ) {
+    ranges[++rp].setRange(highest+1, max_jint, default_dest, NullTableIndex, default_never_taken);
   }
   assert(rp < rnum, "not too many ranges");
 
@@ -408,28 +492,30 @@ bool Parse::create_jump_tables(Node* key_val, SwitchRange* lo, SwitchRange* hi)
   // even though we can't be sure that it is the true "default".
 
   bool needs_guard = false;
-  int default_dest;
+  SwitchRange* default_range;
   int64 total_outlier_size = 0;
   int64 hi_size = ((int64)hi->hi()) - ((int64)hi->lo()) + 1;
   int64 lo_size = ((int64)lo->hi()) - ((int64)lo->lo()) + 1;
 
-  if (lo->dest() == hi->dest()) {
+  if (lo->same_target(hi)) {
     total_outlier_size = hi_size + lo_size;
-    default_dest = lo->dest();
+    default_range = lo;
   } else if (lo_size > hi_size) {
     total_outlier_size = lo_size;
-    default_dest = lo->dest();
+    default_range = lo;
   } else {
     total_outlier_size = hi_size;
-    default_dest = hi->dest();
+    default_range = hi;
   }
+  int  default_dest        = default_range->dest();
+  bool default_never_taken = default_range->never_taken();
 
   // If a guard test will eliminate very sparse end ranges, then
   // it is worth the cost of an extra jump.
   if (total_outlier_size > (MaxJumpTableSparseness * 4)) {
     needs_guard = true;
-    if (default_dest == lo->dest()) lo++;
-    if (default_dest == hi->dest()) hi--;
+    if (lo->same_target(default_range)) lo++;
+    if (hi->same_target(default_range)) hi--;
   }
 
   // Find the total number of cases and ranges
@@ -446,6 +532,11 @@ bool Parse::create_jump_tables(Node* key_val, SwitchRange* lo, SwitchRange* hi)
   int lowval = lo->lo();
   key_val = _gvn.transform( new (C) SubINode(key_val, _gvn.intcon(lowval)) );
 
+  // All never taken cases, and the guard if the default is never taken,
+  // share a single uncommon trap rather than one per table entry.
+  RegionNode* never_taken_region = new (C) RegionNode(1);
+  record_for_igvn(never_taken_region);
+
   // Generate a guard to protect against input keyvals that aren't
   // in the switch domain.
   if (needs_guard) {
@@ -453,7 +544,12 @@ bool Parse::create_jump_tables(Node* key_val, SwitchRange* lo, SwitchRange* hi)
     Node*   cmp = _gvn.transform( new (C) CmpUNode(key_val, size) );
     Node*   tst = _gvn.transform( new (C) BoolNode(cmp, BoolTest::ge) );
     IfNode* iff = create_and_map_if( control(), tst, PROB_FAIR, COUNT_UNKNOWN);
-    jump_if_true_fork(iff, default_dest, NullTableIndex);
+    if (default_never_taken) {
+      never_taken_region->add_req(_gvn.transform( new (C) IfTrueNode(iff) ));
+      set_control(_gvn.transform( new (C) IfFalseNode(iff) ));
+    } else {
+      jump_if_true_fork(iff, default_dest, NullTableIndex);
+    }
   }
 
   // Create an ideal node JumpTable that has projections
@@ -482,7 +578,9 @@ bool Parse::create_jump_tables(Node* key_val, SwitchRange* lo, SwitchRange* hi)
   for (SwitchRange* r = lo; r <= hi; r++) {
     for (int64 j = r->lo(); j <= r->hi(); j++, i++) {
       Node* input = _gvn.transform(new (C) JumpProjNode(jtn, i, r->dest(), (int)(j - lowval)));
-      {
+      if (r->never_taken()) {
+        never_taken_region->add_req(input);
+      } else {
         PreserveJVMState pjvms(this);
         set_control(input);
         jump_if_always_fork(r->dest(), r->table_index());
@@ -490,10 +588,32 @@ bool Parse::create_jump_tables(Node* key_val, SwitchRange* lo, SwitchRange* hi)
     }
   }
   assert(i == num_cases, "miscount of cases");
+  if (never_taken_region->req() > 1) {
+    // Nothing between the switch and its cases changes the map, so
+    // the cases can all use it.
+    set_control(_gvn.transform(never_taken_region));
+    switch_case_never_taken();
+  }
   stop_and_kill_map();  // no more uses for this JVMS
   return true;
 }
 
+//-------------------------merge_never_taken_ranges----------------------------
+// Adjacent never taken ranges all end in the same uncommon trap, whatever
+// their destination, so fold them into one to shrink the decision tree.
+// Returns the new upper end of the ranges.
+SwitchRange* Parse::merge_never_taken_ranges(SwitchRange* lo, SwitchRange* hi) {
+  SwitchRange* last = lo;
+  for (SwitchRange* r = lo+1; r <= hi; r++) {
+    if (r->never_taken() && last->never_taken()) {
+      last->setRange(last->lo(), r->hi(), last->dest(), last->table_index(), true);
+    } else {
+      *(++last) = *r;
+    }
+  }
+  return last;
+}
+
 //----------------------------jump_switch_ranges-------------------------------
 void Parse::jump_switch_ranges(Node* key_val, SwitchRange *lo, SwitchRange *hi, int switch_depth) {
   Block* switch_block = block();
@@ -532,9 +652,11 @@ void Parse::jump_switch_ranges(Node* key_val, SwitchRange *lo, SwitchRange *hi,
       assert(min_val <= max_val, "invalid int type");
     }
     while (lo->hi() < min_val)  lo++;
-    if (lo->lo() < min_val)  lo->setRange(min_val, lo->hi(), lo->dest(), lo->table_index());
+    if (lo->lo() < min_val)  lo->setRange(min_val, lo->hi(), lo->dest(), lo->table_index(), lo->never_taken());
     while (hi->lo() > max_val)  hi--;
-    if (hi->hi() > max_val)  hi->setRange(hi->lo(), max_val, hi->dest(), hi->table_index());
+    if (hi->hi() > max_val)  hi->setRange(hi->lo(), max_val, hi->dest(), hi->table_index(), hi->never_taken());
+
+    hi = merge_never_taken_ranges(lo, hi);
   }
 
 #ifndef PRODUCT
@@ -546,7 +668,7 @@ void Parse::jump_switch_ranges(Node* key_val, SwitchRange *lo, SwitchRange *hi,
 
   assert(lo <= hi, "must be a non-empty set of ranges");
   if (lo == hi) {
-    jump_if_always_fork(lo->dest(), lo->table_index());
+    jump_if_always_fork(lo->dest(), lo->table_index(), lo->never_taken());
   } else {
     assert(lo->hi() == (lo+1)->lo()-1, "contiguous ranges");
     assert(hi->lo() == (hi-1)->hi()+1, "contiguous ranges");
@@ -567,12 +689,12 @@ void Parse::jump_switch_ranges(Node* key_val, SwitchRange *lo, SwitchRange *hi,
 
     if (mid->is_singleton()) {
       IfNode *iff_ne = jump_if_fork_int(key_val, test_val, BoolTest::ne);
-      jump_if_false_fork(iff_ne, mid->dest(), mid->table_index());
+      jump_if_false_fork(iff_ne, mid->dest(), mid->table_index(), mid->never_taken());
 
       // Special Case:  If there are exactly three ranges, and the high
       // and low range each go to the same place, omit the "gt" test,
       // since it will not discriminate anything.
-      bool eq_test_only = (hi == lo+2 && hi->dest() == lo->dest());
+      bool eq_test_only = (hi == lo+2 && hi->same_target(lo));
       if (eq_test_only) {
         assert(mid == hi-1, "");
       }
@@ -597,7 +719,7 @@ void Parse::jump_switch_ranges(Node* key_val, SwitchRange *lo, SwitchRange *hi,
 
       // if there is a higher range, test for it and process it:
       if (mid == hi) {
-        jump_if_true_fork(iff_ge, mid->dest(), mid->table_index());
+        jump_if_true_fork(iff_ge, mid->dest(), mid->table_index(), mid->never_taken());
       } else {
         Node *iftrue  = _gvn.transform( new (C) IfTrueNode(iff_ge) );
         Node *iffalse = _gvn.transform( new (C) IfFalseNode(iff_ge) );
@@ -945,6 +1067,113 @@ bool Parse::seems_stable_comparison() const {
   return true;
 }
 
+// Partial escape analysis.  A fresh allocation which is live across a
+// rarely taken branch escapes as soon as that path passes it to a call
+// or stores it into the heap, and EA then keeps it on the heap for the
+// hot path as well.  An uncommon trap on the rare path keeps the
+// allocation non-escaping; if the path is ever taken, deoptimization
+// rematerializes the object for the interpreter.  Unlike a never taken
+// path, the rare path is measured against the method's invocation count
+// so that loop exits, which are rare per iteration, are not trapped.
+bool Parse::seems_rare_with_live_allocation(float prob, Block* path) const {
+  if (!PartialEscapeAnalysis || !EliminateAllocations || !C->do_escape_analysis()) {
+    return false;
+  }
+  ResourceMark rm;
+  ciMethodData* methodData = method()->method_data();
+  if (!methodData->is_mature())  return false;
+  ciProfileData* data = methodData->bci_to_data(bci());
+  if (data == NULL || !data->is_JumpData())  return false;
+  int taken = method()->scale_count(data->as_JumpData()->taken());
+  int not_taken = 0;
+  if (data->is_BranchData()) {
+    not_taken = method()->scale_count(data->as_BranchData()->not_taken());
+  }
+  int invocations = method()->interpreter_invocation_count();
+  // Same sanity limits as dynamic_branch_prediction().
+  if (taken < 0 || not_taken < 0 || taken + not_taken < 40 || invocations <= 0) {
+    return false;
+  }
+  float path_cnt = prob * (float)(taken + not_taken);
+  if (path_cnt >= PartialEscapeRareBranchRatio * (float)invocations) {
+    return false;
+  }
+  return path_uses_fresh_allocation(path);
+}
+
+// True if the object n allocated by alloc could still be scalar
+// replaced: it is small enough and so far only has its fields accessed.
+// Once it is stored into memory or passed to a call it escapes on the
+// hot path too, and trapping the rare path would not help.
+static bool is_scalar_replaceable_candidate(AllocateNode* alloc, Node* n, PhaseGVN* gvn) {
+  if (alloc->is_AllocateArray()) {
+    const TypeInt* len = gvn->type(alloc->in(AllocateNode::ALength))->isa_int();
+    if (len == NULL || !len->is_con() || len->get_con() > EliminateAllocationArraySizeLimit) {
+      return false;
+    }
+  }
+  Node* res = alloc->result_cast();
+  Unique_Node_List wq;
+  wq.push(res != NULL ? res : n);
+  for (uint next = 0; next < wq.size(); next++) {
+    Node* m = wq.at(next);
+    for (DUIterator_Fast imax, i = m->fast_outs(imax); i < imax; i++) {
+      Node* use = m->fast_out(i);
+      if (use->is_ConstraintCast() || use->is_CheckCastPP() ||
+          use->Opcode() == Op_EncodeP || use->is_Phi()) {
+        wq.push(use);
+      } else if (use->is_Store()) {
+        if (use->in(MemNode::ValueIn) == m) {
+          return false;
+        }
+      } else if (use->is_LoadStore()) {
+        if (use->in(MemNode::Address) != m) {
+          return false;
+        }
+      } else if (use->is_Call()) {
+        const TypeTuple* d = use->as_Call()->tf()->domain();
+        for (uint j = TypeFunc::Parms; j < d->cnt(); j++) {
+          if (use->in(j) == m) {
+            return false;
+          }
+        }
+      } else if (use->Opcode() == Op_Return) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// True if a local or expression stack slot of the current JVM state
+// that the successor block path reads holds an object allocated in this
+// compilation which could still be scalar replaced.  Locals the path
+// never reads do not need the object and are left to liveness.
+bool Parse::path_uses_fresh_allocation(Block* path) const {
+  SafePointNode* map = this->map();
+  JVMState* jvms = this->jvms();
+  MethodLivenessResult live_locals = method()->raw_liveness_at_bci(path->start());
+  uint end = jvms->stkoff() + jvms->sp();
+  for (uint i = jvms->locoff(); i < end; i++) {
+    if (i < jvms->stkoff()) {
+      // The bitmap can be zero length if we saw a breakpoint.
+      int local = i - jvms->locoff();
+      if (live_locals.size() > 0 && !live_locals.at(local)) {
+        continue;
+      }
+    }
+    Node* n = map->in(i);
+    if (n == NULL || !n->bottom_type()->isa_oopptr()) {
+      continue;
+    }
+    AllocateNode* alloc = AllocateNode::Ideal_allocation(n, &_gvn);
+    if (alloc != NULL && is_scalar_replaceable_candidate(alloc, n, &_gvn)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //-------------------------------repush_if_args--------------------------------
 // Push arguments of an "if" bytecode back onto the stack by adjusting _sp.
 inline int Parse::repush_if_args() {
@@ -1167,12 +1396,13 @@ void Parse::do_if(BoolTest::mask btest, Node* c) {
   }
 }
 
-bool Parse::path_is_suitable_for_uncommon_trap(float prob) const {
+bool Parse::path_is_suitable_for_uncommon_trap(float prob, Block* path) const {
   // Don't want to speculate on uncommon traps when running with -Xcomp
   if (!UseInterpreter) {
     return false;
   }
-  return (seems_never_taken(prob) && seems_stable_comparison());
+  return ((seems_never_taken(prob) || seems_rare_with_live_allocation(prob, path)) &&
+          seems_stable_comparison());
 }
 
 //----------------------------adjust_map_after_if------------------------------
@@ -1188,7 +1418,7 @@ void Parse::adjust_map_after_if(BoolTest::mask btest, Node* c, float prob,
 
   bool is_fallthrough = (path == successor_for_bci(iter().next_bci()));
 
-  if (path_is_suitable_for_uncommon_trap(prob)) {
+  if (path_is_suitable_for_uncommon_trap(prob, path)) {
     repush_if_args();
     uncommon_trap(Deoptimization::Reason_unstable_if,
                   Deoptimization::Action_reinterpret,
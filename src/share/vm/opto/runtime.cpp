@@ -835,6 +835,25 @@ const TypeFunc* OptoRuntime::array_fill_Type() {
   return TypeFunc::make(domain, range);
 }
 
+// for the double[] math stubs: src, dst, size_t length, returning void
+const TypeFunc* OptoRuntime::array_math_Type() {
+  // create input type (domain): pointer, pointer, size_t
+  const Type** fields = TypeTuple::fields(3 LP64_ONLY( + 1));
+  int argp = TypeFunc::Parms;
+  fields[argp++] = TypePtr::NOTNULL;      // src
+  fields[argp++] = TypePtr::NOTNULL;      // dst
+  fields[argp++] = TypeX_X;               // length in elements (size_t)
+  LP64_ONLY(fields[argp++] = Type::HALF); // other half of long length
+  const TypeTuple *domain = TypeTuple::make(argp, fields);
+
+  // create result type
+  fields = TypeTuple::fields(1);
+  fields[TypeFunc::Parms+0] = NULL; // void
+  const TypeTuple *range = TypeTuple::make(TypeFunc::Parms, fields);
+
+  return TypeFunc::make(domain, range);
+}
+
 // for aescrypt encrypt/decrypt operations, just three pointers returning void (length is constant)
 const TypeFunc* OptoRuntime::aescrypt_block_Type() {
   // create input type (domain)
@@ -863,6 +882,7 @@ const TypeFunc* OptoRuntime::aescrypt_block_Type() {
 
 /**
  * int updateBytesCRC32(int crc, byte* b, int len)
+ * Also the type of updateBytesCRC32C and updateBytesAdler32.
  */
 const TypeFunc* OptoRuntime::updateBytesCRC32_Type() {
   // create input type (domain)
@@ -894,6 +914,39 @@ const TypeFunc* OptoRuntime::updateBytesCRC32_Type() {
   return TypeFunc::make(domain, range);
 }
 
+/**
+ * int vectorizedMismatch(address a, address b, int length, int log2scale)
+ */
+const TypeFunc* OptoRuntime::vectorizedMismatch_Type() {
+  // create input type (domain)
+  int num_args = 4;
+  int argcnt = num_args;
+  if (CCallingConventionRequiresIntsAsLongs) {
+    argcnt += 2;
+  }
+  const Type** fields = TypeTuple::fields(argcnt);
+  int argp = TypeFunc::Parms;
+  fields[argp++] = TypePtr::NOTNULL;   // a
+  fields[argp++] = TypePtr::NOTNULL;   // b
+  if (CCallingConventionRequiresIntsAsLongs) {
+    fields[argp++] = TypeLong::LONG;   // length
+    fields[argp++] = Type::HALF;
+    fields[argp++] = TypeLong::LONG;   // log2scale
+    fields[argp++] = Type::HALF;
+  } else {
+    fields[argp++] = TypeInt::INT;     // length
+    fields[argp++] = TypeInt::INT;     // log2scale
+  }
+  assert(argp == TypeFunc::Parms+argcnt, "correct decoding");
+  const TypeTuple* domain = TypeTuple::make(TypeFunc::Parms+argcnt, fields);
+
+  // result type needed
+  fields = TypeTuple::fields(1);
+  fields[TypeFunc::Parms+0] = TypeInt::INT; // index of first mismatch or -1
+  const TypeTuple* range = TypeTuple::make(TypeFunc::Parms+1, fields);
+  return TypeFunc::make(domain, range);
+}
+
 // for cipherBlockChaining calls of aescrypt encrypt/decrypt, four pointers and a length, returning int
 const TypeFunc* OptoRuntime::cipherBlockChaining_aescrypt_Type() {
   // create input type (domain)
@@ -922,6 +975,31 @@ const TypeFunc* OptoRuntime::cipherBlockChaining_aescrypt_Type() {
   return TypeFunc::make(domain, range);
 }
 
+// for counterMode calls of aescrypt encrypt/decrypt, four pointers, a length,
+// the saved encryptedCounter and the address of the used field, returning int
+const TypeFunc* OptoRuntime::counterMode_aescrypt_Type() {
+  // create input type (domain)
+  int num_args = 7;
+  int argcnt = num_args;
+  const Type** fields = TypeTuple::fields(argcnt);
+  int argp = TypeFunc::Parms;
+  fields[argp++] = TypePtr::NOTNULL;    // src
+  fields[argp++] = TypePtr::NOTNULL;    // dest
+  fields[argp++] = TypePtr::NOTNULL;    // k array
+  fields[argp++] = TypePtr::NOTNULL;    // counter array
+  fields[argp++] = TypeInt::INT;        // src len
+  fields[argp++] = TypePtr::NOTNULL;    // saved_encCounter
+  fields[argp++] = TypePtr::NOTNULL;    // saved used addr
+  assert(argp == TypeFunc::Parms+argcnt, "correct decoding");
+  const TypeTuple* domain = TypeTuple::make(TypeFunc::Parms+argcnt, fields);
+
+  // returning cipher len (int)
+  fields = TypeTuple::fields(1);
+  fields[TypeFunc::Parms+0] = TypeInt::INT;
+  const TypeTuple* range = TypeTuple::make(TypeFunc::Parms+1, fields);
+  return TypeFunc::make(domain, range);
+}
+
 /*
  * void implCompress(byte[] buf, int ofs)
  */
@@ -1547,28 +1625,35 @@ void OptoRuntime::print_named_counters() {
 
 //
 //  Allocate a new NamedCounter.  The JVMState is used to generate the
-//  name which consists of method@line for the inlining tree.
+//  name which consists of method@bci for the inlining tree.  The method
+//  includes its signature, so that the RTM counters of overloaded
+//  methods are not summed together for a lock site.
 //
 
-NamedCounter* OptoRuntime::new_named_counter(JVMState* youngest_jvms, NamedCounter::CounterTag tag) {
+static void print_named_counter_name(JVMState* youngest_jvms, outputStream* st) {
   int max_depth = youngest_jvms->depth();
 
   // Visit scopes from youngest to oldest.
   bool first = true;
-  stringStream st;
   for (int depth = max_depth; depth >= 1; depth--) {
     JVMState* jvms = youngest_jvms->of_depth(depth);
     ciMethod* m = jvms->has_method() ? jvms->method() : NULL;
     if (!first) {
-      st.print(" ");
+      st->print(" ");
     } else {
       first = false;
     }
     int bci = jvms->bci();
     if (bci < 0) bci = 0;
-    st.print("%s.%s@%d", m->holder()->name()->as_utf8(), m->name()->as_utf8(), bci);
+    st->print("%s.%s%s@%d", m->holder()->name()->as_utf8(), m->name()->as_utf8(),
+              m->signature()->as_symbol()->as_utf8(), bci);
     // To print linenumbers instead of bci use: m->line_number_from_bci(bci)
   }
+}
+
+NamedCounter* OptoRuntime::new_named_counter(JVMState* youngest_jvms, NamedCounter::CounterTag tag) {
+  stringStream st;
+  print_named_counter_name(youngest_jvms, &st);
   NamedCounter* c;
   if (tag == NamedCounter::BiasedLockingCounter) {
     c = new BiasedLockingNamedCounter(strdup(st.as_string()));
@@ -1589,6 +1674,22 @@ NamedCounter* OptoRuntime::new_named_counter(JVMState* youngest_jvms, NamedCount
   return c;
 }
 
+bool OptoRuntime::sum_rtm_named_counters(JVMState* youngest_jvms, RTMLockingCounters* sum) {
+  bool found = false;
+#if INCLUDE_RTM_OPT
+  stringStream st;
+  print_named_counter_name(youngest_jvms, &st);
+  const char* name = st.as_string();
+  for (NamedCounter* c = _named_counters; c != NULL; c = c->next()) {
+    if (c->tag() == NamedCounter::RTMLockingCounter && strcmp(c->name(), name) == 0) {
+      sum->add(((RTMLockingNamedCounter*)c)->counters());
+      found = true;
+    }
+  }
+#endif
+  return found;
+}
+
 //-----------------------------------------------------------------------------
 // Non-product code
 #ifndef PRODUCT
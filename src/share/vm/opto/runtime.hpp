@@ -296,9 +296,11 @@ private:
   static const TypeFunc* slow_arraycopy_Type();   // the full routine
 
   static const TypeFunc* array_fill_Type();
+  static const TypeFunc* array_math_Type();
 
   static const TypeFunc* aescrypt_block_Type();
   static const TypeFunc* cipherBlockChaining_aescrypt_Type();
+  static const TypeFunc* counterMode_aescrypt_Type();
 
   static const TypeFunc* sha_implCompress_Type();
   static const TypeFunc* digestBase_implCompressMB_Type();
@@ -315,6 +317,8 @@ private:
 
   static const TypeFunc* updateBytesCRC32_Type();
 
+  static const TypeFunc* vectorizedMismatch_Type();
+
   // leaf on stack replacement interpreter accessor types
   static const TypeFunc* osr_end_Type();
 
@@ -347,6 +351,10 @@ private:
  // if they are available
  static NamedCounter* new_named_counter(JVMState* jvms, NamedCounter::CounterTag tag);
 
+ // sums the RTM locking counters which earlier compilations created
+ // for the same lock site; returns false if there are none
+ static bool          sum_rtm_named_counters(JVMState* jvms, RTMLockingCounters* sum);
+
  // dumps all the named counters
  static void          print_named_counters();
 
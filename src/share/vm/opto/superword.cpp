@@ -76,7 +76,8 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
 
   if (!cl->is_valid_counted_loop()) return; // skip malformed counted loop
 
-  if (!cl->is_main_loop() ) return; // skip normal, pre, and post loops
+  // skip normal, pre, and post loops other than vector drain loops
+  if (!cl->is_main_loop() && !cl->is_vector_drain_loop()) return;
 
   // Check for no control flow in body (other than exit)
   Node *cl_exit = cl->loopexit();
@@ -87,11 +88,13 @@ void SuperWord::transform_loop(IdealLoopTree* lpt) {
     return;
   }
 
-  // Check for pre-loop ending with CountedLoopEnd(Bool(Cmp(x,Opaque1(limit))))
-  CountedLoopEndNode* pre_end = get_pre_loop_end(cl);
-  if (pre_end == NULL) return;
-  Node *pre_opaq1 = pre_end->limit();
-  if (pre_opaq1->Opcode() != Op_Opaque1) return;
+  if (cl->is_main_loop()) {
+    // Check for pre-loop ending with CountedLoopEnd(Bool(Cmp(x,Opaque1(limit))))
+    CountedLoopEndNode* pre_end = get_pre_loop_end(cl);
+    if (pre_end == NULL) return;
+    Node *pre_opaq1 = pre_end->limit();
+    if (pre_opaq1->Opcode() != Op_Opaque1) return;
+  }
 
   init(); // initialize data structures
 
@@ -447,6 +450,9 @@ bool SuperWord::ref_is_alignable(SWPointer& p) {
   if (!p.has_iv()) {
     return true;   // no induction variable
   }
+  if (!aligns_with_pre_loop()) {
+    return true;   // relies on misaligned vector accesses
+  }
   CountedLoopEndNode* pre_end = get_pre_loop_end(lp()->as_CountedLoop());
   assert(pre_end != NULL, "we must have a correct pre-loop");
   assert(pre_end->stride_is_con(), "pre loop stride is constant");
@@ -680,7 +686,7 @@ bool SuperWord::stmts_can_pack(Node* s1, Node* s2, int align) {
   }
 
   if (isomorphic(s1, s2)) {
-    if (independent(s1, s2)) {
+    if (independent(s1, s2) || reduction(s1, s2)) {
       if (!exists_at(s1, 0) && !exists_at(s2, 1)) {
         if (!s1->is_Mem() || are_adjacent_refs(s1, s2)) {
           int s1_align = alignment(s1);
@@ -758,6 +764,20 @@ bool SuperWord::independent(Node* s1, Node* s2) {
   return independent_path(shallow, deep);
 }
 
+//------------------------------reduction---------------------------
+// Is s2 the next link after s1 in a reduction chain?
+bool SuperWord::reduction(Node* s1, Node* s2) {
+  if (!s1->is_reduction() || !s2->is_reduction()) return false;
+  if (depth(s1) + 1 != depth(s2)) return false;
+  // The chain is ordered: s1 must feed s2 directly.
+  for (DUIterator_Fast imax, i = s1->fast_outs(imax); i < imax; i++) {
+    if (s1->fast_out(i) == s2) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //------------------------------independent_path------------------------------
 // Helper for independent
 bool SuperWord::independent_path(Node* shallow, Node* deep, uint dp) {
@@ -899,6 +919,20 @@ bool SuperWord::follow_def_uses(Node_List* p) {
 //---------------------------opnd_positions_match-------------------------
 // Is the use of d1 in u1 at the same operand position as d2 in u2?
 bool SuperWord::opnd_positions_match(Node* d1, Node* u1, Node* d2, Node* u2) {
+  if (u1->is_reduction() && u2->is_reduction()) {
+    // Keep the loop carried value (the phi or the previous link of the
+    // chain) in the first operand of every reduction.
+    Node* first = u1->in(2);
+    if (first->is_Phi() || first->is_reduction()) {
+      u1->swap_edges(1, 2);
+    }
+    first = u2->in(2);
+    if (first->is_Phi() || first->is_reduction()) {
+      u2->swap_edges(1, 2);
+    }
+    return true;
+  }
+
   uint ct = u1->req();
   if (ct != u2->req()) return false;
   uint i1 = 0;
@@ -1108,6 +1142,14 @@ void SuperWord::filter_packs() {
 // Can code be generated for pack p?
 bool SuperWord::implemented(Node_List* p) {
   Node* p0 = p->at(0);
+  if (p0->is_reduction()) {
+    BasicType bt = p0->bottom_type()->basic_type();
+    // Length 2 reductions of int/long do not pay for the shuffles.
+    if ((bt == T_INT || bt == T_LONG) && p->size() == 2) {
+      return false;
+    }
+    return ReductionNode::implemented(p0->Opcode(), p->size(), bt);
+  }
   return VectorNode::implemented(p0->Opcode(), p->size(), velt_basic_type(p0));
 }
 
@@ -1142,6 +1184,30 @@ bool SuperWord::profitable(Node_List* p) {
     if (!is_vector_use(p0, i))
       return false;
   }
+  if (p0->is_reduction()) {
+    // The folded operand must be a vector of the same length and each
+    // element must extend the chain started by the previous one.
+    Node_List* second_pk = my_pack(p0->in(2));
+    if (second_pk == NULL || second_pk->size() != p->size())
+      return false;
+    // The scalar accumulator is the loop phi or, when the unrolled chain
+    // is longer than a vector, the result of the previous pack of the
+    // chain, whose last link is replaced by a reduction node too.
+    Node_List* first_pk = my_pack(p0->in(1));
+    if (first_pk != NULL &&
+        (!first_pk->at(0)->is_reduction() ||
+         first_pk->at(first_pk->size()-1) != p0->in(1)))
+      return false;
+    for (uint i = 0; i < p->size(); i++) {
+      if (p->at(i)->in(2) != second_pk->at(i))
+        return false;
+      if (i > 0 && p->at(i)->in(1) != p->at(i-1))
+        return false;
+    }
+    // Uses are the next link, the loop phi or out of the loop: all of
+    // them consume the scalar produced by the reduction node.
+    return true;
+  }
   if (VectorNode::is_shift(p0)) {
     // For now, return false if shift count is vector or not scalar promotion
     // case (different shift counts) because it is not supported yet.
@@ -1396,7 +1462,9 @@ void SuperWord::output() {
   // MUST ENSURE main loop's initial value is properly aligned:
   //  (iv_initial_value + min_iv_offset) % vector_width_in_bytes() == 0
 
-  align_initial_loop_index(align_to_ref());
+  if (aligns_with_pre_loop()) {
+    align_initial_loop_index(align_to_ref());
+  }
 
   // Insert extract (unpack) operations for scalar uses
   for (int i = 0; i < _packset.length(); i++) {
@@ -1445,6 +1513,17 @@ void SuperWord::output() {
         const TypePtr* atyp = n->adr_type();
         vn = StoreVectorNode::make(C, opc, ctl, mem, adr, atyp, val, vlen);
         vlen_in_bytes = vn->as_StoreVector()->memory_size();
+      } else if (n->is_reduction()) {
+        // The scalar accumulator of the first link is kept and the
+        // vector operand is folded into it.
+        Node* in1 = low_adr->in(1);
+        Node* in2 = vector_opd(p, 2);
+        vn = ReductionNode::make(C, opc, NULL, in1, in2, n->bottom_type()->basic_type());
+        if (in2->is_LoadVector()) {
+          vlen_in_bytes = in2->as_LoadVector()->memory_size();
+        } else {
+          vlen_in_bytes = in2->as_Vector()->length_in_bytes();
+        }
       } else if (n->req() == 3) {
         // Promote operands to vector
         Node* in1 = vector_opd(p, 1);
@@ -1570,6 +1649,8 @@ Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
 // use with an extract operation.
 void SuperWord::insert_extracts(Node_List* p) {
   if (p->at(0)->is_Store()) return;
+  // A reduction already produces the scalar its uses expect.
+  if (p->at(0)->is_reduction()) return;
   assert(_n_idx_list.is_empty(), "empty (node,index) list");
 
   // Inspect each use of each pack member.  For each use that is
@@ -1616,6 +1697,7 @@ void SuperWord::insert_extracts(Node_List* p) {
 bool SuperWord::is_vector_use(Node* use, int u_idx) {
   Node_List* u_pk = my_pack(use);
   if (u_pk == NULL) return false;
+  if (use->is_reduction()) return true;
   Node* def = use->in(u_idx);
   Node_List* d_pk = my_pack(def);
   if (d_pk == NULL) {
@@ -2206,6 +2288,15 @@ void SuperWord::align_initial_loop_index(MemNode* align_to_ref) {
   pre_opaq->set_req(1, constrained);
 }
 
+//----------------------------aligns_with_pre_loop---------------------------
+// Vector drain loops have no pre-loop, and with VectorizedPostLoops main
+// loops leave theirs at a single iteration when misaligned vectors are ok.
+bool SuperWord::aligns_with_pre_loop() {
+  CountedLoopNode* cl = lp()->as_CountedLoop();
+  if (cl->is_vector_drain_loop()) return false;
+  return !(VectorizedPostLoops && Matcher::misaligned_vectors_ok());
+}
+
 //----------------------------get_pre_loop_end---------------------------
 // Find pre loop end from main loop.  Returns null if none.
 CountedLoopEndNode* SuperWord::get_pre_loop_end(CountedLoopNode* cl) {
@@ -363,6 +363,8 @@ class SuperWord : public ResourceObj {
   bool isomorphic(Node* s1, Node* s2);
   // Is there no data path from s1 to s2 or s2 to s1?
   bool independent(Node* s1, Node* s2);
+  // Is s2 the next link after s1 in a reduction chain?
+  bool reduction(Node* s1, Node* s2);
   // Helper for independent
   bool independent_path(Node* shallow, Node* deep, uint dp=0);
   void set_alignment(Node* s1, Node* s2, int align);
@@ -434,6 +436,8 @@ class SuperWord : public ResourceObj {
   // Adjust pre-loop limit so that in main loop, a load/store reference
   // to align_to_ref will be a position zero in the vector.
   void align_initial_loop_index(MemNode* align_to_ref);
+  // Does the pre-loop align the vector accesses of this loop?
+  bool aligns_with_pre_loop();
   // Find pre loop end from main loop.  Returns null if none.
   CountedLoopEndNode* get_pre_loop_end(CountedLoopNode *cl);
   // Is the use of d1 in u1 at the same operand position as d2 in u2?
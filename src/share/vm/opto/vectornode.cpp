@@ -442,3 +442,69 @@ Node* ExtractNode::make(Compile* C, Node* v, uint position, BasicType bt) {
   return NULL;
 }
 
+
+// Return the reduction opcode for the loop carried scalar operation opc.
+int ReductionNode::opcode(int opc, BasicType bt) {
+  switch (opc) {
+  case Op_AddI:
+    assert(bt == T_INT, "must be");
+    return Op_AddReductionVI;
+  case Op_AddL:
+    assert(bt == T_LONG, "must be");
+    return Op_AddReductionVL;
+  case Op_AddF:
+    assert(bt == T_FLOAT, "must be");
+    return Op_AddReductionVF;
+  case Op_AddD:
+    assert(bt == T_DOUBLE, "must be");
+    return Op_AddReductionVD;
+  case Op_MulI:
+    assert(bt == T_INT, "must be");
+    return Op_MulReductionVI;
+  case Op_MulF:
+    assert(bt == T_FLOAT, "must be");
+    return Op_MulReductionVF;
+  case Op_MulD:
+    assert(bt == T_DOUBLE, "must be");
+    return Op_MulReductionVD;
+  case Op_MinI:
+    assert(bt == T_INT, "must be");
+    return Op_MinReductionVI;
+  case Op_MaxI:
+    assert(bt == T_INT, "must be");
+    return Op_MaxReductionVI;
+  }
+  return 0; // Unimplemented
+}
+
+// Return the reduction node folding vector in2 into scalar in1.
+ReductionNode* ReductionNode::make(Compile* C, int opc, Node *ctrl, Node* in1, Node* in2, BasicType bt) {
+  int vopc = ReductionNode::opcode(opc, bt);
+  // This method should not be called for unimplemented reductions.
+  guarantee(vopc > 0, err_msg_res("Reduction for '%s' is not implemented", NodeClassNames[opc]));
+
+  switch (vopc) {
+  case Op_AddReductionVI: return new (C) AddReductionVINode(ctrl, in1, in2);
+  case Op_AddReductionVL: return new (C) AddReductionVLNode(ctrl, in1, in2);
+  case Op_AddReductionVF: return new (C) AddReductionVFNode(ctrl, in1, in2);
+  case Op_AddReductionVD: return new (C) AddReductionVDNode(ctrl, in1, in2);
+  case Op_MulReductionVI: return new (C) MulReductionVINode(ctrl, in1, in2);
+  case Op_MulReductionVF: return new (C) MulReductionVFNode(ctrl, in1, in2);
+  case Op_MulReductionVD: return new (C) MulReductionVDNode(ctrl, in1, in2);
+  case Op_MinReductionVI: return new (C) MinReductionVINode(ctrl, in1, in2);
+  case Op_MaxReductionVI: return new (C) MaxReductionVINode(ctrl, in1, in2);
+  }
+  fatal(err_msg_res("Missed reduction creation for '%s'", NodeClassNames[vopc]));
+  return NULL;
+}
+
+// Also used to check if the code generator supports the reduction.
+bool ReductionNode::implemented(int opc, uint vlen, BasicType bt) {
+  if (is_java_primitive(bt) &&
+      (vlen > 1) && is_power_of_2(vlen) &&
+      Matcher::vector_size_supported(bt, vlen)) {
+    int vopc = ReductionNode::opcode(opc, bt);
+    return vopc > 0 && Matcher::match_rule_supported(vopc);
+  }
+  return false;
+}
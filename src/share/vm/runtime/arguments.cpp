@@ -1706,6 +1706,13 @@ void Arguments::set_g1_gc_flags() {
   if (G1ConcRefinementThreads == 0) {
     FLAG_SET_DEFAULT(G1ConcRefinementThreads, ParallelGCThreads);
   }
+
+  // An explicitly set InitiatingHeapOccupancyPercent keeps its meaning as
+  // a fixed threshold unless adaptive IHOP is requested as well.
+  if (FLAG_IS_DEFAULT(G1UseAdaptiveIHOP) &&
+      !FLAG_IS_DEFAULT(InitiatingHeapOccupancyPercent)) {
+    FLAG_SET_ERGO(bool, G1UseAdaptiveIHOP, false);
+  }
 #endif
 
   // MarkStackSize will be set (if it hasn't been set by the user)
@@ -2548,6 +2555,7 @@ bool Arguments::check_vm_args_consistency() {
   status = status && verify_interval(MarkStackSizeMax,
                                   1, (max_jint - 1), "MarkStackSizeMax");
   status = status && verify_interval(NUMAChunkResizeWeight, 0, 100, "NUMAChunkResizeWeight");
+  status = status && verify_interval(Tier3ProfileUpdateFreqLog, 0, 14, "Tier3ProfileUpdateFreqLog");
 
   status = status && verify_min_value(LogEventsBufferEntries, 1, "LogEventsBufferEntries");
 
@@ -2586,6 +2594,10 @@ bool Arguments::check_vm_args_consistency() {
 #ifdef COMPILER1
   status = status && verify_min_value(ValueMapInitialSize, 1, "ValueMapInitialSize");
 #endif
+#ifdef COMPILER2
+  // ciCallProfile keeps at most 8 receivers
+  status = status && verify_interval(PolymorphicInliningLimit, 2, 8, "PolymorphicInliningLimit");
+#endif
 
   if (PrintNMTStatistics) {
 #if INCLUDE_NMT
@@ -2646,6 +2658,8 @@ bool Arguments::check_vm_args_consistency() {
 
   status &= verify_interval(NmethodSweepFraction, 1, ReservedCodeCacheSize/K, "NmethodSweepFraction");
   status &= verify_interval(NmethodSweepActivity, 0, 2000, "NmethodSweepActivity");
+  status &= verify_min_value(NmethodSweepParallelism, 1, "NmethodSweepParallelism");
+  status &= verify_interval(CodeCacheCompactionThreshold, 1, 100, "CodeCacheCompactionThreshold");
 
   if (!FLAG_IS_DEFAULT(CICompilerCount) && !FLAG_IS_DEFAULT(CICompilerCountPerCPU) && CICompilerCountPerCPU) {
     warning("The VM option CICompilerCountPerCPU overrides CICompilerCount.");
@@ -4198,6 +4212,10 @@ jint Arguments::apply_ergo() {
     // nothing to use the profiling, turn if off
     FLAG_SET_DEFAULT(TypeProfileLevel, 0);
   }
+  if (UsePolymorphicInlining && FLAG_IS_DEFAULT(TypeProfileWidth)) {
+    // polymorphic inlining: record as many receivers as we may check
+    FLAG_SET_DEFAULT(TypeProfileWidth, MAX2(TypeProfileWidth, MIN2(PolymorphicInliningLimit, (intx)8)));
+  }
 #endif
 
   if (PrintAssembly && FLAG_IS_DEFAULT(DebugNonSafepoints)) {
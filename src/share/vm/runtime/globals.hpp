@@ -730,6 +730,9 @@ class CommandLineFlags {
   product(bool, UseAESIntrinsics, false,                                    \
           "Use intrinsics for AES versions of crypto")                      \
                                                                             \
+  product(bool, UseAESCTRIntrinsics, false,                                 \
+          "Use intrinsics for the AES version of counter mode encryption")  \
+                                                                            \
   product(bool, UseSHA1Intrinsics, false,                                   \
           "Use intrinsics for SHA-1 crypto hash function")                  \
                                                                             \
@@ -742,6 +745,19 @@ class CommandLineFlags {
   product(bool, UseCRC32Intrinsics, false,                                  \
           "use intrinsics for java.util.zip.CRC32")                         \
                                                                             \
+  product(bool, UseCRC32CIntrinsics, false,                                 \
+          "use intrinsics for java.util.zip.CRC32C")                        \
+                                                                            \
+  product(bool, UseAdler32Intrinsics, false,                                \
+          "use intrinsics for java.util.zip.Adler32")                       \
+                                                                            \
+  product(bool, UseVectorizedMismatchIntrinsic, false,                      \
+          "Use a vectorized stub for Arrays.equals on primitive arrays")    \
+                                                                            \
+  product(bool, UseLibmIntrinsic, false,                                    \
+          "Use SSE2 stubs for Math.exp, Math.log and Math.log10 in the "    \
+          "interpreter and both compilers")                                 \
+                                                                            \
   develop(bool, TraceCallFixup, false,                                      \
           "Trace all call fixups")                                          \
                                                                             \
@@ -2614,6 +2630,15 @@ class CommandLineFlags {
           "Print the break down of clean up tasks performed during "        \
           "safepoint")                                                      \
                                                                             \
+  product(bool, ParallelSafepointCleanup, false,                            \
+          "Run the independent safepoint cleanup tasks in parallel on the " \
+          "GC worker threads, if the heap has a work gang")                 \
+                                                                            \
+  product(uintx, SafepointTraceBufferSize, 0,                               \
+          "Number of recent safepoints for which the phase times and the "  \
+          "last thread to reach the safepoint are kept for jcmd "           \
+          "VM.safepoints. 0 disables it")                                   \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -3033,6 +3058,19 @@ class CommandLineFlags {
           "Removes cold nmethods from code cache if > 0. Higher values "    \
           "result in more aggressive sweeping")                             \
                                                                             \
+  product(intx, NmethodSweepParallelism, 1,                                 \
+          "Maximum number of compiler threads that sweep the code cache "   \
+          "at the same time")                                               \
+                                                                            \
+  experimental(bool, CodeCacheCompaction, false,                            \
+          "Move live nmethods into free blocks lower in the code cache "    \
+          "at a safepoint after a sweep if the code cache is fragmented")   \
+                                                                            \
+  experimental(uintx, CodeCacheCompactionThreshold, 5,                      \
+          "Compact the code cache once the free blocks that are smaller "   \
+          "than the largest one add up to this percentage of "              \
+          "ReservedCodeCacheSize")                                          \
+                                                                            \
   notproduct(bool, LogSweeper, false,                                       \
           "Keep a ring buffer of sweeper activity")                         \
                                                                             \
@@ -3238,6 +3276,12 @@ class CommandLineFlags {
   product(uintx, TLABWasteIncrement,    4,                                  \
           "Increment allowed waste at slow allocation")                     \
                                                                             \
+  product(bool, TLABElasticSizing, false,                                   \
+          "Size each thread's TLAB from its own allocation rate between "   \
+          "GCs instead of its fraction of eden, and grow it between GCs "   \
+          "when the thread refills more often than expected. Requires "     \
+          "ResizeTLAB")                                                     \
+                                                                            \
   product(uintx, SurvivorRatio, 8,                                          \
           "Ratio of eden/survivor space size")                              \
                                                                             \
@@ -3640,6 +3684,11 @@ class CommandLineFlags {
           "C1 with MDO profiling (tier 3) invocation notification "         \
           "frequency")                                                      \
                                                                             \
+  product(intx, Tier3ProfileUpdateFreqLog, 0,                               \
+          "C1 with MDO profiling (tier 3) updates branch, call and type "   \
+          "check profiles on average once every 2^n executions, weighted "  \
+          "by 2^n. 0 updates them on every execution (x86_64 only)")        \
+                                                                            \
   product(intx, Tier2CompileThreshold, 0,                                   \
           "threshold at which tier 2 compilation is invoked")               \
                                                                             \
@@ -3909,6 +3958,10 @@ class CommandLineFlags {
   diagnostic(bool, FoldStableValues, true,                                  \
           "Optimize loads from stable fields (marked w/ @Stable)")          \
                                                                             \
+  product(bool, ShareLambdaCallSites, true,                                 \
+          "Link invokedynamic instructions of a class that name the same "  \
+          "LambdaMetafactory call site constant to one call site")          \
+                                                                            \
   develop(bool, TraceInvokeDynamic, false,                                  \
           "trace internal invoke dynamic operations")                       \
                                                                             \
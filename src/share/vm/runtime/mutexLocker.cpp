@@ -66,6 +66,7 @@ Mutex*   RetData_lock                 = NULL;
 Monitor* VMOperationQueue_lock        = NULL;
 Monitor* VMOperationRequest_lock      = NULL;
 Monitor* Safepoint_lock               = NULL;
+Mutex*   SafepointTrace_lock          = NULL;
 Monitor* SerializePage_lock           = NULL;
 Monitor* Threads_lock                 = NULL;
 Monitor* CGC_lock                     = NULL;
@@ -246,6 +247,7 @@ void mutex_init() {
   // CMS_freeList_lock                        leaf + 2
 
   def(Safepoint_lock               , Monitor, safepoint,   true ); // locks SnippetCache_lock/Threads_lock
+  def(SafepointTrace_lock          , Mutex,   special,     true ); // protects the SafepointTracer records
 
   def(Threads_lock                 , Monitor, barrier,     true );
 
@@ -106,6 +106,15 @@ class RTMLockingCounters VALUE_OBJ_CLASS_SPEC {
 
   bool nonzero() {  return (_abort_count + _total_count) > 0; }
 
+  // Accumulate the counts of another lock site's counters.
+  void add(RTMLockingCounters* c) {
+    _total_count += c->_total_count;
+    _abort_count += c->_abort_count;
+  }
+
+  // Same test as the abort ratio calculation in the generated RTM code.
+  bool abort_ratio_too_high() const;
+
   void print_on(outputStream* st);
   void print() { print_on(tty); }
 };
@@ -45,6 +45,7 @@
 #include "runtime/orderAccess.inline.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
+#include "runtime/safepointTracer.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -54,6 +55,7 @@
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/workgroup.hpp"
 #ifdef TARGET_ARCH_x86
 # include "nativeInst_x86.hpp"
 # include "vmreg_x86.inline.hpp"
@@ -200,6 +202,8 @@ void SafepointSynchronize::begin() {
     tty->print_cr("Safepoint synchronization initiated. (%d)", nof_threads);
   }
 
+  SafepointTracer::begin(nof_threads);
+
   RuntimeService::record_safepoint_begin();
 
   MutexLocker mu(Safepoint_lock);
@@ -299,6 +303,7 @@ void SafepointSynchronize::begin() {
   // Iterate through all threads until it have been determined how to stop them all at a safepoint
   unsigned int iterations = 0;
   int steps = 0 ;
+  JavaThread* last_running = NULL;
   while(still_running > 0) {
     for (JavaThread *cur = Threads::first(); cur != NULL; cur = cur->next()) {
       assert(!cur->is_ConcurrentGC_thread(), "A concurrent GC thread is unexpectly being suspended");
@@ -307,6 +312,9 @@ void SafepointSynchronize::begin() {
         cur_state->examine_state_of_thread();
         if (!cur_state->is_running()) {
            still_running--;
+           if (iterations > 0) {
+             last_running = cur;
+           }
            // consider adjusting steps downward:
            //   steps = 0
            //   steps -= NNN
@@ -414,6 +422,10 @@ void SafepointSynchronize::begin() {
     update_statistics_on_spin_end();
   }
 
+  if (SafepointTracer::is_active()) {
+    SafepointTracer::spin_done(initial_running, _waiting_to_block, last_running);
+  }
+
   if (sync_event.should_commit()) {
     post_safepoint_synchronize_event(&sync_event, initial_running, _waiting_to_block, iterations);
   }
@@ -484,6 +496,9 @@ void SafepointSynchronize::begin() {
   if (PrintSafepointStatistics) {
     update_statistics_on_sync_end(os::javaTimeNanos());
   }
+  if (SafepointTracer::is_active()) {
+    SafepointTracer::synchronized();
+  }
 
   // Call stuff that needs to be run when a safepoint is just about to be completed
   {
@@ -498,6 +513,9 @@ void SafepointSynchronize::begin() {
     // Record how much time spend on the above cleanup tasks
     update_statistics_on_cleanup_end(os::javaTimeNanos());
   }
+  if (SafepointTracer::is_active()) {
+    SafepointTracer::cleanup_done();
+  }
 
   if (begin_event.should_commit()) {
     post_safepoint_begin_event(&begin_event, nof_threads, _current_jni_active_count);
@@ -521,6 +539,9 @@ void SafepointSynchronize::end() {
   if (PrintSafepointStatistics) {
     end_statistics(os::javaTimeNanos());
   }
+  if (SafepointTracer::is_active()) {
+    SafepointTracer::end();
+  }
 
 #ifdef ASSERT
   // A pending_exception cannot be installed during a safepoint.  The threads
@@ -609,64 +630,108 @@ bool SafepointSynchronize::is_cleanup_needed() {
 
 
 
-// Various cleaning tasks that should be done periodically at safepoints
-void SafepointSynchronize::do_cleanup_tasks() {
-  {
-    const char* name = "deflating idle monitors";
-    EventSafepointCleanupTask event;
-    TraceTime t1(name, TraceSafepointCleanupTime);
-    ObjectSynchronizer::deflate_idle_monitors();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
-    }
+static const char* cleanup_task_name(SafepointSynchronize::SafepointCleanupTask task) {
+  switch (task) {
+    case SafepointSynchronize::_cleanup_deflate_idle_monitors: return "deflating idle monitors";
+    case SafepointSynchronize::_cleanup_update_inline_caches:  return "updating inline caches";
+    case SafepointSynchronize::_cleanup_compilation_policy:    return "compilation policy safepoint handler";
+    case SafepointSynchronize::_cleanup_mark_nmethods:         return "mark nmethods";
+    case SafepointSynchronize::_cleanup_symbol_table_rehash:   return "rehashing symbol table";
+    case SafepointSynchronize::_cleanup_string_table_rehash:   return "rehashing string table";
+    default: ShouldNotReachHere(); return NULL;
   }
+}
 
-  {
-    const char* name = "updating inline caches";
-    EventSafepointCleanupTask event;
-    TraceTime t2(name, TraceSafepointCleanupTime);
-    InlineCacheBuffer::update_inline_caches();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
-    }
+// Runs one cleanup task. Called by the VM thread or, with
+// ParallelSafepointCleanup, by whichever GC worker claimed the task.
+void SafepointSynchronize::do_cleanup_task(SafepointCleanupTask task) {
+  switch (task) {
+    case _cleanup_symbol_table_rehash:
+      if (!SymbolTable::needs_rehashing()) return;
+      break;
+    case _cleanup_string_table_rehash:
+      if (!StringTable::needs_rehashing()) return;
+      break;
+    default:
+      break;
   }
-  {
-    const char* name = "compilation policy safepoint handler";
-    EventSafepointCleanupTask event;
-    TraceTime t3(name, TraceSafepointCleanupTime);
-    CompilationPolicy::policy()->do_safepoint_work();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
-    }
+
+  const char* name = cleanup_task_name(task);
+  EventSafepointCleanupTask event;
+  TraceTime t(name, TraceSafepointCleanupTime);
+  jlong start_time = PrintSafepointStatistics ? os::javaTimeNanos() : 0;
+
+  switch (task) {
+    case _cleanup_deflate_idle_monitors:
+      ObjectSynchronizer::deflate_idle_monitors();
+      break;
+    case _cleanup_update_inline_caches:
+      InlineCacheBuffer::update_inline_caches();
+      break;
+    case _cleanup_compilation_policy:
+      CompilationPolicy::policy()->do_safepoint_work();
+      break;
+    case _cleanup_mark_nmethods:
+      NMethodSweeper::mark_active_nmethods();
+      break;
+    case _cleanup_symbol_table_rehash:
+      SymbolTable::rehash_table();
+      break;
+    case _cleanup_string_table_rehash:
+      StringTable::rehash_table();
+      break;
+    default:
+      ShouldNotReachHere();
   }
 
-  {
-    const char* name = "mark nmethods";
-    EventSafepointCleanupTask event;
-    TraceTime t4(name, TraceSafepointCleanupTime);
-    NMethodSweeper::mark_active_nmethods();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+  if (PrintSafepointStatistics) {
+    // Each task is run by exactly one thread, so no synchronization needed.
+    jlong elapsed = os::javaTimeNanos() - start_time;
+    _cleanup_task_time[task] += elapsed;
+    if (elapsed > _max_cleanup_task_time[task]) {
+      _max_cleanup_task_time[task] = elapsed;
     }
   }
+  if (event.should_commit()) {
+    post_safepoint_cleanup_task_event(&event, name);
+  }
+}
+
+class ParallelSPCleanupTask : public AbstractGangTask {
+ private:
+  SubTasksDone _subtasks;
 
-  if (SymbolTable::needs_rehashing()) {
-    const char* name = "rehashing symbol table";
-    EventSafepointCleanupTask event;
-    TraceTime t5(name, TraceSafepointCleanupTime);
-    SymbolTable::rehash_table();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+ public:
+  ParallelSPCleanupTask(uint num_workers) :
+    AbstractGangTask("Parallel Safepoint Cleanup"),
+    _subtasks(SafepointSynchronize::_cleanup_num_tasks) {
+    _subtasks.set_n_threads(num_workers);
+  }
+
+  void work(uint worker_id) {
+    for (int t = 0; t < SafepointSynchronize::_cleanup_num_tasks; t++) {
+      if (!_subtasks.is_task_claimed(t)) {
+        SafepointSynchronize::do_cleanup_task((SafepointSynchronize::SafepointCleanupTask) t);
+      }
     }
+    _subtasks.all_tasks_completed();
   }
+};
 
-  if (StringTable::needs_rehashing()) {
-    const char* name = "rehashing string table";
-    EventSafepointCleanupTask event;
-    TraceTime t6(name, TraceSafepointCleanupTime);
-    StringTable::rehash_table();
-    if (event.should_commit()) {
-      post_safepoint_cleanup_task_event(&event, name);
+// Various cleaning tasks that should be done periodically at safepoints.
+// The tasks up to _cleanup_num_tasks are independent of each other and are
+// spread over the heap's GC worker threads if there are any.
+void SafepointSynchronize::do_cleanup_tasks() {
+  FlexibleWorkGang* workers = NULL;
+  if (ParallelSafepointCleanup && Universe::heap() != NULL) {
+    workers = Universe::heap()->get_safepoint_workers();
+  }
+  if (workers != NULL && workers->active_workers() > 1) {
+    ParallelSPCleanupTask cleanup(workers->active_workers());
+    workers->run_task(&cleanup);
+  } else {
+    for (int t = 0; t < _cleanup_num_tasks; t++) {
+      do_cleanup_task((SafepointCleanupTask) t);
     }
   }
 
@@ -792,6 +857,9 @@ void SafepointSynchronize::block(JavaThread *thread) {
 
         // Consider (_waiting_to_block < 2) to pipeline the wakeup of the VM thread
         if (_waiting_to_block == 0) {
+          if (SafepointTracer::is_active()) {
+            SafepointTracer::thread_blocked(thread);
+          }
           Safepoint_lock->notify_all();
         }
       }
@@ -1188,6 +1256,8 @@ julong SafepointSynchronize::_coalesced_vmop_count = 0;
 jlong  SafepointSynchronize::_max_sync_time = 0;
 jlong  SafepointSynchronize::_max_vmop_time = 0;
 float  SafepointSynchronize::_ts_of_current_safepoint = 0.0f;
+jlong  SafepointSynchronize::_cleanup_task_time[SafepointSynchronize::_cleanup_num_tasks];
+jlong  SafepointSynchronize::_max_cleanup_task_time[SafepointSynchronize::_cleanup_num_tasks];
 
 static jlong  cleanup_end_time = 0;
 static bool   need_to_track_page_armed_status = false;
@@ -1419,6 +1489,14 @@ void SafepointSynchronize::print_stat_on_exit() {
   tty->print_cr("Maximum vm operation time (except for Exit VM operation)  "
                 INT64_FORMAT_W(5) " ms",
                 _max_vmop_time / MICROUNITS);
+
+  tty->print_cr("Safepoint cleanup task times:");
+  for (int t = 0; t < _cleanup_num_tasks; t++) {
+    tty->print_cr("  %-38s total %10.3f ms  max %8.3f ms",
+                  cleanup_task_name((SafepointCleanupTask) t),
+                  (double) _cleanup_task_time[t] / NANOSECS_PER_MILLISEC,
+                  (double) _max_cleanup_task_time[t] / NANOSECS_PER_MILLISEC);
+  }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -75,6 +75,17 @@ class SafepointSynchronize : AllStatic {
     _blocking_timeout = 1
   };
 
+  // Cleanup tasks that do not depend on each other; see do_cleanup_tasks()
+  enum SafepointCleanupTask {
+    _cleanup_deflate_idle_monitors = 0,
+    _cleanup_update_inline_caches,
+    _cleanup_compilation_policy,
+    _cleanup_mark_nmethods,
+    _cleanup_symbol_table_rehash,
+    _cleanup_string_table_rehash,
+    _cleanup_num_tasks                         // must be last
+  };
+
   typedef struct {
     float  _time_stamp;                        // record when the current safepoint occurs in seconds
     int    _vmop_type;                         // type of VM operation triggers the safepoint
@@ -115,6 +126,8 @@ private:
   static jlong            _max_sync_time;            // maximum sync time in nanos
   static jlong            _max_vmop_time;            // maximum vm operation time in nanos
   static float            _ts_of_current_safepoint;  // time stamp of current safepoint in seconds
+  static jlong            _cleanup_task_time[_cleanup_num_tasks];     // total time of each cleanup task in nanos
+  static jlong            _max_cleanup_task_time[_cleanup_num_tasks]; // maximum time of each cleanup task in nanos
 
   static void begin_statistics(int nof_threads, int nof_running);
   static void update_statistics_on_spin_end();
@@ -172,6 +185,7 @@ public:
   }
   static bool is_cleanup_needed();
   static void do_cleanup_tasks();
+  static void do_cleanup_task(SafepointCleanupTask task);
 
   // debugging
   static void print_state()                                PRODUCT_RETURN;
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/nmethod.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/safepointTracer.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/vframe.hpp"
+#include "runtime/vmThread.hpp"
+#include "runtime/vm_operations.hpp"
+#include "utilities/ostream.hpp"
+
+SafepointTraceRecord* SafepointTracer::_records      = NULL;
+uint                  SafepointTracer::_next         = 0;
+uint                  SafepointTracer::_count        = 0;
+SafepointTraceRecord  SafepointTracer::_current;
+JavaThread* volatile  SafepointTracer::_last_thread  = NULL;
+Method*               SafepointTracer::_last_method  = NULL;
+bool                  SafepointTracer::_active       = false;
+
+static double millis(const Tickspan& span) {
+  return span.seconds() * MILLIUNITS;
+}
+
+void SafepointTraceRecord::print_on(outputStream* st) const {
+  st->print_cr("%.3f: safepoint %d, %s, threads: %d total, %d initially running, %d waited for",
+               _time_stamp, _safepoint_id,
+               _vmop_type == -1 ? "no vm operation" : VM_Operation::name(_vmop_type),
+               _nof_threads, _nof_initially_running, _nof_waiting_to_block);
+  st->print_cr("  time to safepoint %.3f ms (spin %.3f ms, block %.3f ms), cleanup %.3f ms, vm operation %.3f ms",
+               millis(time_to_safepoint()), millis(spin_time()), millis(block_time()),
+               millis(cleanup_time()), millis(operation_time()));
+  if (_last_thread_id != 0) {
+    st->print_cr("  last thread \"%s\" nid=" INTX_FORMAT, _last_thread_name, _last_thread_id);
+    if (_last_method_name[0] != '\0') {
+      st->print("  last frame %s", _last_method_name);
+      if (_last_line_number >= 0) {
+        st->print(" line %d", _last_line_number);
+      }
+      if (_last_comp_level == CompLevel_none) {
+        st->print(", interpreted");
+      } else {
+        st->print(", compiled at level %d", _last_comp_level);
+      }
+      st->print_cr(", pc " INTPTR_FORMAT, p2i(_last_pc));
+    }
+  }
+}
+
+void SafepointTracer::begin(int nof_threads) {
+  assert(Thread::current()->is_VM_thread(), "Only VM thread may execute a safepoint");
+  _active = is_enabled() || EventSafepointLatency::is_enabled();
+  if (!_active) {
+    return;
+  }
+  if (is_enabled() && _records == NULL) {
+    _records = NEW_C_HEAP_ARRAY(SafepointTraceRecord, SafepointTraceBufferSize, mtInternal);
+  }
+  VM_Operation* op = VMThread::vm_operation();
+  _current._safepoint_id = 0;
+  _current._vmop_type = (op != NULL ? op->type() : -1);
+  _current._time_stamp = os::elapsedTime();
+  _current._nof_threads = nof_threads;
+  _current._nof_initially_running = 0;
+  _current._nof_waiting_to_block = 0;
+  _current._last_thread_id = 0;
+  _current._last_thread_name[0] = '\0';
+  _current._last_method_name[0] = '\0';
+  _current._last_line_number = -1;
+  _current._last_comp_level = CompLevel_none;
+  _current._last_pc = NULL;
+  _last_thread = NULL;
+  _last_method = NULL;
+  _current._begin = Ticks::now();
+}
+
+void SafepointTracer::spin_done(int nof_initially_running, int nof_waiting_to_block, JavaThread* last) {
+  _current._spin_end = Ticks::now();
+  _current._nof_initially_running = nof_initially_running;
+  _current._nof_waiting_to_block = nof_waiting_to_block;
+  // Threads still to block will overwrite this when they do; the VM thread
+  // holds the Safepoint_lock until it waits for them.
+  _last_thread = last;
+}
+
+void SafepointTracer::record_last_thread(JavaThread* thread) {
+  ResourceMark rm;
+  OSThread* osthread = thread->osthread();
+  _current._last_thread_id = (osthread != NULL ? (intx) osthread->thread_id() : 0);
+  jio_snprintf(_current._last_thread_name, SafepointTraceRecord::thread_name_length,
+               "%s", thread->get_thread_name());
+  if (!thread->has_last_Java_frame()) {
+    return;
+  }
+  vframeStream vfst(thread);
+  if (vfst.at_end()) {
+    return;
+  }
+  Method* method = vfst.method();
+  _last_method = method;
+  method->name_and_sig_as_C_string(_current._last_method_name, SafepointTraceRecord::method_name_length);
+  if (vfst.bci() >= 0) {
+    _current._last_line_number = method->line_number_from_bci(vfst.bci());
+  }
+  _current._last_pc = vfst.frame_pc();
+  if (!vfst.is_interpreted_frame()) {
+    _current._last_comp_level = vfst.nm()->comp_level();
+  }
+}
+
+void SafepointTracer::synchronized() {
+  _current._sync_end = Ticks::now();
+  _current._safepoint_id = SafepointSynchronize::safepoint_counter();
+  JavaThread* thread = _last_thread;
+  if (thread != NULL) {
+    record_last_thread(thread);
+  }
+}
+
+void SafepointTracer::cleanup_done() {
+  _current._cleanup_end = Ticks::now();
+
+  EventSafepointLatency event(UNTIMED);
+  if (event.should_commit()) {
+    event.set_starttime(_current._begin);
+    event.set_endtime(_current._cleanup_end);
+    event.set_safepointId(_current._safepoint_id);
+    event.set_operation(_current._vmop_type == -1 ? VM_Operation::VMOp_Dummy : _current._vmop_type);
+    event.set_timeToSafepoint(_current.time_to_safepoint());
+    event.set_spinTime(_current.spin_time());
+    event.set_blockTime(_current.block_time());
+    event.set_cleanupTime(_current.cleanup_time());
+    JavaThread* thread = _last_thread;
+    event.set_lastThread(thread != NULL ? JFR_THREAD_ID(thread) : 0);
+    event.set_lastMethod(_last_method);
+    event.set_lastLineNumber(_current._last_line_number);
+    event.set_lastCompileLevel((u2) _current._last_comp_level);
+    event.set_lastPC((u8) p2i(_current._last_pc));
+    event.commit();
+  }
+  // The VM operation may unload classes
+  _last_method = NULL;
+}
+
+void SafepointTracer::end() {
+  _current._end = Ticks::now();
+  _active = false;
+  if (!is_enabled()) {
+    return;
+  }
+  MutexLockerEx ml(SafepointTrace_lock, Mutex::_no_safepoint_check_flag);
+  _records[_next] = _current;
+  _next = (_next + 1) % SafepointTraceBufferSize;
+  if (_count < SafepointTraceBufferSize) {
+    _count++;
+  }
+}
+
+void SafepointTracer::print_on(outputStream* st) {
+  if (!is_enabled()) {
+    st->print_cr("Safepoint tracing is disabled, see -XX:SafepointTraceBufferSize");
+    return;
+  }
+  ResourceMark rm;
+  SafepointTraceRecord* records = NEW_RESOURCE_ARRAY(SafepointTraceRecord, SafepointTraceBufferSize);
+  uint count;
+  {
+    // Copy the records so that no lock is held while printing
+    MutexLockerEx ml(SafepointTrace_lock, Mutex::_no_safepoint_check_flag);
+    count = _count;
+    uint first = (_next + SafepointTraceBufferSize - count) % SafepointTraceBufferSize;
+    for (uint i = 0; i < count; i++) {
+      records[i] = _records[(first + i) % SafepointTraceBufferSize];
+    }
+  }
+  st->print_cr("Last %u safepoints:", count);
+  for (uint i = 0; i < count; i++) {
+    records[i].print_on(st);
+  }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_SAFEPOINTTRACER_HPP
+#define SHARE_VM_RUNTIME_SAFEPOINTTRACER_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/ticks.hpp"
+
+class JavaThread;
+class Method;
+class outputStream;
+
+// One safepoint as seen by the SafepointTracer.
+class SafepointTraceRecord VALUE_OBJ_CLASS_SPEC {
+ public:
+  enum {
+    thread_name_length = 64,
+    method_name_length = 256
+  };
+
+  int      _safepoint_id;
+  int      _vmop_type;                            // -1 if no VM operation
+  double   _time_stamp;                           // seconds since VM start at begin
+  int      _nof_threads;                          // number of Java threads
+  int      _nof_initially_running;                // still running after the first state check
+  int      _nof_waiting_to_block;                 // still running after spinning
+  Ticks    _begin;
+  Ticks    _spin_end;
+  Ticks    _sync_end;
+  Ticks    _cleanup_end;
+  Ticks    _end;
+
+  // The thread that reached the safepoint last and its top Java frame
+  intx     _last_thread_id;                       // OS thread id, 0 if none
+  char     _last_thread_name[thread_name_length];
+  char     _last_method_name[method_name_length];
+  int      _last_line_number;
+  int      _last_comp_level;                      // CompLevel_none if interpreted
+  address  _last_pc;
+
+  Tickspan spin_time() const                      { return _spin_end - _begin; }
+  Tickspan block_time() const                     { return _sync_end - _spin_end; }
+  Tickspan time_to_safepoint() const              { return _sync_end - _begin; }
+  Tickspan cleanup_time() const                   { return _cleanup_end - _sync_end; }
+  Tickspan operation_time() const                 { return _end - _cleanup_end; }
+
+  void print_on(outputStream* st) const;
+};
+
+// Keeps the phase times of the last SafepointTraceBufferSize safepoints
+// together with the thread that reached each of them last, so that long
+// times to safepoint can be attributed to a thread, method and pc after
+// the fact (jcmd <pid> VM.safepoints). Each safepoint is also posted as a
+// SafepointLatency JFR event once its cleanup is done; the VM operation may
+// unload the last thread's method. Nothing is traced, and in particular the
+// last thread's stack is not walked, unless the buffer or the event is
+// enabled.
+//
+// Everything but thread_blocked() and print_on() is called by the VM
+// thread from SafepointSynchronize::begin() and end().
+class SafepointTracer : AllStatic {
+ private:
+  static SafepointTraceRecord* _records;          // ring buffer
+  static uint                  _next;             // slot for the next completed safepoint
+  static uint                  _count;            // number of valid records
+  static SafepointTraceRecord  _current;
+  static JavaThread* volatile  _last_thread;
+  static Method*               _last_method;      // for the JFR event, valid until cleanup_done()
+  static bool                  _active;           // the current safepoint is traced
+
+  static void record_last_thread(JavaThread* thread);
+
+ public:
+  // The ring buffer for jcmd VM.safepoints is kept
+  static bool is_enabled()                        { return SafepointTraceBufferSize > 0; }
+  // Set by begin() for the rest of the safepoint; the other calls are only
+  // made while it is set
+  static bool is_active()                         { return _active; }
+
+  static void begin(int nof_threads);
+  // The spin phase is over. last is the thread that was found to be safe
+  // last, or NULL if all threads were safe at the first check.
+  static void spin_done(int nof_initially_running, int nof_waiting_to_block, JavaThread* last);
+  // Called with the Safepoint_lock held by the thread whose blocking let
+  // the VM thread proceed.
+  static void thread_blocked(JavaThread* thread)  { _last_thread = thread; }
+  static void synchronized();
+  static void cleanup_done();
+  static void end();
+
+  static void print_on(outputStream* st);
+};
+
+#endif // SHARE_VM_RUNTIME_SAFEPOINTTRACER_HPP
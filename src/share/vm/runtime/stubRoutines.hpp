@@ -202,6 +202,7 @@ class StubRoutines: AllStatic {
   static address _aescrypt_decryptBlock;
   static address _cipherBlockChaining_encryptAESCrypt;
   static address _cipherBlockChaining_decryptAESCrypt;
+  static address _counterMode_AESCrypt;
   static address _ghash_processBlocks;
 
   static address _sha1_implCompress;
@@ -213,6 +214,10 @@ class StubRoutines: AllStatic {
 
   static address _updateBytesCRC32;
   static address _crc_table_adr;
+  static address _updateBytesCRC32C;
+  static address _updateBytesAdler32;
+
+  static address _vectorizedMismatch;
 
   static address _multiplyToLen;
   static address _squareToLen;
@@ -220,6 +225,16 @@ class StubRoutines: AllStatic {
   static address _montgomeryMultiply;
   static address _montgomerySquare;
 
+  // Platform stubs for java.lang.Math which are shared by the
+  // interpreter and both compilers. NULL when not provided.
+  static address _dexp;
+  static address _dlog;
+  static address _dlog10;
+  // dst[i] = f(src[i]) over double arrays, for C2's math loop idiom
+  static address _dexp_array;
+  static address _dlog_array;
+  static address _dlog10_array;
+
   // These are versions of the java.lang.Math methods which perform
   // the same operations as the intrinsic version.  They are used for
   // constant folding in the compiler to ensure equivalence.  If the
@@ -365,6 +380,7 @@ class StubRoutines: AllStatic {
   static address aescrypt_decryptBlock()                { return _aescrypt_decryptBlock; }
   static address cipherBlockChaining_encryptAESCrypt()  { return _cipherBlockChaining_encryptAESCrypt; }
   static address cipherBlockChaining_decryptAESCrypt()  { return _cipherBlockChaining_decryptAESCrypt; }
+  static address counterMode_AESCrypt()                 { return _counterMode_AESCrypt; }
   static address ghash_processBlocks() { return _ghash_processBlocks; }
 
   static address sha1_implCompress()     { return _sha1_implCompress; }
@@ -376,6 +392,10 @@ class StubRoutines: AllStatic {
 
   static address updateBytesCRC32()    { return _updateBytesCRC32; }
   static address crc_table_addr()      { return _crc_table_adr; }
+  static address updateBytesCRC32C()   { return _updateBytesCRC32C; }
+  static address updateBytesAdler32()  { return _updateBytesAdler32; }
+
+  static address vectorizedMismatch()  { return _vectorizedMismatch; }
 
   static address multiplyToLen()       {return _multiplyToLen; }
   static address squareToLen()         {return _squareToLen; }
@@ -383,6 +403,13 @@ class StubRoutines: AllStatic {
   static address montgomeryMultiply()  { return _montgomeryMultiply; }
   static address montgomerySquare()    { return _montgomerySquare; }
 
+  static address dexp()                { return _dexp; }
+  static address dlog()                { return _dlog; }
+  static address dlog10()              { return _dlog10; }
+  static address dexp_array()          { return _dexp_array; }
+  static address dlog_array()          { return _dlog_array; }
+  static address dlog10_array()        { return _dlog10_array; }
+
   static address select_fill_function(BasicType t, bool aligned, const char* &name);
 
   static address zero_aligned_words()   { return _zero_aligned_words; }
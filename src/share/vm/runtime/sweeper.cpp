@@ -23,21 +23,29 @@
  */
 
 #include "precompiled.hpp"
+#include "asm/codeBuffer.hpp"
 #include "code/codeCache.hpp"
 #include "code/compiledIC.hpp"
+#include "code/dependencies.hpp"
 #include "code/icBuffer.hpp"
 #include "code/nmethod.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc_interface/collectedHeap.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
 #include "oops/method.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/compilationPolicy.hpp"
+#include "runtime/icache.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sweeper.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/vmThread.hpp"
 #include "runtime/vm_operations.hpp"
 #include "utilities/events.hpp"
 #include "utilities/ticks.hpp"
@@ -137,13 +145,20 @@ long     NMethodSweeper::_total_nof_code_cache_sweeps  = 0;    // Total number o
 long     NMethodSweeper::_time_counter                 = 0;    // Virtual time used to periodically invoke sweeper
 long     NMethodSweeper::_last_sweep                   = 0;    // Value of _time_counter when the last sweep happened
 int      NMethodSweeper::_seen                         = 0;    // Nof. nmethod we have currently processed in current pass of CodeCache
-int      NMethodSweeper::_flushed_count                = 0;    // Nof. nmethods flushed in current sweep
-int      NMethodSweeper::_zombified_count              = 0;    // Nof. nmethods made zombie in current sweep
-int      NMethodSweeper::_marked_for_reclamation_count = 0;    // Nof. nmethods marked for reclaim in current sweep
+volatile int NMethodSweeper::_flushed_count            = 0;    // Nof. nmethods flushed in current sweep
+volatile int NMethodSweeper::_flushed_c2_count         = 0;    // Nof. C2-compiled nmethods flushed in current sweep
+volatile int NMethodSweeper::_zombified_count          = 0;    // Nof. nmethods made zombie in current sweep
+volatile int NMethodSweeper::_marked_for_reclamation_count = 0; // Nof. nmethods marked for reclaim in current sweep
+
+int      NMethodSweeper::_active_sweepers              = 0;    // Nof. threads sweeping the current fraction
+int      NMethodSweeper::_fraction_todo                = 0;    // Nof. nmethods left to claim in the current fraction
+int      NMethodSweeper::_fraction_swept               = 0;    // Nof. nmethods swept in the current fraction
+int      NMethodSweeper::_fraction_freed               = 0;    // Bytes freed in the current fraction
+Ticks    NMethodSweeper::_fraction_start;                      // Time the current fraction was started
 
 volatile bool NMethodSweeper::_should_sweep            = true; // Indicates if we should invoke the sweeper
 volatile int  NMethodSweeper::_sweep_fractions_left    = 0;    // Nof. invocations left until we are completed with this pass
-volatile int  NMethodSweeper::_sweep_started           = 0;    // Flag to control conc sweeper
+volatile int  NMethodSweeper::_sweep_started           = 0;    // Set while a fraction is swept or finished
 volatile int  NMethodSweeper::_bytes_changed           = 0;    // Counts the total nmethod size if the nmethod changed from:
                                                                //   1) alive       -> not_entrant
                                                                //   2) not_entrant -> zombie
@@ -158,6 +173,11 @@ Tickspan  NMethodSweeper::_total_time_this_sweep;               // Total time th
 Tickspan  NMethodSweeper::_peak_sweep_time;                     // Peak time for a full sweep
 Tickspan  NMethodSweeper::_peak_sweep_fraction_time;            // Peak time sweeping one fraction
 
+long   NMethodSweeper::_total_nof_compactions           = 0;    // Nof. code cache compactions
+long   NMethodSweeper::_total_nof_methods_moved         = 0;    // Accumulated nof methods moved by compaction
+size_t NMethodSweeper::_total_moved_size                = 0;    // Total size of moved methods
+Tickspan  NMethodSweeper::_total_time_compacting;               // Accumulated time compacting
+
 
 
 class MarkActivationClosure: public CodeBlobClosure {
@@ -194,7 +214,8 @@ int NMethodSweeper::hotness_counter_reset_val() {
   return _hotness_counter_reset_val;
 }
 bool NMethodSweeper::sweep_in_progress() {
-  return (_current != NULL);
+  // A pass is not over before the last claimed nmethod has been processed
+  return (_current != NULL) || (_sweep_started != 0);
 }
 
 // Scans the stacks of all Java threads and marks activations of not-entrant methods.
@@ -280,26 +301,27 @@ void NMethodSweeper::possibly_sweep() {
   }
 
   if (_should_sweep && _sweep_fractions_left > 0) {
-    // Only one thread at a time will sweep
-    jint old = Atomic::cmpxchg( 1, &_sweep_started, 0 );
-    if (old != 0) {
-      return;
-    }
 #ifdef ASSERT
     if (LogSweeper && _records == NULL) {
       // Create the ring buffer for the logging code
-      _records = NEW_C_HEAP_ARRAY(SweeperRecord, SweeperLogEntries, mtGC);
-      memset(_records, 0, sizeof(SweeperRecord) * SweeperLogEntries);
+      SweeperRecord* records = NEW_C_HEAP_ARRAY(SweeperRecord, SweeperLogEntries, mtGC);
+      memset(records, 0, sizeof(SweeperRecord) * SweeperLogEntries);
+      if (Atomic::cmpxchg_ptr(records, &_records, NULL) != NULL) {
+        // Another sweeper thread created it first
+        FREE_C_HEAP_ARRAY(SweeperRecord, records, mtGC);
+      }
     }
 #endif
 
-    if (_sweep_fractions_left > 0) {
-      sweep_code_cache();
-      _sweep_fractions_left--;
+    // Only the thread that leaves the fraction last continues
+    if (!sweep_code_cache()) {
+      return;
     }
+    _sweep_fractions_left--;
 
     // We are done with sweeping the code cache once.
-    if (_sweep_fractions_left == 0) {
+    const bool sweep_completed = (_sweep_fractions_left == 0);
+    if (sweep_completed) {
       _total_nof_code_cache_sweeps++;
       _last_sweep = _time_counter;
       // Reset flag; temporarily disables sweeper
@@ -315,6 +337,11 @@ void NMethodSweeper::possibly_sweep() {
     }
     // Release work, because another compiler thread could continue.
     OrderAccess::release_store((int*)&_sweep_started, 0);
+
+    if (sweep_completed && should_compact_code_cache()) {
+      VM_CompactCodeCache op;
+      VMThread::execute(&op);
+    }
   }
 }
 
@@ -336,83 +363,118 @@ static void post_sweep_event(EventSweepCodeCache* event,
   event->commit();
 }
 
-void NMethodSweeper::sweep_code_cache() {
-  ResourceMark rm;
-  Ticks sweep_start_counter = Ticks::now();
-
-  _flushed_count                = 0;
-  _zombified_count              = 0;
-  _marked_for_reclamation_count = 0;
-
-  if (PrintMethodFlushing && Verbose) {
-    tty->print_cr("### Sweep at %d out of %d. Invocations left: %d", _seen, CodeCache::nof_nmethods(), _sweep_fractions_left);
-  }
-
-  if (!CompileBroker::should_compile_new_jobs()) {
-    // If we have turned off compilations we might as well do full sweeps
-    // in order to reach the clean state faster. Otherwise the sleeping compiler
-    // threads will slow down sweeping.
-    _sweep_fractions_left = 1;
-  }
-
-  // We want to visit all nmethods after NmethodSweepFraction
-  // invocations so divide the remaining number of nmethods by the
-  // remaining number of invocations.  This is only an estimate since
-  // the number of nmethods changes during the sweep so the final
-  // stage must iterate until it there are no more nmethods.
-  int todo = (CodeCache::nof_nmethods() - _seen) / _sweep_fractions_left;
-  int swept_count = 0;
-
-
+/**
+ * Sweeps a fraction of the code cache. Compiler threads that come here while
+ * a fraction is being swept help with it, up to NmethodSweepParallelism of
+ * them. Returns true if the calling thread was the last one to leave the
+ * fraction. That thread finishes the fraction and must release _sweep_started.
+ */
+bool NMethodSweeper::sweep_code_cache() {
   assert(!SafepointSynchronize::is_at_safepoint(), "should not be in safepoint when we get here");
   assert(!CodeCache_lock->owned_by_self(), "just checking");
 
+  ResourceMark rm;
+  int swept_count = 0;
   int freed_memory = 0;
+  bool last = false;
   {
     MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
+    if (_active_sweepers == 0) {
+      // Start a new fraction, unless the last one is still being finished
+      if (_sweep_started != 0 || _current == NULL || _sweep_fractions_left == 0) {
+        return false;
+      }
+      _sweep_started                = 1;
+      _fraction_start               = Ticks::now();
+      _fraction_swept               = 0;
+      _fraction_freed               = 0;
+      _flushed_count                = 0;
+      _flushed_c2_count             = 0;
+      _zombified_count              = 0;
+      _marked_for_reclamation_count = 0;
+
+      if (PrintMethodFlushing && Verbose) {
+        tty->print_cr("### Sweep at %d out of %d. Invocations left: %d", _seen, CodeCache::nof_nmethods(), _sweep_fractions_left);
+      }
+
+      if (!CompileBroker::should_compile_new_jobs()) {
+        // If we have turned off compilations we might as well do full sweeps
+        // in order to reach the clean state faster. Otherwise the sleeping compiler
+        // threads will slow down sweeping.
+        _sweep_fractions_left = 1;
+      }
+
+      // We want to visit all nmethods after NmethodSweepFraction
+      // invocations so divide the remaining number of nmethods by the
+      // remaining number of invocations.  This is only an estimate since
+      // the number of nmethods changes during the sweep so the final
+      // stage must iterate until it there are no more nmethods.
+      _fraction_todo = (CodeCache::nof_nmethods() - _seen) / _sweep_fractions_left;
+    } else if (_active_sweepers >= NmethodSweepParallelism) {
+      return false;
+    }
+    _active_sweepers++;
+
     // The last invocation iterates until there are no more nmethods
-    for (int i = 0; (i < todo || _sweep_fractions_left == 1) && _current != NULL; i++) {
-      swept_count++;
+    while ((_fraction_todo > 0 || _sweep_fractions_left == 1) && _current != NULL) {
       if (SafepointSynchronize::is_synchronizing()) { // Safepoint request
         if (PrintMethodFlushing && Verbose) {
           tty->print_cr("### Sweep at %d out of %d, invocation: %d, yielding to safepoint", _seen, CodeCache::nof_nmethods(), _sweep_fractions_left);
         }
-        MutexUnlockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+        {
+          MutexUnlockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
-        assert(Thread::current()->is_Java_thread(), "should be java thread");
-        JavaThread* thread = (JavaThread*)Thread::current();
-        ThreadBlockInVM tbivm(thread);
-        thread->java_suspend_self();
+          assert(Thread::current()->is_Java_thread(), "should be java thread");
+          JavaThread* thread = (JavaThread*)Thread::current();
+          ThreadBlockInVM tbivm(thread);
+          thread->java_suspend_self();
+        }
+        // The other sweeper threads may have claimed the rest of the fraction
+        continue;
       }
-      // Since we will give up the CodeCache_lock, always skip ahead
-      // to the next nmethod.  Other blobs can be deleted by other
-      // threads but nmethods are only reclaimed by the sweeper.
-      nmethod* next = CodeCache::next_nmethod(_current);
+      // Claim the next nmethod. Since we will give up the CodeCache_lock,
+      // always skip ahead to the next nmethod. Other blobs can be deleted by
+      // other threads but nmethods are only reclaimed by the sweeper, and
+      // each one only by the sweeper thread that claimed it.
+      nmethod* nm = _current;
+      _current = CodeCache::next_nmethod(nm);
+      _fraction_todo--;
+      _seen++;
+      swept_count++;
 
       // Now ready to process nmethod and give up CodeCache_lock
       {
         MutexUnlockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-        freed_memory += process_nmethod(_current);
+        freed_memory += process_nmethod(nm);
       }
-      _seen++;
-      _current = next;
     }
+
+    _fraction_swept += swept_count;
+    _fraction_freed += freed_memory;
+    _active_sweepers--;
+    last = (_active_sweepers == 0);
+  }
+
+  if (!last) {
+    return false;
   }
 
+  // No other thread can start or join a fraction until _sweep_started is released
   assert(_sweep_fractions_left > 1 || _current == NULL, "must have scanned the whole cache");
 
   const Ticks sweep_end_counter = Ticks::now();
-  const Tickspan sweep_time = sweep_end_counter - sweep_start_counter;
+  const Tickspan sweep_time = sweep_end_counter - _fraction_start;
   _total_time_sweeping  += sweep_time;
   _total_time_this_sweep += sweep_time;
   _peak_sweep_fraction_time = MAX2(sweep_time, _peak_sweep_fraction_time);
-  _total_flushed_size += freed_memory;
+  _total_flushed_size += _fraction_freed;
   _total_nof_methods_reclaimed += _flushed_count;
+  _total_nof_c2_methods_reclaimed += _flushed_c2_count;
 
   EventSweepCodeCache event(UNTIMED);
   if (event.should_commit()) {
-    post_sweep_event(&event, sweep_start_counter, sweep_end_counter, (s4)_traversals, swept_count, _flushed_count, _zombified_count);
+    post_sweep_event(&event, _fraction_start, sweep_end_counter, (s4)_traversals, _fraction_swept, _flushed_count, _zombified_count);
   }
 
 #ifdef ASSERT
@@ -436,10 +498,11 @@ void NMethodSweeper::sweep_code_cache() {
   // it only makes sense to re-enable compilation if we have actually freed memory.
   // Note that typically several kB are released for sweeping 16MB of the code
   // cache. As a result, 'freed_memory' > 0 to restart the compiler.
-  if (!CompileBroker::should_compile_new_jobs() && (freed_memory > 0)) {
+  if (!CompileBroker::should_compile_new_jobs() && (_fraction_freed > 0)) {
     CompileBroker::set_should_compile_new_jobs(CompileBroker::run_compilation);
     log_sweep("restart_compiler");
   }
+  return true;
 }
 
 /**
@@ -532,10 +595,10 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       }
       freed_memory = nm->total_size();
       if (nm->is_compiled_by_c2()) {
-        _total_nof_c2_methods_reclaimed++;
+        Atomic::inc(&_flushed_c2_count);
       }
       release_nmethod(nm);
-      _flushed_count++;
+      Atomic::inc(&_flushed_count);
     } else {
       if (PrintMethodFlushing && Verbose) {
         tty->print_cr("### Nmethod %3d/" PTR_FORMAT " (zombie) being marked for reclamation", nm->compile_id(), nm);
@@ -543,7 +606,7 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       nm->mark_for_reclamation();
       // Keep track of code cache state change
       _bytes_changed += nm->total_size();
-      _marked_for_reclamation_count++;
+      Atomic::inc(&_marked_for_reclamation_count);
       SWEEP(nm);
     }
   } else if (nm->is_not_entrant()) {
@@ -559,7 +622,7 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       nm->clear_ic_stubs();
       // Code cache state change is tracked in make_zombie()
       nm->make_zombie();
-      _zombified_count++;
+      Atomic::inc(&_zombified_count);
       SWEEP(nm);
     } else {
       // Still alive, clean up its inline caches
@@ -577,10 +640,10 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       // No inline caches will ever point to osr methods, so we can just remove it
       freed_memory = nm->total_size();
       if (nm->is_compiled_by_c2()) {
-        _total_nof_c2_methods_reclaimed++;
+        Atomic::inc(&_flushed_c2_count);
       }
       release_nmethod(nm);
-      _flushed_count++;
+      Atomic::inc(&_flushed_count);
     } else {
       {
         // Clean ICs of unloaded nmethods as well because they may reference other
@@ -590,7 +653,7 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
       }
       // Code cache state change is tracked in make_zombie()
       nm->make_zombie();
-      _zombified_count++;
+      Atomic::inc(&_zombified_count);
       SWEEP(nm);
     }
   } else {
@@ -633,6 +696,260 @@ int NMethodSweeper::process_nmethod(nmethod *nm) {
   return freed_memory;
 }
 
+// Code cache compaction
+
+// An nmethod that was moved by compact_code_cache()
+class NMethodMove VALUE_OBJ_CLASS_SPEC {
+ public:
+  address  _begin;                                 // old location
+  address  _end;
+  nmethod* _copy;                                  // new location
+
+  NMethodMove() : _begin(NULL), _end(NULL), _copy(NULL) { }
+  NMethodMove(address begin, address end, nmethod* copy) : _begin(begin), _end(end), _copy(copy) { }
+
+  intptr_t delta() const                           { return (address)_copy - _begin; }
+};
+
+// Maps an address in the old copy of a moved nmethod to the new copy. The
+// moves are sorted by decreasing old address.
+static address moved_address(GrowableArray<NMethodMove>* moves, address addr) {
+  int lo = 0;
+  int hi = moves->length() - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    NMethodMove move = moves->at(mid);
+    if (addr >= move._end) {
+      hi = mid - 1;
+    } else if (addr < move._begin) {
+      lo = mid + 1;
+    } else {
+      return addr + move.delta();
+    }
+  }
+  return addr;
+}
+
+// Collects the nmethods active on stacks, sorted by address
+class CollectActiveNMethodsClosure: public CodeBlobClosure {
+ private:
+  GrowableArray<nmethod*>* _active;
+ public:
+  CollectActiveNMethodsClosure(GrowableArray<nmethod*>* active) : _active(active) { }
+  virtual void do_code_blob(CodeBlob* cb) {
+    if (cb->is_nmethod()) {
+      add((nmethod*)cb);
+    }
+  }
+  void add(nmethod* nm) {
+    _active->insert_sorted<compare>(nm);
+  }
+  bool contains(nmethod* nm) {
+    bool found;
+    _active->find_sorted<nmethod*, compare>(nm, found);
+    return found;
+  }
+  static int compare(nmethod* const& a, nmethod* const& b) {
+    if (a == b) return 0;
+    return (a < b) ? -1 : 1;
+  }
+};
+
+// The fragmented part of the code cache is the free memory outside of the
+// largest free block, which no allocation larger than the second largest
+// free block can use.
+bool NMethodSweeper::should_compact_code_cache() {
+  if (!CodeCacheCompaction) {
+    return false;
+  }
+  size_t fragmented;
+  {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    fragmented = CodeCache::freelist_capacity() - CodeCache::largest_free_block();
+  }
+  return fragmented >= ReservedCodeCacheSize / 100 * CodeCacheCompactionThreshold;
+}
+
+// Copies nm to dest, a block of the code cache below it, and makes
+// everything but the call sites in other nmethods refer to the copy.
+// Frees the old copy.
+nmethod* NMethodSweeper::move_nmethod(nmethod* nm, address dest) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+  assert(dest < (address)nm, "must move down");
+
+  memcpy(dest, (void*)nm, nm->size());
+  nmethod* copy = (nmethod*)dest;
+  const intptr_t delta = dest - (address)nm;
+
+  copy->_entry_point          += delta;
+  copy->_verified_entry_point += delta;
+  copy->_pc_desc_cache.reset_to(copy->scopes_pcs_begin());
+
+  // The exception cache holds absolute pcs of the old copy, drop it
+  ExceptionCache* ec = copy->exception_cache();
+  while (ec != NULL) {
+    ExceptionCache* next = ec->next();
+    delete ec;
+    ec = next;
+  }
+  copy->set_exception_cache(NULL);
+
+  // Both copies are described as a single section covering their content,
+  // so internal references move with the code and pc relative references
+  // to code outside of the nmethod are adjusted. Calls keep their absolute
+  // destination; calls into moved nmethods, this one included, are
+  // redirected by fix_moved_call_sites() once all nmethods are in place.
+  {
+    CodeBuffer src(nm->content_begin(), nm->content_size());
+    CodeBuffer dst(copy->content_begin(), copy->content_size());
+    RelocIterator iter(copy);
+    while (iter.next()) {
+      iter.reloc()->fix_relocation_after_move(&src, &dst);
+    }
+  }
+  ICache::invalidate_range(dest, copy->size());
+
+  // Re-register the copy with the classes it depends on and the heap
+  for (Dependencies::DepStream deps(copy); deps.next(); ) {
+    Klass* klass = deps.context_type();
+    if (klass == NULL) {
+      continue;  // ignore things like evol_method
+    }
+    InstanceKlass::cast(klass)->remove_dependent_nmethod(nm, true);
+    InstanceKlass::cast(klass)->add_dependent_nmethod(copy);
+  }
+  Universe::heap()->unregister_nmethod(nm);
+  Universe::heap()->register_nmethod(copy);
+
+  methodHandle mh(copy->method());
+  Method::set_code(mh, copy);
+
+  if (_current == nm) {
+    _current = copy;
+  }
+
+  CodeCache::commit(copy);
+  CodeCache::free(nm);
+  return copy;
+}
+
+// Redirects all calls into the old copies of moved nmethods.
+void NMethodSweeper::fix_moved_call_sites(GrowableArray<NMethodMove>* moves) {
+  for (nmethod* nm = CodeCache::first_nmethod(); nm != NULL; nm = CodeCache::next_nmethod(nm)) {
+    bool patched = false;
+    RelocIterator iter(nm);
+    while (iter.next()) {
+      switch (iter.type()) {
+        case relocInfo::virtual_call_type:
+        case relocInfo::opt_virtual_call_type:
+        case relocInfo::static_call_type: {
+          CallRelocation* r = (CallRelocation*)iter.reloc();
+          address dest = r->destination();
+          address moved_dest = moved_address(moves, dest);
+          if (moved_dest != dest) {
+            r->set_destination(moved_dest);
+            patched = true;
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    if (patched) {
+      ICache::invalidate_range(nm->content_begin(), nm->content_size());
+    }
+  }
+}
+
+/**
+ * Moves in-use nmethods from the top of the code cache into the best fitting
+ * free block below them, so that the free space left behind coalesces into
+ * larger blocks. An nmethod is only moved if nothing refers to its old copy
+ * that is not fixed up here: it must not be active on a stack, scanned by the
+ * sweeper, locked by the VM, an OSR method (linked from its holder) or on the
+ * scavenge root list, and it must be its method's code.
+ */
+void NMethodSweeper::compact_code_cache() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
+
+  // Agents keep the code addresses they were told about and transition
+  // stubs refer to call sites by address
+  if (JvmtiExport::should_post_compiled_method_load() ||
+      JvmtiExport::should_post_compiled_method_unload() ||
+      !InlineCacheBuffer::is_empty()) {
+    return;
+  }
+
+  ResourceMark rm;
+  const Ticks compaction_start = Ticks::now();
+
+  GrowableArray<nmethod*>* active = new GrowableArray<nmethod*>();
+  CollectActiveNMethodsClosure active_cl(active);
+  Threads::nmethods_do(&active_cl);
+  for (JavaThread* thread = Threads::first(); thread != NULL; thread = thread->next()) {
+    if (thread->deopt_nmethod() != NULL) {
+      active_cl.add(thread->deopt_nmethod());
+    }
+    // A sweeper thread may be stopped for this safepoint in the middle of
+    // processing an nmethod (e.g. waiting for CompiledIC_lock). Only
+    // CompilerThread::oops_do reports it, nmethods_do does not.
+    if (thread->is_Compiler_thread() && thread->as_CompilerThread()->scanned_nmethod() != NULL) {
+      active_cl.add(thread->as_CompilerThread()->scanned_nmethod());
+    }
+  }
+
+  GrowableArray<nmethod*>* candidates = new GrowableArray<nmethod*>();
+  for (nmethod* nm = CodeCache::first_nmethod(); nm != NULL; nm = CodeCache::next_nmethod(nm)) {
+    if (!nm->is_in_use() || nm->is_osr_method() || nm->is_locked_by_vm() ||
+        nm->on_scavenge_root_list() || nm->method() == NULL || nm->method()->code() != nm) {
+      continue;
+    }
+    if (!active_cl.contains(nm)) {
+      candidates->append(nm);
+    }
+  }
+
+  // Highest first, so that the moves are sorted by decreasing old address
+  GrowableArray<NMethodMove>* moves = new GrowableArray<NMethodMove>(candidates->length());
+  size_t moved_size = 0;
+  for (int i = candidates->length() - 1; i >= 0; i--) {
+    nmethod* nm = candidates->at(i);
+    address dest = (address)CodeCache::allocate_below(nm->size(), (address)nm);
+    if (dest == NULL) {
+      continue;
+    }
+    address begin = (address)nm;
+    address end = begin + nm->size();
+    moved_size += nm->size();
+    moves->append(NMethodMove(begin, end, move_nmethod(nm, dest)));
+  }
+
+  if (moves->is_empty()) {
+    return;
+  }
+  fix_moved_call_sites(moves);
+
+  // A moved nmethod may have crossed the sweeper's position in the current
+  // pass. Clean its inline caches now, as the pass would have, so that the
+  // nmethods they point to can still be reclaimed a pass later.
+  for (int i = 0; i < moves->length(); i++) {
+    moves->at(i)._copy->cleanup_inline_caches();
+  }
+
+  const Tickspan compaction_time = Ticks::now() - compaction_start;
+  _total_nof_compactions++;
+  _total_nof_methods_moved += moves->length();
+  _total_moved_size += moved_size;
+  _total_time_compacting += compaction_time;
+
+  if (PrintMethodFlushing && Verbose) {
+    tty->print_cr("### Compaction moved %d nmethods (" SIZE_FORMAT "kB) in %1.3lfms",
+                  moves->length(), moved_size / K, (double)compaction_time.value() / 1000000);
+  }
+  log_sweep("compacted", "moved='%d' moved_size='" SIZE_FORMAT "' ", moves->length(), moved_size);
+}
+
 // Print out some state information about the current sweep and the
 // state of the code cache if it's requested.
 void NMethodSweeper::log_sweep(const char* msg, const char* format, ...) {
@@ -683,4 +1000,10 @@ void NMethodSweeper::print() {
   tty->print_cr("  Total number of flushed methods: %ld(%ld C2 methods)", _total_nof_methods_reclaimed,
                                                     _total_nof_c2_methods_reclaimed);
   tty->print_cr("  Total size of flushed methods:   " SIZE_FORMAT "kB", _total_flushed_size/K);
+  if (CodeCacheCompaction) {
+    tty->print_cr("  Total number of compactions:     %ld", _total_nof_compactions);
+    tty->print_cr("  Total compaction time:           %1.0lfms", (double)_total_time_compacting.value()/1000000);
+    tty->print_cr("  Total number of moved methods:   %ld", _total_nof_methods_moved);
+    tty->print_cr("  Total size of moved methods:     " SIZE_FORMAT "kB", _total_moved_size/K);
+  }
 }
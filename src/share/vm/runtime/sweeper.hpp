@@ -26,10 +26,15 @@
 #define SHARE_VM_RUNTIME_SWEEPER_HPP
 
 #include "utilities/ticks.hpp"
+
+class NMethodMove;
+template <class E> class GrowableArray;
+
 // An NmethodSweeper is an incremental cleaner for:
 //    - cleanup inline caches
 //    - reclamation of nmethods
-// Removing nmethods from the code cache includes two operations
+// Removing nmethods from the code cache includes two operations, a third one
+// reduces fragmentation
 //  1) mark active nmethods
 //     Is done in 'mark_active_nmethods()'. This function is called at a
 //     safepoint and marks all nmethods that are active on a thread's stack.
@@ -51,7 +56,14 @@
 //     state change happens during separate sweeps. It may take at least 3 sweeps before an
 //     nmethod's space is freed. Sweeping is currently done by compiler threads between
 //     compilations or at least each 5 sec (NmethodSweepCheckInterval) when the code cache
-//     is full.
+//     is full. Up to NmethodSweepParallelism compiler threads sweep the same
+//     fraction of the code cache; each claims one nmethod at a time under the
+//     CodeCache_lock and the last thread to leave the fraction finishes it.
+//  3) compact the code cache (optional, see CodeCacheCompaction)
+//     Is done in compact_code_cache() at a safepoint after a full sweep left
+//     the code cache fragmented. In-use nmethods that no thread and no other
+//     VM structure holds on to are copied into free blocks below them, their
+//     relocations are fixed up, and all call sites are redirected to the copies.
 
 class NMethodSweeper : public AllStatic {
   static long      _traversals;                     // Stack scan count, also sweep ID.
@@ -60,12 +72,20 @@ class NMethodSweeper : public AllStatic {
   static long      _last_sweep;                     // Value of _time_counter when the last sweep happened
   static nmethod*  _current;                        // Current nmethod
   static int       _seen;                           // Nof. nmethod we have currently processed in current pass of CodeCache
-  static int       _flushed_count;                  // Nof. nmethods flushed in current sweep
-  static int       _zombified_count;                // Nof. nmethods made zombie in current sweep
-  static int       _marked_for_reclamation_count;   // Nof. nmethods marked for reclaim in current sweep
+  static volatile int _flushed_count;               // Nof. nmethods flushed in current sweep
+  static volatile int _flushed_c2_count;            // Nof. C2-compiled nmethods flushed in current sweep
+  static volatile int _zombified_count;             // Nof. nmethods made zombie in current sweep
+  static volatile int _marked_for_reclamation_count; // Nof. nmethods marked for reclaim in current sweep
+
+  // The following are protected by the CodeCache_lock
+  static int       _active_sweepers;                // Nof. threads sweeping the current fraction
+  static int       _fraction_todo;                  // Nof. nmethods left to claim in the current fraction
+  static int       _fraction_swept;                 // Nof. nmethods swept in the current fraction
+  static int       _fraction_freed;                 // Bytes freed in the current fraction
+  static Ticks     _fraction_start;                 // Time the current fraction was started
 
   static volatile int  _sweep_fractions_left;       // Nof. invocations left until we are completed with this pass
-  static volatile int  _sweep_started;              // Flag to control conc sweeper
+  static volatile int  _sweep_started;              // Set while a fraction is swept or finished
   static volatile bool _should_sweep;               // Indicates if we should invoke the sweeper
   static volatile int  _bytes_changed;              // Counts the total nmethod size if the nmethod changed from:
                                                     //   1) alive       -> not_entrant
@@ -82,11 +102,20 @@ class NMethodSweeper : public AllStatic {
   static Tickspan  _peak_sweep_time;                // Peak time for a full sweep
   static Tickspan  _peak_sweep_fraction_time;       // Peak time sweeping one fraction
 
+  static long      _total_nof_compactions;          // Nof. code cache compactions
+  static long      _total_nof_methods_moved;        // Accumulated nof methods moved by compaction
+  static size_t    _total_moved_size;               // Total size of moved methods
+  static Tickspan  _total_time_compacting;          // Accumulated time compacting
+
   static int  process_nmethod(nmethod *nm);
   static void release_nmethod(nmethod* nm);
 
   static bool sweep_in_progress();
-  static void sweep_code_cache();
+  static bool sweep_code_cache();
+
+  static bool should_compact_code_cache();
+  static nmethod* move_nmethod(nmethod* nm, address dest);
+  static void fix_moved_call_sites(GrowableArray<NMethodMove>* moves);
 
  public:
   static long traversal_count()              { return _traversals; }
@@ -107,6 +136,7 @@ class NMethodSweeper : public AllStatic {
 
   static void mark_active_nmethods();      // Invoked at the end of each safepoint
   static void possibly_sweep();            // Compiler threads call this to sweep
+  static void compact_code_cache();        // Invoked by VM_CompactCodeCache
 
   static int hotness_counter_reset_val();
   static void report_state_change(nmethod* nm);
@@ -1473,6 +1473,8 @@ void JavaThread::initialize() {
   _do_not_unlock_if_synchronized = false;
   _cached_monitor_info = NULL;
   _parker = Parker::Allocate(this) ;
+  _profile_sample_counter = 1;
+  _profile_sample_seed = (juint) os::random();
 
 #ifndef PRODUCT
   _jmp_ring_index = 0;
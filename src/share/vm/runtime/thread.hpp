@@ -925,6 +925,12 @@ class JavaThread: public Thread {
   // For deadlock detection.
   int _depth_first_number;
 
+  // Sampled tier 3 profiling (Tier3ProfileUpdateFreqLog): compiled code
+  // counts down _profile_sample_counter and only updates the MDO when it
+  // runs out; the next interval is drawn from _profile_sample_seed.
+  jint    _profile_sample_counter;
+  juint   _profile_sample_seed;
+
   // JVMTI PopFrame support
   // This is set to popframe_pending to signal that top Java frame should be popped immediately
   int _popframe_condition;
@@ -1371,6 +1377,9 @@ class JavaThread: public Thread {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
 
+  static ByteSize profile_sample_counter_offset() { return byte_offset_of(JavaThread, _profile_sample_counter); }
+  static ByteSize profile_sample_seed_offset()   { return byte_offset_of(JavaThread, _profile_sample_seed ); }
+
 #if INCLUDE_ALL_GCS
   static ByteSize satb_mark_queue_offset()       { return byte_offset_of(JavaThread, _satb_mark_queue); }
   static ByteSize dirty_card_queue_offset()      { return byte_offset_of(JavaThread, _dirty_card_queue); }
@@ -1880,6 +1889,7 @@ public:
   void          set_task(CompileTask* task)      { _task = task; }
 
   // Track the nmethod currently being scanned by the sweeper
+  nmethod*      scanned_nmethod() const          { return _scanned_nmethod; }
   void          set_scanned_nmethod(nmethod* nm) {
     assert(_scanned_nmethod == NULL || nm == NULL, "should reset to NULL before writing a new value");
     _scanned_nmethod = nm;
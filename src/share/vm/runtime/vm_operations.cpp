@@ -97,6 +97,10 @@ void VM_ThreadStop::doit() {
   }
 }
 
+void VM_CompactCodeCache::doit() {
+  NMethodSweeper::compact_code_cache();
+}
+
 void VM_Deoptimize::doit() {
   // We do not want any GCs to happen while we are in the middle of this VM operation
   ResourceMark rm;
@@ -50,6 +50,7 @@
   template(DeoptimizeFrame)                       \
   template(DeoptimizeAll)                         \
   template(ZombieAll)                             \
+  template(CompactCodeCache)                      \
   template(UnlinkSymbols)                         \
   template(Verify)                                \
   template(PrintJNI)                              \
@@ -249,6 +250,15 @@ class VM_Deoptimize: public VM_Operation {
 };
 
 
+// Moves live nmethods into free blocks lower in the code cache,
+// see NMethodSweeper::compact_code_cache().
+class VM_CompactCodeCache: public VM_Operation {
+ public:
+  VM_CompactCodeCache() {}
+  VMOp_Type type() const                         { return VMOp_CompactCodeCache; }
+  void doit();
+};
+
 // Deopt helper that can deoptimize frames in threads other than the
 // current thread.  Only used through Deoptimization::deoptimize_frame.
 class VM_DeoptimizeFrame: public VM_Operation {
@@ -441,4 +441,22 @@ public:
   }
 };
 
+class SafepointTraceDCmd : public DCmd {
+public:
+  SafepointTraceDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() { return "VM.safepoints"; }
+  static const char* description() {
+    return "Print the time to safepoint of the most recent safepoints and "
+           "the thread that reached each of them last.";
+  }
+  static const char* impact() { return "Low"; }
+  virtual void execute(DCmdSource source, TRAPS);
+  static int num_arguments() { return 0; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+};
+
 #endif // SHARE_VM_SERVICES_DIAGNOSTICCOMMAND_HPP
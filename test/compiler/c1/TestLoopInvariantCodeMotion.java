@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary C1 loop invariant code motion must not move loads across stores to
+ *          the same field or across calls, but may move invariant arithmetic
+ *          out of loops that contain calls
+ *
+ * @run main/othervm -XX:TieredStopAtLevel=1 -Xbatch -XX:-BackgroundCompilation
+ *                   -XX:CompileCommand=dontinline,TestLoopInvariantCodeMotion::bump
+ *                   TestLoopInvariantCodeMotion
+ * @run main/othervm -XX:TieredStopAtLevel=1 -Xbatch -XX:-BackgroundCompilation
+ *                   -XX:-UseLoopInvariantCodeMotion TestLoopInvariantCodeMotion
+ */
+
+public class TestLoopInvariantCodeMotion {
+    int a;
+    int b;
+    long c;
+    static int calls;
+
+    void bump() {
+        a++;
+        calls++;
+    }
+
+    // b is stored in the loop, a is not: only the load of a may be hoisted
+    static int storeOtherField(TestLoopInvariantCodeMotion o, int n) {
+        int s = 0;
+        for (int i = 0; i < n; i++) {
+            s += o.a;
+            o.b = s + o.b;
+        }
+        return s;
+    }
+
+    // the call stores to a: the load must stay in the loop
+    static int callInLoop(TestLoopInvariantCodeMotion o, int n, int x) {
+        int s = 0;
+        for (int i = 0; i < n; i++) {
+            s += o.a + (x * 31 + 7);
+            o.bump();
+        }
+        return s;
+    }
+
+    // a store to a long field does not alias the int fields
+    static long mixedTypes(TestLoopInvariantCodeMotion o, int n, int x) {
+        long s = 0;
+        for (int i = 0; i < n; i++) {
+            s += o.a + (long) -x;
+            o.c = s;
+            o.a = i;
+        }
+        return s;
+    }
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < 20000; iter++) {
+            int n = iter % 17;
+
+            TestLoopInvariantCodeMotion o = new TestLoopInvariantCodeMotion();
+            o.a = 3;
+            o.b = 1;
+            int s = storeOtherField(o, n);
+            int eb = 1;
+            for (int i = 0; i < n; i++) {
+                eb = 3 * (i + 1) + eb;
+            }
+            if (s != 3 * n || o.b != eb) {
+                throw new RuntimeException("storeOtherField: " + s + " " + o.b);
+            }
+
+            o.a = 5;
+            calls = 0;
+            s = callInLoop(o, n, iter);
+            int expected = 0;
+            for (int i = 0; i < n; i++) {
+                expected += 5 + i + (iter * 31 + 7);
+            }
+            if (s != expected || calls != n) {
+                throw new RuntimeException("callInLoop: " + s + " != " + expected);
+            }
+
+            o.a = 7;
+            long l = mixedTypes(o, n, iter);
+            long el = 0;
+            int a = 7;
+            for (int i = 0; i < n; i++) {
+                el += a + (long) -iter;
+                a = i;
+            }
+            if (l != el || o.c != (n > 0 ? el : 0)) {
+                throw new RuntimeException("mixedTypes: " + l + " != " + el);
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Coarsen StringBuffer locks separated by a branch which merges again
+ * @run main/othervm -Xbatch -XX:+CoarsenLocksThroughBranches TestLockCoarseningThroughBranches
+ * @run main/othervm -Xbatch -XX:-CoarsenLocksThroughBranches TestLockCoarseningThroughBranches
+ */
+public class TestLockCoarseningThroughBranches {
+    static final int THREADS = 4;
+    static final int ITERATIONS = 100_000;
+    static volatile boolean lockLeaked;
+
+    static void append(StringBuffer sb, int i) {
+        sb.append('a');
+        sb.append((i & 1) == 0 ? 'b' : 'c');
+        sb.append(i > 0 ? 'd' : 'e');
+    }
+
+    public static void main(String[] args) throws Exception {
+        final StringBuffer sb = new StringBuffer();
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread() {
+                public void run() {
+                    for (int i = 0; i < ITERATIONS; i++) {
+                        append(sb, i);
+                        if (Thread.holdsLock(sb)) {
+                            lockLeaked = true;
+                        }
+                    }
+                }
+            };
+        }
+        for (Thread t : threads) {
+            t.start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (lockLeaked) {
+            throw new RuntimeException("TEST FAILED: lock still held after append");
+        }
+        if (sb.length() != THREADS * ITERATIONS * 3) {
+            throw new RuntimeException("TEST FAILED: lost appends, length " + sb.length());
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary C2 replaces switch cases never taken according to the profile with uncommon traps
+ * @library /testlibrary /testlibrary/whitebox
+ * @build TestSwitchProfiling
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+IgnoreUnrecognizedVMOptions -XX:-TieredCompilation -Xbatch
+ *                   -XX:-UseOnStackReplacement -XX:+UseSwitchProfiling TestSwitchProfiling
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+IgnoreUnrecognizedVMOptions -XX:-TieredCompilation -Xbatch
+ *                   -XX:-UseOnStackReplacement -XX:-UseSwitchProfiling TestSwitchProfiling
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+IgnoreUnrecognizedVMOptions -XX:+TieredCompilation -Xbatch
+ *                   -XX:-UseOnStackReplacement -XX:+UseSwitchProfiling TestSwitchProfiling
+ */
+
+import java.lang.reflect.Method;
+
+import com.oracle.java.testlibrary.Platform;
+import sun.hotspot.WhiteBox;
+
+public class TestSwitchProfiling {
+    private static final WhiteBox WHITE_BOX = WhiteBox.getWhiteBox();
+    private static final int COMP_LEVEL_FULL_OPTIMIZATION = 4;
+
+    static int table(int key) {
+        switch (key) {
+            case 0:  return hot(key);
+            case 1:  return cold(key) + 1;
+            case 2:  return hot(key) + 2;
+            case 3:  return cold(key) + 3;
+            case 4:  return cold(key) + 4;
+            case 5:  return hot(key) + 5;
+            case 6:  return cold(key) + 6;
+            case 7:  return cold(key) + 7;
+            default: return -1;
+        }
+    }
+
+    static int lookup(int key) {
+        switch (key) {
+            case 1000:    return cold(key);
+            case -7:      return hot(key) + 1;
+            case 42:      return cold(key) + 2;
+            case 1 << 20: return hot(key) + 3;
+            case 99:      return cold(key) + 4;
+            default:      return -1;
+        }
+    }
+
+    static int hot(int x)  { return x * 3; }
+    static int cold(int x) { return x * 5; }
+
+    static int expectedTable(int key) {
+        if (key < 0 || key > 7) {
+            return -1;
+        }
+        boolean isHot = (key == 0 || key == 2 || key == 5);
+        return (isHot ? hot(key) : cold(key)) + key;
+    }
+
+    static int expectedLookup(int key) {
+        switch (key) {
+            case 1000:    return key * 5;
+            case -7:      return key * 3 + 1;
+            case 42:      return key * 5 + 2;
+            case 1 << 20: return key * 3 + 3;
+            case 99:      return key * 5 + 4;
+            default:      return -1;
+        }
+    }
+
+    static void check(String what, int key, int result, int expected) {
+        if (result != expected) {
+            throw new RuntimeException(what + "(" + key + ") = " + result + ", expected " + expected);
+        }
+    }
+
+    // Makes sure m is compiled by C2.  Usually the warm up already did it.
+    static void compile(Method m) {
+        if (WHITE_BOX.getMethodCompilationLevel(m) != COMP_LEVEL_FULL_OPTIMIZATION) {
+            WHITE_BOX.enqueueMethodForCompilation(m, COMP_LEVEL_FULL_OPTIMIZATION);
+        }
+        if (WHITE_BOX.getMethodCompilationLevel(m) != COMP_LEVEL_FULL_OPTIMIZATION) {
+            throw new RuntimeException(m + " should be compiled by C2");
+        }
+    }
+
+    // A never taken case deoptimizes m only if C2 pruned it.
+    static void checkCompiled(Method m, boolean pruned, int key) {
+        if (WHITE_BOX.isMethodCompiled(m) == pruned) {
+            throw new RuntimeException(m + " should" + (pruned ? " not" : "")
+                                       + " be compiled after taking key " + key);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method tableMethod  = TestSwitchProfiling.class.getDeclaredMethod("table", int.class);
+        Method lookupMethod = TestSwitchProfiling.class.getDeclaredMethod("lookup", int.class);
+
+        // Resolve the call to cold() so that only the pruned cases can trap.
+        cold(0);
+
+        // Only ever take the hot cases, so that the other cases and the
+        // default are profiled as never taken when the methods compile.
+        int[] hotTableKeys  = { 0, 2, 5 };
+        int[] hotLookupKeys = { -7, 1 << 20 };
+        for (int i = 0; i < 20_000; i++) {
+            int t = hotTableKeys[i % hotTableKeys.length];
+            check("table", t, table(t), expectedTable(t));
+            int l = hotLookupKeys[i % hotLookupKeys.length];
+            check("lookup", l, lookup(l), expectedLookup(l));
+        }
+
+        // Tier 3 code doesn't profile switches, so C2 only prunes them
+        // without tiered compilation.
+        if (Platform.isServer()) {
+            boolean pruned = WHITE_BOX.getBooleanVMFlag("UseSwitchProfiling")
+                             && !WHITE_BOX.getBooleanVMFlag("TieredCompilation");
+            compile(tableMethod);
+            compile(lookupMethod);
+
+            // A never taken case, and a key that goes to the never taken default.
+            check("table", 3, table(3), expectedTable(3));
+            checkCompiled(tableMethod, pruned, 3);
+            check("lookup", 0, lookup(0), expectedLookup(0));
+            checkCompiled(lookupMethod, pruned, 0);
+        }
+
+        // Now take every case, including the pruned ones.
+        for (int round = 0; round < 3; round++) {
+            for (int key = -2; key < 10; key++) {
+                check("table", key, table(key), expectedTable(key));
+            }
+            int[] lookupKeys = { 1000, -7, 42, 1 << 20, 99, 0, 43, Integer.MIN_VALUE, Integer.MAX_VALUE };
+            for (int key : lookupKeys) {
+                check("lookup", key, lookup(key), expectedLookup(key));
+            }
+        }
+    }
+}
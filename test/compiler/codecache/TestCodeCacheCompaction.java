@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestCodeCacheCompaction
+ * @summary Sweep the code cache with several compiler threads and compact it
+ *          while classes with compiled methods are loaded and unloaded
+ * @library /testlibrary
+ * @run main TestCodeCacheCompaction
+ */
+import java.io.ByteArrayOutputStream;
+import java.io.InputStream;
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.ProcessTools;
+
+public class TestCodeCacheCompaction {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+CodeCacheCompaction",
+            "-XX:CodeCacheCompactionThreshold=1",
+            "-XX:NmethodSweepParallelism=4",
+            "-XX:CICompilerCount=4",
+            "-XX:ReservedCodeCacheSize=16m",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintMethodFlushingStatistics",
+            "-Xmx128m",
+            Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("kept methods correct after compaction");
+        // The statistics are printed whether or not anything was moved
+        Matcher m = Pattern.compile("Total number of moved methods: +(\\d+)").matcher(output.getOutput());
+        if (!m.find()) {
+            throw new RuntimeException("No compaction statistics printed");
+        }
+        int moved = Integer.parseInt(m.group(1));
+        System.out.println("Moved methods: " + moved);
+        if (moved <= 0) {
+            throw new RuntimeException("The code cache was never compacted");
+        }
+
+        // Invalid values are rejected
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:CodeCacheCompactionThreshold=0",
+            "-version");
+        output = new OutputAnalyzer(pb.start());
+        output.shouldContain("CodeCacheCompactionThreshold");
+        output.shouldHaveExitValue(1);
+    }
+
+    public static class Hot {
+        public static int run(int n) {
+            int sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += (i % 7 == 0) ? i : (sum ^ i);
+            }
+            return sum;
+        }
+    }
+
+    // Same as Hot.run, for the expected results
+    static int expected(int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += (i % 7 == 0) ? i : (sum ^ i);
+        }
+        return sum;
+    }
+
+    static void check(Method run, int n) throws Exception {
+        int result = (Integer) run.invoke(null, n);
+        if (result != expected(n)) {
+            throw new RuntimeException("run(" + n + ") = " + result + ", expected " + expected(n));
+        }
+    }
+
+    // Defines a fresh copy of Hot for every instance
+    static class HotLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        HotLoader(byte[] bytes) {
+            super(null);
+            this.bytes = bytes;
+        }
+
+        protected Class<?> findClass(String name) throws ClassNotFoundException {
+            if (name.equals(Hot.class.getName())) {
+                return defineClass(name, bytes, 0, bytes.length);
+            }
+            throw new ClassNotFoundException(name);
+        }
+    }
+
+    public static class Workload {
+        public static void main(String[] args) throws Exception {
+            String resource = Hot.class.getName().replace('.', '/') + ".class";
+            byte[] bytes;
+            try (InputStream in = Hot.class.getClassLoader().getResourceAsStream(resource)) {
+                ByteArrayOutputStream out = new ByteArrayOutputStream();
+                byte[] buf = new byte[4096];
+                for (int n; (n = in.read(buf)) > 0; ) {
+                    out.write(buf, 0, n);
+                }
+                bytes = out.toByteArray();
+            }
+
+            // Every tenth copy stays loaded: its code survives the sweeps
+            // and is what compaction moves into the holes left by the rest.
+            List<Method> kept = new ArrayList<Method>();
+            for (int i = 0; i < 2000; i++) {
+                Class<?> c = new HotLoader(bytes).loadClass(Hot.class.getName());
+                Method run = c.getMethod("run", int.class);
+                for (int j = 0; j < 200; j++) {
+                    check(run, 1000 + j % 3);
+                }
+                if (i % 10 == 0) {
+                    kept.add(run);
+                }
+                if (i % 100 == 0) {
+                    // Unload the classes so that their code is swept
+                    System.gc();
+                    for (Method k : kept) {
+                        check(k, 1000);
+                    }
+                }
+            }
+            for (Method k : kept) {
+                for (int j = 0; j < 100; j++) {
+                    check(k, 1000 + j % 3);
+                }
+            }
+            System.out.println("kept methods correct after compaction");
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Tests C2 EA with allocations merged by a Phi and with
+ *          allocations escaping only on a rarely taken path.
+ * @library /testlibrary
+ * @run main TestAllocationMerges eliminate
+ * @run main/othervm -Xbatch -XX:CompileCommand=compileonly,TestAllocationMerges::test*
+ *                   TestAllocationMerges
+ * @run main/othervm -Xbatch -XX:CompileCommand=compileonly,TestAllocationMerges::test*
+ *                   -XX:-ReduceAllocationMerges -XX:-PartialEscapeAnalysis TestAllocationMerges
+ */
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.Platform;
+import com.oracle.java.testlibrary.ProcessTools;
+
+public class TestAllocationMerges {
+    static class Point {
+        int x;
+        int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+
+        int sum() {
+            return x + y;
+        }
+    }
+
+    static class Point3 extends Point {
+        int z;
+
+        Point3(int x, int y, int z) {
+            super(x, y);
+            this.z = z;
+        }
+
+        int sum() {
+            return x + y + z;
+        }
+    }
+
+    static Point escaped;
+
+    static int testMerge(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        return p.x * 31 + p.y;
+    }
+
+    static int testMergeSubclass(int i, int a, int b) {
+        Point p;
+        if ((i & 1) == 0) {
+            p = new Point(a, b);
+        } else {
+            p = new Point3(a, b, i);
+        }
+        return p.sum();
+    }
+
+    static int testRareEscape(int i, int a) {
+        Point p = new Point(a, i);
+        if (i == 12345) {
+            escaped = p;
+        }
+        return p.x + p.y;
+    }
+
+    static void rareEscape() {
+        for (int i = 0; i < 200_000; i++) {
+            // Take the rare path once every 2000 calls: often enough that
+            // it is seen before the compilation, so it is not a never
+            // taken branch, but below PartialEscapeRareBranchRatio.
+            int v = (i % 2000) == 1000 ? 12345 : i;
+            check(testRareEscape(v, 7), v + 7);
+        }
+    }
+
+    // Compile only testRareEscape and report the allocations EA removed:
+    // with the rare path trapped, the Point is scalar replaced on the hot
+    // path; without it, the Point escapes and stays.
+    static void checkEliminated(boolean partialEscape) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:-TieredCompilation",
+                "-Xbatch",
+                "-XX:CompileCommand=compileonly,TestAllocationMerges::testRareEscape",
+                "-XX:+PrintEliminateAllocations",
+                partialEscape ? "-XX:+PartialEscapeAnalysis" : "-XX:-PartialEscapeAnalysis",
+                "TestAllocationMerges", "rareEscape");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        if (partialEscape) {
+            output.shouldMatch("\\+\\+\\+\\+ Eliminated: \\d+ Allocate$");
+        } else {
+            output.shouldNotContain("++++ Eliminated");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length == 1 && args[0].equals("rareEscape")) {
+            rareEscape();
+            return;
+        }
+        if (args.length == 1 && args[0].equals("eliminate")) {
+            // PrintEliminateAllocations is only available in debug builds.
+            if (Platform.isDebugBuild()) {
+                checkEliminated(true);
+                checkEliminated(false);
+            }
+            return;
+        }
+        for (int i = 0; i < 200_000; i++) {
+            boolean cond = (i & 1) == 0;
+            int expected = cond ? i * 31 + (i + 1) : (i + 1) * 31 + i;
+            check(testMerge(cond, i, i + 1), expected);
+
+            expected = i + (i + 2) + (((i & 1) == 0) ? 0 : i);
+            check(testMergeSubclass(i, i, i + 2), expected);
+
+            check(testRareEscape(i, 7), i + 7);
+            if (i == 12345 && (escaped == null || escaped.x != 7 || escaped.y != i)) {
+                throw new RuntimeException("TEST FAILED: rare path lost the escaping object");
+            }
+        }
+        // Take the rare path from compiled code.
+        escaped = null;
+        check(testRareEscape(12345, 7), 12345 + 7);
+        if (escaped == null || escaped.x != 7 || escaped.y != 12345) {
+            throw new RuntimeException("TEST FAILED: rare path lost the escaping object");
+        }
+    }
+
+    static void check(int value, int expected) {
+        if (value != expected) {
+            throw new RuntimeException("TEST FAILED: " + value + " != " + expected);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary C2 inlines hot call chains past MaxInlineLevel while the inlining budget lasts
+ * @library /testlibrary
+ * @run main/othervm TestHotCallSiteInlining
+ */
+import com.oracle.java.testlibrary.*;
+
+public class TestHotCallSiteInlining {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer analyzer = run("-XX:+InlineFrequencyBudget");
+        // The test is applicable only to C2 (present in Server VM).
+        if (analyzer.getStderr().contains("Server VM")) {
+            analyzer.shouldContain("TestHotCallSiteInlining$Launcher::m11 (7 bytes)   hot call site, deep inlining");
+            analyzer.shouldNotContain("TestHotCallSiteInlining$Launcher::m11 (7 bytes)   inlining too deep");
+        }
+
+        analyzer = run("-XX:-InlineFrequencyBudget");
+        if (analyzer.getStderr().contains("Server VM")) {
+            analyzer.shouldContain("TestHotCallSiteInlining$Launcher::m11 (7 bytes)   inlining too deep");
+            analyzer.shouldNotContain("hot call site, deep inlining");
+        }
+    }
+
+    private static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-XX:+IgnoreUnrecognizedVMOptions", "-showversion",
+                "-server", "-XX:-TieredCompilation", "-Xbatch",
+                "-XX:MaxInlineLevel=9", "-XX:InlineHotCallSiteExtraLevel=2",
+                "-XX:+PrintCompilation", "-XX:+UnlockDiagnosticVMOptions", "-XX:+PrintInlining",
+                flag,
+                "TestHotCallSiteInlining$Launcher");
+        OutputAnalyzer analyzer = new OutputAnalyzer(pb.start());
+        analyzer.shouldHaveExitValue(0);
+        return analyzer;
+    }
+
+    static class Launcher {
+        static int m1(int x)  { return m2(x) + 1; }
+        static int m2(int x)  { return m3(x) + 1; }
+        static int m3(int x)  { return m4(x) + 1; }
+        static int m4(int x)  { return m5(x) + 1; }
+        static int m5(int x)  { return m6(x) + 1; }
+        static int m6(int x)  { return m7(x) + 1; }
+        static int m7(int x)  { return m8(x) + 1; }
+        static int m8(int x)  { return m9(x) + 1; }
+        static int m9(int x)  { return m10(x) + 1; }
+        static int m10(int x) { return m11(x) + 1; }
+        static int m11(int x) { return m12(x) + 1; }
+        static int m12(int x) { return x + 1; }
+
+        static int test(int x) {
+            int sum = 0;
+            for (int i = 0; i < 10; i++) {
+                sum += m1(x + i);
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 20_000; i++) {
+                sum += test(i);
+            }
+            if (sum == 42) {
+                System.out.println(sum);
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+/**
+ * @test
+ * @summary C2 inlines all receivers of a call site with up to PolymorphicInliningLimit profiled types
+ * @library /testlibrary
+ * @run main/othervm TestPolymorphicInlining
+ */
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestPolymorphicInlining {
+    public static void main(String[] args) throws Exception {
+        checkInlined(run("-XX:+UsePolymorphicInlining",
+                         "-XX:TypeProfileWidth=4", "-XX:PolymorphicInliningLimit=4"));
+        // The ergonomic TypeProfileWidth must be wide enough on its own.
+        checkInlined(run("-XX:+UsePolymorphicInlining"));
+
+        OutputAnalyzer analyzer = run("-XX:-UsePolymorphicInlining");
+        if (analyzer.getStderr().contains("Server VM")) {
+            analyzer.shouldMatch("TestPolymorphicInlining\\$Base::value .*virtual call");
+        }
+    }
+
+    private static void checkInlined(OutputAnalyzer analyzer) {
+        // The test is applicable only to C2 (present in Server VM).
+        if (analyzer.getStderr().contains("Server VM")) {
+            for (int i = 1; i <= 4; i++) {
+                analyzer.shouldContain("TestPolymorphicInlining$C" + i + "::value (2 bytes)   inline (hot)");
+                analyzer.shouldMatch("TypeProfile \\(\\d+/\\d+ counts\\) = TestPolymorphicInlining\\$C" + i);
+            }
+            analyzer.shouldNotMatch("TestPolymorphicInlining\\$Base::value .*virtual call");
+        }
+    }
+
+    private static OutputAnalyzer run(String... flags) throws Exception {
+        List<String> options = new ArrayList<>(Arrays.asList(
+                "-XX:+IgnoreUnrecognizedVMOptions", "-showversion",
+                "-server", "-XX:-TieredCompilation", "-Xbatch",
+                "-XX:+PrintCompilation", "-XX:+UnlockDiagnosticVMOptions", "-XX:+PrintInlining",
+                "-XX:CompileCommand=dontinline,TestPolymorphicInlining$Launcher::test"));
+        options.addAll(Arrays.asList(flags));
+        options.add("TestPolymorphicInlining$Launcher");
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                options.toArray(new String[options.size()]));
+        OutputAnalyzer analyzer = new OutputAnalyzer(pb.start());
+        analyzer.shouldHaveExitValue(0);
+        return analyzer;
+    }
+
+    static abstract class Base { abstract int value(); }
+    static class C1 extends Base { int value() { return 1; } }
+    static class C2 extends Base { int value() { return 2; } }
+    static class C3 extends Base { int value() { return 3; } }
+    static class C4 extends Base { int value() { return 4; } }
+
+    static class Launcher {
+        static final Base[] RECEIVERS = { new C1(), new C2(), new C3(), new C4() };
+
+        static int test(Base b) {
+            return b.value();
+        }
+
+        static int loop() {
+            int sum = 0;
+            for (int i = 0; i < RECEIVERS.length; i++) {
+                sum += test(RECEIVERS[i]);
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 20_000; i++) {
+                sum += loop();
+            }
+            if (sum != 20_000 * 10) {
+                throw new RuntimeException("wrong sum: " + sum);
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Arrays.equals on primitive arrays must agree with an element-wise loop
+ *
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:+UseVectorizedMismatchIntrinsic TestArraysEqualsMismatch
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:TieredStopAtLevel=1 -XX:+UseVectorizedMismatchIntrinsic TestArraysEqualsMismatch
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-UseVectorizedMismatchIntrinsic TestArraysEqualsMismatch
+ */
+
+import java.util.Arrays;
+
+public class TestArraysEqualsMismatch {
+    static final int MAX_LEN = 300;
+
+    static boolean equalsB(byte[] a, byte[] b)       { return Arrays.equals(a, b); }
+    static boolean equalsZ(boolean[] a, boolean[] b) { return Arrays.equals(a, b); }
+    static boolean equalsS(short[] a, short[] b)     { return Arrays.equals(a, b); }
+    static boolean equalsI(int[] a, int[] b)         { return Arrays.equals(a, b); }
+    static boolean equalsJ(long[] a, long[] b)       { return Arrays.equals(a, b); }
+
+    static void check(boolean expected, boolean actual, String what, int len, int pos) {
+        if (expected != actual) {
+            throw new RuntimeException(what + " len=" + len + " pos=" + pos +
+                                       ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < 20; iter++) {
+            for (int len = 0; len < MAX_LEN; len++) {
+                byte[] b1 = new byte[len];
+                boolean[] z1 = new boolean[len];
+                short[] s1 = new short[len];
+                int[] i1 = new int[len];
+                long[] j1 = new long[len];
+                for (int i = 0; i < len; i++) {
+                    b1[i] = (byte)(i * 7);
+                    z1[i] = (i & 1) != 0;
+                    s1[i] = (short)(i * 31);
+                    i1[i] = i * 131;
+                    j1[i] = i * 0x100000001L;
+                }
+                byte[] b2 = b1.clone();
+                boolean[] z2 = z1.clone();
+                short[] s2 = s1.clone();
+                int[] i2 = i1.clone();
+                long[] j2 = j1.clone();
+
+                check(true, equalsB(b1, b2), "byte[]", len, -1);
+                check(true, equalsZ(z1, z2), "boolean[]", len, -1);
+                check(true, equalsS(s1, s2), "short[]", len, -1);
+                check(true, equalsI(i1, i2), "int[]", len, -1);
+                check(true, equalsJ(j1, j2), "long[]", len, -1);
+
+                // Flip the top bit of one element at a time.
+                for (int pos = 0; pos < len; pos += (iter == 0 ? 1 : 13)) {
+                    b2[pos] ^= (byte)0x80;
+                    z2[pos] = !z2[pos];
+                    s2[pos] ^= (short)0x8000;
+                    i2[pos] ^= 0x80000000;
+                    j2[pos] ^= 0x8000000000000000L;
+                    check(false, equalsB(b1, b2), "byte[]", len, pos);
+                    check(false, equalsZ(z1, z2), "boolean[]", len, pos);
+                    check(false, equalsS(s1, s2), "short[]", len, pos);
+                    check(false, equalsI(i1, i2), "int[]", len, pos);
+                    check(false, equalsJ(j1, j2), "long[]", len, pos);
+                    b2[pos] ^= (byte)0x80;
+                    z2[pos] = !z2[pos];
+                    s2[pos] ^= (short)0x8000;
+                    i2[pos] ^= 0x80000000;
+                    j2[pos] ^= 0x8000000000000000L;
+                }
+
+                check(true,  equalsB(b1, b1), "byte[] same", len, -1);
+                check(false, equalsB(b1, null), "byte[] null", len, -1);
+                check(false, equalsB(null, b1), "byte[] null", len, -1);
+                check(true,  equalsB(null, null), "byte[] null", len, -1);
+                check(false, equalsI(i1, new int[len + 1]), "int[] length", len, -1);
+            }
+        }
+    }
+}
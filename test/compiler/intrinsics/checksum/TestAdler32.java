@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Adler32 intrinsics must match a plain Java implementation
+ *
+ * @run main/othervm/timeout=600 -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:+UseAdler32Intrinsics TestAdler32
+ * @run main/othervm/timeout=600 -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:TieredStopAtLevel=1 -XX:+UseAdler32Intrinsics TestAdler32
+ * @run main/othervm/timeout=600 -Xint -XX:+IgnoreUnrecognizedVMOptions -XX:+UseAdler32Intrinsics TestAdler32
+ * @run main/othervm/timeout=600 -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-UseAdler32Intrinsics TestAdler32
+ */
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.Adler32;
+
+public class TestAdler32 {
+    static final int BASE = 65521;
+    static final int MAX_LEN = 12000;
+
+    static int reference(int adler, byte[] b, int off, int len) {
+        int s1 = adler & 0xffff;
+        int s2 = adler >>> 16;
+        for (int i = off; i < off + len; i++) {
+            s1 = (s1 + (b[i] & 0xff)) % BASE;
+            s2 = (s2 + s1) % BASE;
+        }
+        return (s2 << 16) | s1;
+    }
+
+    static long array(byte[] b, int off, int len) {
+        Adler32 a = new Adler32();
+        a.update(b, off, len);
+        return a.getValue();
+    }
+
+    static long buffer(ByteBuffer buf) {
+        Adler32 a = new Adler32();
+        a.update(buf);
+        return a.getValue();
+    }
+
+    public static void main(String[] args) {
+        Random rnd = new Random(42);
+        byte[] data = new byte[MAX_LEN + 64];
+        rnd.nextBytes(data);
+        byte[] ones = new byte[MAX_LEN + 64];
+        java.util.Arrays.fill(ones, (byte)0xff);
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        ByteBuffer directOnes = ByteBuffer.allocateDirect(ones.length);
+        direct.put(data);
+        directOnes.put(ones);
+
+        for (int iter = 0; iter < 3; iter++) {
+            for (int len = 0; len < MAX_LEN; len += (len < 300 ? 1 : 97)) {
+                int off = len % 37;
+                check(data, direct, off, len);
+                check(ones, directOnes, off, len);
+            }
+        }
+    }
+
+    static void check(byte[] b, ByteBuffer direct, int off, int len) {
+        long expected = reference(1, b, off, len) & 0xffffffffL;
+        long got = array(b, off, len);
+        if (got != expected) {
+            throw new RuntimeException("byte[] off " + off + " len " + len + ": " + got + " != " + expected);
+        }
+        direct.limit(off + len).position(off);
+        got = buffer(direct);
+        if (got != expected) {
+            throw new RuntimeException("direct buffer off " + off + " len " + len + ": " + got + " != " + expected);
+        }
+    }
+}
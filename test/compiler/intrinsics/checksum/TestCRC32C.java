@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary CRC32C intrinsics must match a plain Java implementation
+ * @build TestCRC32C java.util.zip.CRC32C
+ * @run main ClassFileInstaller java.util.zip.CRC32C
+ *
+ * @run main/othervm/timeout=600 -Xbootclasspath/a:. -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:+UseCRC32CIntrinsics TestCRC32C
+ * @run main/othervm/timeout=600 -Xbootclasspath/a:. -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-TieredCompilation -XX:+UseCRC32CIntrinsics TestCRC32C
+ * @run main/othervm/timeout=600 -Xbootclasspath/a:. -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:TieredStopAtLevel=1 -XX:+UseCRC32CIntrinsics TestCRC32C
+ * @run main/othervm/timeout=600 -Xbootclasspath/a:. -Xint -XX:+IgnoreUnrecognizedVMOptions -XX:+UseCRC32CIntrinsics TestCRC32C
+ * @run main/othervm/timeout=600 -Xbootclasspath/a:. -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-UseCRC32CIntrinsics TestCRC32C
+ */
+
+import java.nio.ByteBuffer;
+import java.util.Random;
+import java.util.zip.CRC32C;
+
+public class TestCRC32C {
+    static final int MAX_LEN = 12000;
+    // The stub interleaves three streams over blocks of 3 x 1024 and
+    // 3 x 128 bytes, then goes on 8 and 1 byte at a time.
+    static final int[] BOUNDARIES = { 8, 3 * 128, 3 * 1024, 3 * 1024 + 3 * 128,
+                                      2 * 3 * 1024, 3 * 3 * 1024 };
+
+    // Bitwise CRC32C, independent of the table in CRC32C.
+    static int reference(int crc, byte[] b, int off, int len) {
+        crc = ~crc;
+        for (int i = off; i < off + len; i++) {
+            crc ^= b[i] & 0xff;
+            for (int k = 0; k < 8; k++) {
+                crc = (crc & 1) != 0 ? (crc >>> 1) ^ 0x82F63B78 : crc >>> 1;
+            }
+        }
+        return ~crc;
+    }
+
+    static long array(byte[] b, int off, int len) {
+        CRC32C c = new CRC32C();
+        c.update(b, off, len);
+        return c.getValue();
+    }
+
+    // Same bytes in two updates, so the CRC is carried across the split.
+    static long split(byte[] b, int off, int len, int first) {
+        CRC32C c = new CRC32C();
+        c.update(b, off, first);
+        c.update(b, off + first, len - first);
+        return c.getValue();
+    }
+
+    static long buffer(ByteBuffer buf) {
+        CRC32C c = new CRC32C();
+        c.update(buf);
+        return c.getValue();
+    }
+
+    public static void main(String[] args) {
+        byte[] check = "123456789".getBytes();
+        if (array(check, 0, check.length) != 0xE3069283L) {
+            throw new RuntimeException("wrong CRC32C of \"123456789\": "
+                                       + Long.toHexString(array(check, 0, check.length)));
+        }
+
+        Random rnd = new Random(42);
+        byte[] data = new byte[MAX_LEN + 64];
+        rnd.nextBytes(data);
+        byte[] ones = new byte[MAX_LEN + 64];
+        java.util.Arrays.fill(ones, (byte)0xff);
+        ByteBuffer direct = ByteBuffer.allocateDirect(data.length);
+        ByteBuffer directOnes = ByteBuffer.allocateDirect(ones.length);
+        direct.put(data);
+        directOnes.put(ones);
+
+        // Get the update methods compiled before the real checks.
+        for (int i = 0; i < 20_000; i++) {
+            check(data, direct, i % 16, i % 48);
+        }
+
+        for (int iter = 0; iter < 3; iter++) {
+            for (int len = 0; len < MAX_LEN; len += (len < 400 ? 1 : 97)) {
+                int off = len % 37;
+                check(data, direct, off, len);
+                check(ones, directOnes, off, len);
+            }
+            for (int boundary : BOUNDARIES) {
+                for (int len = Math.max(boundary - 9, 0); len <= boundary + 9; len++) {
+                    for (int off = 0; off < 9; off++) {
+                        check(data, direct, off, len);
+                    }
+                    checkSplit(data, len, boundary / 2);
+                    checkSplit(data, len, len - 1);
+                }
+            }
+        }
+    }
+
+    static void check(byte[] b, ByteBuffer direct, int off, int len) {
+        long expected = reference(0, b, off, len) & 0xffffffffL;
+        long got = array(b, off, len);
+        if (got != expected) {
+            throw new RuntimeException("byte[] off " + off + " len " + len + ": " + got + " != " + expected);
+        }
+        direct.limit(off + len).position(off);
+        got = buffer(direct);
+        if (got != expected) {
+            throw new RuntimeException("direct buffer off " + off + " len " + len + ": " + got + " != " + expected);
+        }
+    }
+
+    static void checkSplit(byte[] b, int len, int first) {
+        if (first < 0 || first > len) {
+            return;
+        }
+        long expected = reference(0, b, 0, len) & 0xffffffffL;
+        long got = split(b, 0, len, first);
+        if (got != expected) {
+            throw new RuntimeException("split len " + len + " at " + first + ": " + got + " != " + expected);
+        }
+    }
+}
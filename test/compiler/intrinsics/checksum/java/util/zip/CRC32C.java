@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package java.util.zip;
+
+import java.nio.ByteBuffer;
+import sun.misc.Unsafe;
+import sun.nio.ch.DirectBuffer;
+
+/**
+ * Stand-in for the java.util.zip.CRC32C of later JDKs, which the VM's
+ * CRC32C intrinsics are keyed to.  It has to be put on the boot class
+ * path.  updateBytes and updateDirectByteBuffer are the intrinsified
+ * methods; their plain Java bodies are only run when the intrinsics are
+ * off.
+ */
+public final class CRC32C implements Checksum {
+    private static final int CRC32C_POLY = 0x82F63B78;  // bit-reflected
+    private static final int[] TABLE = new int[256];
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+
+    static {
+        for (int n = 0; n < 256; n++) {
+            int c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) != 0 ? (c >>> 1) ^ CRC32C_POLY : c >>> 1;
+            }
+            TABLE[n] = c;
+        }
+    }
+
+    private int crc = 0xFFFFFFFF;
+
+    public CRC32C() {
+    }
+
+    @Override
+    public void update(int b) {
+        crc = (crc >>> 8) ^ TABLE[(crc ^ b) & 0xFF];
+    }
+
+    @Override
+    public void update(byte[] b, int off, int len) {
+        if (b == null) {
+            throw new NullPointerException();
+        }
+        if (off < 0 || len < 0 || off > b.length - len) {
+            throw new ArrayIndexOutOfBoundsException();
+        }
+        crc = updateBytes(crc, b, off, off + len);
+    }
+
+    public void update(ByteBuffer buffer) {
+        int pos = buffer.position();
+        int limit = buffer.limit();
+        int rem = limit - pos;
+        if (rem <= 0) {
+            return;
+        }
+        if (buffer.isDirect()) {
+            crc = updateDirectByteBuffer(crc, ((DirectBuffer)buffer).address(), pos, limit);
+        } else if (buffer.hasArray()) {
+            crc = updateBytes(crc, buffer.array(), pos + buffer.arrayOffset(),
+                              limit + buffer.arrayOffset());
+        } else {
+            byte[] b = new byte[rem];
+            buffer.get(b);
+            crc = updateBytes(crc, b, 0, rem);
+        }
+        buffer.position(limit);
+    }
+
+    @Override
+    public void reset() {
+        crc = 0xFFFFFFFF;
+    }
+
+    @Override
+    public long getValue() {
+        return (~crc) & 0xFFFFFFFFL;
+    }
+
+    private static int updateBytes(int crc, byte[] b, int off, int end) {
+        for (int i = off; i < end; i++) {
+            crc = (crc >>> 8) ^ TABLE[(crc ^ b[i]) & 0xFF];
+        }
+        return crc;
+    }
+
+    private static int updateDirectByteBuffer(int crc, long address, int off, int end) {
+        for (long a = address + off; a < address + end; a++) {
+            crc = (crc >>> 8) ^ TABLE[(crc ^ UNSAFE.getByte(a)) & 0xFF];
+        }
+        return crc;
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Loops applying Math.exp, log or log10 to double arrays are replaced
+ *          by the array stubs and give the same results as the scalar code in
+ *          the interpreter
+ * @library /testlibrary
+ * @run main TestArrayMath
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-TieredCompilation -XX:-OptimizeMathLoops
+ *                   -XX:CompileCommand=exclude,TestArrayMath::reference* TestArrayMath check
+ */
+
+import java.util.Random;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.Platform;
+import com.oracle.java.testlibrary.ProcessTools;
+
+public class TestArrayMath {
+    static void exp(double[] src, double[] dst, int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = Math.exp(src[i]);
+        }
+    }
+
+    static void log(double[] src, double[] dst, int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = Math.log(src[i]);
+        }
+    }
+
+    static void log10(double[] src, double[] dst, int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = Math.log10(src[i]);
+        }
+    }
+
+    static void expInPlace(double[] a) {
+        for (int i = 0; i < a.length; i++) {
+            a[i] = Math.exp(a[i]);
+        }
+    }
+
+    // Loop carried: each element is computed from the previous result.
+    static void logChain(double[] a) {
+        for (int i = 0; i < a.length - 1; i++) {
+            a[i + 1] = Math.log(a[i]);
+        }
+    }
+
+    static void referenceExp(double[] src, double[] dst, int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = Math.exp(src[i]);
+        }
+    }
+
+    static void referenceLog(double[] src, double[] dst, int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = Math.log(src[i]);
+        }
+    }
+
+    static void referenceLog10(double[] src, double[] dst, int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = Math.log10(src[i]);
+        }
+    }
+
+    static void referenceLogChain(double[] a) {
+        for (int i = 0; i < a.length - 1; i++) {
+            a[i + 1] = Math.log(a[i]);
+        }
+    }
+
+    static final double[] SPECIAL = {
+        Double.NaN, Double.POSITIVE_INFINITY, Double.NEGATIVE_INFINITY, 0.0, -0.0,
+        1.0, -1.0, Double.MIN_VALUE, Double.MIN_NORMAL, Double.MAX_VALUE,
+        708.0, -708.0, 709.7, -745.0, 1e-300, 1.0 + 0x1p-40, 10.0, 1000.0
+    };
+
+    static double[] input(Random r, int len) {
+        double[] a = new double[len];
+        for (int i = 0; i < len; i++) {
+            if (r.nextInt(8) == 0) {
+                a[i] = SPECIAL[r.nextInt(SPECIAL.length)];
+            } else if (r.nextBoolean()) {
+                a[i] = (r.nextDouble() - 0.5) * 1440.0;
+            } else {
+                a[i] = Math.pow(2.0, (r.nextDouble() - 0.5) * 2000.0) * (1.0 + r.nextDouble());
+            }
+        }
+        return a;
+    }
+
+    static void check(String what, double[] expected, double[] actual) {
+        for (int i = 0; i < expected.length; i++) {
+            if (Double.doubleToRawLongBits(expected[i]) != Double.doubleToRawLongBits(actual[i])) {
+                throw new RuntimeException(what + ": element " + i + " is " + actual[i] +
+                                           ", expected " + expected[i]);
+            }
+        }
+    }
+
+    static void check() {
+        Random r = new Random(17);
+        for (int iter = 0; iter < 3000; iter++) {
+            int len = r.nextInt(70);
+            int from = len == 0 ? 0 : r.nextInt(Math.min(len, 3) + 1);
+            int to = len - (len == 0 ? 0 : r.nextInt(Math.min(len - from, 3) + 1));
+            double[] src = input(r, len);
+
+            double[] expected = new double[len];
+            double[] actual = new double[len];
+            referenceExp(src, expected, from, to);
+            exp(src, actual, from, to);
+            check("exp", expected, actual);
+
+            expected = new double[len];
+            actual = new double[len];
+            referenceLog(src, expected, from, to);
+            log(src, actual, from, to);
+            check("log", expected, actual);
+
+            expected = new double[len];
+            actual = new double[len];
+            referenceLog10(src, expected, from, to);
+            log10(src, actual, from, to);
+            check("log10", expected, actual);
+
+            expected = src.clone();
+            actual = src.clone();
+            referenceExp(expected, expected, 0, len);
+            expInPlace(actual);
+            check("exp in place", expected, actual);
+
+            expected = src.clone();
+            actual = src.clone();
+            if (len > 0) {
+                expected[0] = actual[0] = 1e300;
+            }
+            referenceLogChain(expected);
+            logChain(actual);
+            check("log chain", expected, actual);
+        }
+    }
+
+    // Run the checks with each loop compiled on its own and the replaced
+    // loops reported, and make sure the loops were actually replaced.
+    static void checkReplaced(String... flags) throws Exception {
+        String[] common = {
+            "-XX:+IgnoreUnrecognizedVMOptions",
+            "-XX:-TieredCompilation",
+            "-Xbatch",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintIntrinsics",
+            "-XX:CompileCommand=exclude,TestArrayMath::reference*",
+            "-XX:CompileCommand=dontinline,TestArrayMath::*",
+        };
+        String[] vmArgs = new String[common.length + flags.length + 2];
+        System.arraycopy(common, 0, vmArgs, 0, common.length);
+        System.arraycopy(flags, 0, vmArgs, common.length, flags.length);
+        vmArgs[vmArgs.length - 2] = "TestArrayMath";
+        vmArgs[vmArgs.length - 1] = "check";
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(vmArgs);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("^ArrayMath dexp_array in TestArrayMath::exp$");
+        output.shouldMatch("^ArrayMath dexp_array in TestArrayMath::expInPlace$");
+        output.shouldMatch("^ArrayMath dlog_array in TestArrayMath::log$");
+        output.shouldMatch("^ArrayMath dlog10_array in TestArrayMath::log10$");
+        // The loop carried log must stay a loop.
+        output.shouldNotContain("TestArrayMath::logChain");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length == 1 && args[0].equals("check")) {
+            check();
+        } else if (Platform.isX64()) {
+            // The array stubs are only generated on x86_64.
+            checkReplaced("-XX:LoopStripMiningIter=0");
+            checkReplaced("-XX:LoopStripMiningIter=1000");
+        } else {
+            check();
+        }
+    }
+}
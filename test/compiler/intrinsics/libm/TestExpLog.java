@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Math.exp, Math.log and Math.log10 meet their specification and give
+ *          the same results in the interpreter and in compiled code
+ *
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:+UseLibmIntrinsic TestExpLog
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:TieredStopAtLevel=1 -XX:+UseLibmIntrinsic TestExpLog
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-TieredCompilation -XX:+UseLibmIntrinsic TestExpLog
+ * @run main/othervm -Xbatch -XX:+IgnoreUnrecognizedVMOptions -XX:-UseLibmIntrinsic TestExpLog
+ */
+
+import java.util.Random;
+
+public class TestExpLog {
+    static final int N = 4096;
+    static final int ITERS = 40;
+
+    static double exp(double x)   { return Math.exp(x); }
+    static double log(double x)   { return Math.log(x); }
+    static double log10(double x) { return Math.log10(x); }
+
+    static void check(boolean ok, String what, double x, double got, double expected) {
+        if (!ok) {
+            throw new RuntimeException(what + "(" + x + ") = " + got + ", expected " + expected);
+        }
+    }
+
+    static void checkSame(String what, double x, double got, double expected) {
+        check(Double.doubleToRawLongBits(got) == Double.doubleToRawLongBits(expected),
+              what, x, got, expected);
+    }
+
+    // Both results are within 1 ulp of the exact value.
+    static void checkClose(String what, double x, double got, double expected) {
+        check(Math.abs(got - expected) <= 2 * Math.ulp(expected), what, x, got, expected);
+    }
+
+    static void checkSpecialValues() {
+        checkSame("exp", Double.NaN, exp(Double.NaN), Double.NaN);
+        checkSame("exp", Double.POSITIVE_INFINITY, exp(Double.POSITIVE_INFINITY), Double.POSITIVE_INFINITY);
+        checkSame("exp", Double.NEGATIVE_INFINITY, exp(Double.NEGATIVE_INFINITY), 0.0);
+        checkSame("exp", 0.0, exp(0.0), 1.0);
+        checkSame("exp", -0.0, exp(-0.0), 1.0);
+        checkSame("exp", 710.0, exp(710.0), Double.POSITIVE_INFINITY);
+        checkSame("exp", -746.0, exp(-746.0), 0.0);
+        checkClose("exp", 709.5, exp(709.5), StrictMath.exp(709.5));
+        checkClose("exp", -740.0, exp(-740.0), StrictMath.exp(-740.0));
+
+        for (double x : new double[] { Double.NaN, -1.0, Double.NEGATIVE_INFINITY }) {
+            checkSame("log", x, log(x), Double.NaN);
+            checkSame("log10", x, log10(x), Double.NaN);
+        }
+        for (double x : new double[] { 0.0, -0.0 }) {
+            checkSame("log", x, log(x), Double.NEGATIVE_INFINITY);
+            checkSame("log10", x, log10(x), Double.NEGATIVE_INFINITY);
+        }
+        checkSame("log", Double.POSITIVE_INFINITY, log(Double.POSITIVE_INFINITY), Double.POSITIVE_INFINITY);
+        checkSame("log10", Double.POSITIVE_INFINITY, log10(Double.POSITIVE_INFINITY), Double.POSITIVE_INFINITY);
+        checkSame("log", 1.0, log(1.0), 0.0);
+        checkSame("log10", 1.0, log10(1.0), 0.0);
+        checkClose("log", Double.MIN_VALUE, log(Double.MIN_VALUE), StrictMath.log(Double.MIN_VALUE));
+        checkClose("log", Double.MAX_VALUE, log(Double.MAX_VALUE), StrictMath.log(Double.MAX_VALUE));
+
+        // log10(10^n) == n
+        double p = 1.0;
+        for (int n = 0; n <= 22; n++, p *= 10.0) {
+            checkSame("log10", p, log10(p), n);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        double[] xs = new double[N];
+        double[] ys = new double[N];
+        for (int i = 0; i < N; i++) {
+            xs[i] = (r.nextDouble() - 0.5) * 1500.0;
+            ys[i] = Math.pow(2.0, (r.nextDouble() - 0.5) * 2000.0) * (1.0 + r.nextDouble());
+        }
+        xs[0] = 1e-300;
+        ys[0] = 1.0 + 0x1p-30;
+        ys[1] = Math.nextDown(2.0);
+
+        // The first pass runs in the interpreter.
+        double[] e0 = new double[N];
+        double[] l0 = new double[N];
+        double[] t0 = new double[N];
+        for (int i = 0; i < N; i++) {
+            e0[i] = exp(xs[i]);
+            l0[i] = log(ys[i]);
+            t0[i] = log10(ys[i]);
+            checkClose("exp", xs[i], e0[i], StrictMath.exp(xs[i]));
+            checkClose("log", ys[i], l0[i], StrictMath.log(ys[i]));
+            checkClose("log10", ys[i], t0[i], StrictMath.log10(ys[i]));
+        }
+
+        for (int iter = 0; iter < ITERS; iter++) {
+            checkSpecialValues();
+            for (int i = 0; i < N; i++) {
+                checkSame("exp", xs[i], exp(xs[i]), e0[i]);
+                checkSame("log", ys[i], log(ys[i]), l0[i]);
+                checkSame("log10", ys[i], log10(ys[i]), t0[i]);
+            }
+        }
+
+        // Semi-monotonicity across adjacent arguments.
+        double x = -3.0;
+        double prev = exp(x);
+        for (int i = 0; i < 100000; i++) {
+            x = Math.nextUp(x);
+            double cur = exp(x);
+            check(cur >= prev, "exp", x, cur, prev);
+            prev = cur;
+        }
+        double y = 0.75;
+        double prevLog = log(y);
+        for (int i = 0; i < 100000; i++) {
+            y = Math.nextUp(y);
+            double cur = log(y);
+            check(cur >= prevLog, "log", y, cur, prevLog);
+            prevLog = cur;
+        }
+    }
+}
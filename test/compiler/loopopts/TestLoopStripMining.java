@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Strip mined counted loops poll for safepoints and compute the same results
+ * @library /testlibrary
+ * @run main TestLoopStripMining
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:+IgnoreUnrecognizedVMOptions
+ *                   -XX:LoopStripMiningIter=7 TestLoopStripMining check
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:+IgnoreUnrecognizedVMOptions
+ *                   -XX:LoopStripMiningIter=0 TestLoopStripMining check
+ */
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicLong;
+import com.oracle.java.testlibrary.ProcessTools;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+
+public class TestLoopStripMining {
+    private static final AtomicLong _num = new AtomicLong(0);
+
+    static long sumUp(int[] a, int from, int to) {
+        long sum = 0;
+        for (int i = from; i < to; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static long sumDown(int[] a, int from, int to) {
+        long sum = 0;
+        for (int i = to - 1; i >= from; i--) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static long sumStride3(int[] a) {
+        long sum = 0;
+        for (int i = 0; i <= a.length - 3; i += 3) {
+            sum += a[i] + a[i + 2];
+        }
+        return sum;
+    }
+
+    static int countToMax(int from) {
+        int count = 0;
+        for (int i = from; i < Integer.MAX_VALUE; i++) {
+            count++;
+        }
+        return count;
+    }
+
+    static void fill(int[] a, int v) {
+        for (int i = 0; i < a.length; i++) {
+            a[i] = v + i;
+        }
+    }
+
+    static void check() {
+        int[] a = new int[10007];
+        for (int iter = 0; iter < 2000; iter++) {
+            fill(a, iter);
+            long expected = 0;
+            for (int i = 0; i < a.length; i++) {
+                expected += a[i];
+            }
+            check("sumUp", sumUp(a, 0, a.length), expected);
+            check("sumDown", sumDown(a, 0, a.length), expected);
+            check("sumUp partial", sumUp(a, 13, 5013), sumDown(a, 13, 5013));
+            long expected3 = 0;
+            for (int i = 0; i <= a.length - 3; i += 3) {
+                expected3 += a[i] + a[i + 2];
+            }
+            check("sumStride3", sumStride3(a), expected3);
+            check("countToMax", countToMax(Integer.MAX_VALUE - 3001 - iter), 3001 + iter);
+        }
+    }
+
+    static int spin(int n) {
+        int x = 0;
+        for (int i = 0; i < n; i++) {
+            x = x * 31 + i;
+        }
+        return x;
+    }
+
+    // A GC requested by another thread while spin() runs its loop in
+    // compiled code must be able to complete before the loop does.
+    static void gcWhileLooping() throws Exception {
+        for (int i = 0; i < 20_000; i++) {
+            spin(1000);
+        }
+        final CountDownLatch looping = new CountDownLatch(1);
+        final long[] gcDone = new long[1];
+        Thread gc = new Thread() {
+            public void run() {
+                try {
+                    looping.await();
+                    Thread.sleep(100);
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+                System.gc();
+                gcDone[0] = System.nanoTime();
+            }
+        };
+        gc.start();
+        looping.countDown();
+        int x = spin(Integer.MAX_VALUE);
+        long loopDone = System.nanoTime();
+        gc.join();
+        System.out.println("spin: " + x + ", GC completed " +
+                           (loopDone - gcDone[0]) / 1_000_000 + " ms before the loop");
+        if (gcDone[0] >= loopDone) {
+            throw new RuntimeException("GC only completed after the loop, the loop did not poll for safepoints");
+        }
+    }
+
+    static void check(String what, long actual, long expected) {
+        if (actual != expected) {
+            throw new RuntimeException(what + ": " + actual + " != " + expected);
+        }
+    }
+
+    // Uses the fact that an EnableBiasedLocking vmop will be started
+    // after 500ms, while we are still in the loop. With the safepoint
+    // kept in the outer strip mined loop we reach the safepoint quickly,
+    // otherwise SafepointTimeout will be hit.
+    public static void main(String args[]) throws Exception {
+        if (args.length == 1 && args[0].equals("check")) {
+            check();
+        } else if (args.length == 1 && args[0].equals("gc")) {
+            gcWhileLooping();
+        } else if (args.length == 1) {
+            final int loops = Integer.parseInt(args[0]);
+            for (int i = 0; i < loops; i++) {
+                _num.addAndGet(1);
+            }
+        } else {
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                    "-XX:+IgnoreUnrecognizedVMOptions",
+                    "-XX:-TieredCompilation",
+                    "-XX:+UseBiasedLocking",
+                    "-XX:BiasedLockingStartupDelay=500",
+                    "-XX:+SafepointTimeout",
+                    "-XX:SafepointTimeoutDelay=2000",
+                    "-XX:-UseCountedLoopSafepoints",
+                    "-XX:LoopStripMiningIter=1000",
+                    "TestLoopStripMining",
+                    "2000000000"
+                    );
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldNotContain("Timeout detected");
+            output.shouldHaveExitValue(0);
+
+            pb = ProcessTools.createJavaProcessBuilder(
+                    "-XX:+IgnoreUnrecognizedVMOptions",
+                    "-XX:-TieredCompilation",
+                    "-Xbatch",
+                    "-XX:-UseCountedLoopSafepoints",
+                    "-XX:LoopStripMiningIter=1000",
+                    "TestLoopStripMining",
+                    "gc"
+                    );
+            output = new OutputAnalyzer(pb.start());
+            output.shouldContain("before the loop");
+            output.shouldHaveExitValue(0);
+        }
+    }
+}
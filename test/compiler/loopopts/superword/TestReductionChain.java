@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary An unrolled reduction longer than a vector must be vectorized in every pack of the chain
+ * @library /testlibrary
+ * @run main compiler.loopopts.superword.TestReductionChain
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestReductionChain {
+    private static final Pattern ADD_REDUCTION = Pattern.compile("! add reduction4I");
+
+    public static void main(String[] args) throws Exception {
+        // PrintOptoAssembly is only available in debug builds.
+        if (!Platform.isDebugBuild() || !(Platform.isX86() || Platform.isX64())) {
+            System.out.println("Test needs a debug x86 VM, skipped");
+            return;
+        }
+
+        // With 4 ints per vector, the 16 links of the unrolled loop form
+        // 4 packs, each folded by its own reduction node.
+        OutputAnalyzer output = run("-XX:+SuperWordReductions");
+        if (output.getStdout().contains("Server VM") || output.getStderr().contains("Server VM")) {
+            Asserts.assertGTE(count(output.getStdout()), 2,
+                    "every pack of the reduction chain should be vectorized");
+        }
+
+        output = run("-XX:-SuperWordReductions");
+        Asserts.assertEQ(count(output.getStdout()), 0,
+                "no reduction should be vectorized with -XX:-SuperWordReductions");
+    }
+
+    private static int count(String out) {
+        int n = 0;
+        Matcher m = ADD_REDUCTION.matcher(out);
+        while (m.find()) {
+            n++;
+        }
+        return n;
+    }
+
+    private static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-showversion", "-server", "-XX:-TieredCompilation", "-Xbatch",
+                "-XX:+IgnoreUnrecognizedVMOptions",
+                "-XX:MaxVectorSize=16", "-XX:LoopMaxUnroll=16", "-XX:LoopUnrollLimit=250",
+                "-XX:+PrintOptoAssembly",
+                "-XX:CompileCommand=compileonly,compiler.loopopts.superword.TestReductionChain$Launcher::sumI",
+                flag,
+                Launcher.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Launcher {
+        static int sumI(int[] a) {
+            int sum = 0;
+            for (int i = 0; i < a.length; i++) {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[1024];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i;
+            }
+            for (int i = 0; i < 20_000; i++) {
+                if (sumI(a) != 1023 * 1024 / 2) {
+                    throw new RuntimeException("wrong sum");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Vectorized reductions must produce the same result as the scalar loop
+ * @run main/othervm -XX:-TieredCompilation -XX:+SuperWordReductions compiler.loopopts.superword.TestReductions
+ * @run main/othervm -XX:-TieredCompilation -XX:-SuperWordReductions compiler.loopopts.superword.TestReductions
+ */
+
+package compiler.loopopts.superword;
+
+public class TestReductions {
+    static final int SIZE = 1024;
+    static final int ITERS = 20000;
+
+    static int sumI(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static int mulI(int[] a) {
+        int prod = 1;
+        for (int i = 0; i < a.length; i++) {
+            prod *= a[i];
+        }
+        return prod;
+    }
+
+    static int minI(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = Math.min(min, a[i]);
+        }
+        return min;
+    }
+
+    static int maxI(int[] a) {
+        int max = Integer.MIN_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            max = Math.max(max, a[i]);
+        }
+        return max;
+    }
+
+    static long sumL(long[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static float sumF(float[] a) {
+        float sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static double sumD(double[] a) {
+        double sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static double dotD(double[] a, double[] b) {
+        double sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i] * b[i];
+        }
+        return sum;
+    }
+
+    static void check(String name, Object expected, Object actual) {
+        if (!expected.equals(actual)) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] ia = new int[SIZE];
+        long[] la = new long[SIZE];
+        float[] fa = new float[SIZE];
+        double[] da = new double[SIZE];
+        double[] db = new double[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            ia[i] = (i * 7919) % 1013 - 500;
+            la[i] = ia[i] * 0x100000001L;
+            // Mix magnitudes so that reassociation would change the result.
+            fa[i] = (i % 3 == 0) ? 1.0e8f / (i + 1) : 1.0f / (i + 3);
+            da[i] = (i % 5 == 0) ? 1.0e16 / (i + 1) : 1.0 / (i + 7);
+            db[i] = 1.0 / (i + 1);
+        }
+
+        // The first call runs in the interpreter and provides the reference.
+        int sI = sumI(ia), pI = mulI(ia), mnI = minI(ia), mxI = maxI(ia);
+        long sL = sumL(la);
+        float sF = sumF(fa);
+        double sD = sumD(da), dD = dotD(da, db);
+
+        for (int i = 0; i < ITERS; i++) {
+            check("sumI", sI, sumI(ia));
+            check("mulI", pI, mulI(ia));
+            check("minI", mnI, minI(ia));
+            check("maxI", mxI, maxI(ia));
+            check("sumL", sL, sumL(la));
+            check("sumF", sF, sumF(fa));
+            check("sumD", sD, sumD(da));
+            check("dotD", dD, dotD(da, db));
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Short array loops with a vector drain loop must compute the same results as scalar loops
+ * @run main/othervm -XX:-TieredCompilation -XX:+VectorizedPostLoops -XX:-AlignVector compiler.loopopts.superword.TestVectorDrainLoop
+ * @run main/othervm -XX:-TieredCompilation -XX:+VectorizedPostLoops compiler.loopopts.superword.TestVectorDrainLoop
+ * @run main/othervm -XX:-TieredCompilation -XX:-VectorizedPostLoops compiler.loopopts.superword.TestVectorDrainLoop
+ */
+
+package compiler.loopopts.superword;
+
+public class TestVectorDrainLoop {
+    static final int MAX_LEN = 64;
+    static final int ITERS = 20000;
+
+    static void addI(int[] a, int[] b, int[] c, int len) {
+        for (int i = 0; i < len; i++) {
+            c[i] = a[i] + b[i];
+        }
+    }
+
+    static void mulD(double[] a, double[] b, double[] c, int len) {
+        for (int i = 0; i < len; i++) {
+            c[i] = a[i] * b[i];
+        }
+    }
+
+    static void copyB(byte[] a, byte[] c, int from, int len) {
+        for (int i = from; i < len; i++) {
+            c[i] = (byte)(a[i] + 1);
+        }
+    }
+
+    static int sumI(int[] a, int len) {
+        int sum = 0;
+        for (int i = 0; i < len; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        int[] ia = new int[MAX_LEN];
+        int[] ib = new int[MAX_LEN];
+        int[] ic = new int[MAX_LEN];
+        double[] da = new double[MAX_LEN];
+        double[] db = new double[MAX_LEN];
+        double[] dc = new double[MAX_LEN];
+        byte[] ba = new byte[MAX_LEN];
+        byte[] bc = new byte[MAX_LEN];
+        for (int i = 0; i < MAX_LEN; i++) {
+            ia[i] = i * 7 - 100;
+            ib[i] = i * 3 + 11;
+            da[i] = i * 0.5 - 3.0;
+            db[i] = i * 1.25 + 0.75;
+            ba[i] = (byte)(i * 5);
+        }
+
+        for (int iter = 0; iter < ITERS; iter++) {
+            int len = 10 + iter % (MAX_LEN - 9);
+            int from = iter % 3;
+            addI(ia, ib, ic, len);
+            mulD(da, db, dc, len);
+            java.util.Arrays.fill(bc, (byte)0);
+            copyB(ba, bc, from, len);
+            int sum = sumI(ia, len);
+
+            int expected = 0;
+            for (int i = 0; i < MAX_LEN; i++) {
+                if (i < len) {
+                    check(ic[i] == ia[i] + ib[i], "addI", len, i);
+                    check(dc[i] == da[i] * db[i], "mulD", len, i);
+                    expected += ia[i];
+                }
+                byte b = (i >= from && i < len) ? (byte)(ba[i] + 1) : 0;
+                check(bc[i] == b, "copyB", len, i);
+            }
+            check(sum == expected, "sumI", len, -1);
+        }
+    }
+
+    static void check(boolean ok, String name, int len, int i) {
+        if (!ok) {
+            throw new RuntimeException(name + " failed for length " + len + " at index " + i);
+        }
+    }
+}
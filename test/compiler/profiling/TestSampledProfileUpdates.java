@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Tier 3 code that samples its branch, call and type check profile
+ *          updates must compute the same results as code that profiles
+ *          every execution
+ *
+ * @run main/othervm -XX:+TieredCompilation -XX:TieredStopAtLevel=3 -Xbatch
+ *                   -XX:Tier3ProfileUpdateFreqLog=4 TestSampledProfileUpdates
+ * @run main/othervm -XX:+TieredCompilation -XX:TieredStopAtLevel=3 -Xbatch
+ *                   -XX:Tier3ProfileUpdateFreqLog=0 TestSampledProfileUpdates
+ */
+
+public class TestSampledProfileUpdates {
+    static abstract class Shape {
+        abstract int area();
+    }
+    static class Square extends Shape {
+        final int s;
+        Square(int s) { this.s = s; }
+        int area() { return s * s; }
+    }
+    static class Rect extends Shape {
+        final int w, h;
+        Rect(int w, int h) { this.w = w; this.h = h; }
+        int area() { return w * h; }
+    }
+    static class Tri extends Shape {
+        final int b, h;
+        Tri(int b, int h) { this.b = b; this.h = h; }
+        int area() { return b * h / 2; }
+    }
+
+    static int branches(int i, long l, Object o, Object p) {
+        int r = 0;
+        if (i < 7)       r += 1;
+        if (i >= 3)      r += 2;
+        if (i == 5)      r += 4;
+        if (l > 100L)    r += 8;
+        if (l != 0L)     r += 16;
+        if (o == p)      r += 32;
+        if (o != null)   r += 64;
+        return r;
+    }
+
+    static int calls(Shape[] shapes) {
+        int sum = 0;
+        for (int i = 0; i < shapes.length; i++) {
+            sum += shapes[i].area();
+        }
+        return sum;
+    }
+
+    static int typeChecks(Object[] objs, Shape[] dst) {
+        int r = 0;
+        for (int i = 0; i < objs.length; i++) {
+            Object o = objs[i];
+            if (o instanceof Rect) {
+                r += ((Rect)o).w;
+            }
+            if (o instanceof Shape) {
+                dst[i] = (Shape)o;
+                r++;
+            }
+        }
+        return r;
+    }
+
+    static int storeChecks(Object[] dst, Object[] src) {
+        int stored = 0;
+        for (int i = 0; i < src.length; i++) {
+            try {
+                dst[i] = src[i];
+                stored++;
+            } catch (ArrayStoreException e) {
+            }
+        }
+        return stored;
+    }
+
+    static int expectedBranches(int i, long l, Object o, Object p) {
+        return (i < 7 ? 1 : 0) + (i >= 3 ? 2 : 0) + (i == 5 ? 4 : 0) +
+               (l > 100L ? 8 : 0) + (l != 0L ? 16 : 0) +
+               (o == p ? 32 : 0) + (o != null ? 64 : 0);
+    }
+
+    public static void main(String[] args) {
+        Object a = new Object();
+        Object b = new Object();
+        Shape[] shapes = { new Square(3), new Rect(2, 5), new Tri(4, 3), new Square(1) };
+        Object[] objs = { new Rect(7, 1), "x", new Square(2), null, new Tri(2, 2), a };
+        Shape[] dst = new Shape[objs.length];
+        Object[] squares = new Square[3];
+        Object[] mixed = { new Square(1), new Rect(1, 1), new Square(2) };
+
+        for (int iter = 0; iter < 50_000; iter++) {
+            int i = iter % 11;
+            long l = (long)(iter % 301) - 50;
+            Object o = (iter & 1) == 0 ? a : ((iter & 2) == 0 ? b : null);
+            int r = branches(i, l, o, a);
+            int e = expectedBranches(i, l, o, a);
+            if (r != e) {
+                throw new RuntimeException("branches(" + i + ", " + l + "): " + r + " != " + e);
+            }
+            int area = calls(shapes);
+            if (area != 9 + 10 + 6 + 1) {
+                throw new RuntimeException("calls: " + area);
+            }
+            int t = typeChecks(objs, dst);
+            if (t != 7 + 3) {
+                throw new RuntimeException("typeChecks: " + t);
+            }
+            int s = storeChecks(squares, mixed);
+            if (s != 2) {
+                throw new RuntimeException("storeChecks: " + s);
+            }
+        }
+    }
+}
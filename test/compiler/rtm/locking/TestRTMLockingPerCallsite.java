@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/**
+ * @test
+ * @summary Verify that with RTMLockingPerCallsite only the lock site that
+ *          aborts too often loses RTM lock eliding after the deoptimization.
+ * @library /testlibrary /testlibrary/whitebox /compiler/testlibrary
+ * @build TestRTMLockingPerCallsite
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+WhiteBoxAPI TestRTMLockingPerCallsite
+ */
+
+import java.util.LinkedList;
+import java.util.List;
+import com.oracle.java.testlibrary.*;
+import com.oracle.java.testlibrary.cli.CommandLineOptionTest;
+import com.oracle.java.testlibrary.cli.predicate.AndPredicate;
+import rtm.*;
+import rtm.predicate.SupportedCPU;
+import rtm.predicate.SupportedVM;
+import sun.misc.Unsafe;
+
+/**
+ * Test verifies that after a deoptimization for a high abort ratio, the
+ * recompiled method keeps RTM lock eliding, and so RTM locking statistics,
+ * only for its lock sites that did not abort too often.  An overloaded
+ * method aborts at the same bci, which must not count for the other one.
+ */
+public class TestRTMLockingPerCallsite extends CommandLineOptionTest {
+    private TestRTMLockingPerCallsite() {
+        super(new AndPredicate(new SupportedCPU(), new SupportedVM()));
+    }
+
+    @Override
+    protected void runTestCases() throws Throwable {
+        verifyPerCallsite(true, false);
+        verifyPerCallsite(true, true);
+        verifyPerCallsite(false, false);
+    }
+
+    private void verifyPerCallsite(boolean perCallsite, boolean useStackLock)
+            throws Throwable {
+        CompilableTest test = new Test();
+
+        OutputAnalyzer outputAnalyzer = RTMTestBase.executeRTMTest(
+                test,
+                CommandLineOptionTest.prepareBooleanFlag("UseRTMForStackLocks",
+                        useStackLock),
+                CommandLineOptionTest.prepareBooleanFlag(
+                        "RTMLockingPerCallsite", perCallsite),
+                "-XX:+UseRTMDeopt",
+                "-XX:RTMRetryCount=0",
+                "-XX:RTMTotalCountIncrRate=1",
+                "-XX:RTMAbortThreshold=0",
+                CommandLineOptionTest.prepareNumericFlag("RTMLockingThreshold",
+                        10 * Test.TOTAL_ITERATIONS),
+                "-XX:RTMAbortRatio=50",
+                "-XX:+PrintPreciseRTMLockingStatistics",
+                test.getClass().getName(),
+                Boolean.toString(!useStackLock));
+
+        outputAnalyzer.shouldHaveExitValue(0);
+
+        List<RTMLockingStatistics> statistics = RTMLockingStatistics.fromString(
+                test.getMethodWithLockName(), outputAnalyzer.getOutput());
+        List<RTMLockingStatistics> boolLock = forMethod(statistics, "lock(Z)V");
+        List<RTMLockingStatistics> intLock = forMethod(statistics, "lock(I)V");
+
+        int firstSite = firstBci(boolLock);
+        Asserts.assertEQ(firstBci(intLock), firstSite, "Both overloads "
+                + "should have their first lock at the same bci.");
+
+        // The first compilation of each method profiles both of its lock
+        // sites.  After the deoptimization, only a site that kept RTM lock
+        // eliding gets statistics again.
+        int expected = perCallsite ? 2 : 1;
+        Asserts.assertEQ(count(boolLock, firstSite), expected,
+                "Unexpected statistics for the lock(Z)V lock that does "
+                + "not abort.");
+        Asserts.assertEQ(count(boolLock, -firstSite), 1,
+                "The lock(Z)V lock that aborts should lose RTM lock eliding.");
+        Asserts.assertEQ(count(intLock, firstSite), 1,
+                "The lock(I)V lock that aborts should lose RTM lock eliding.");
+        Asserts.assertEQ(count(intLock, -firstSite), expected,
+                "Unexpected statistics for the lock(I)V lock that does "
+                + "not abort.");
+    }
+
+    private static List<RTMLockingStatistics> forMethod(
+            List<RTMLockingStatistics> statistics, String nameAndSignature) {
+        List<RTMLockingStatistics> result = new LinkedList<>();
+        for (RTMLockingStatistics lock : statistics) {
+            if (lock.getLockName().contains("." + nameAndSignature + "@")) {
+                result.add(lock);
+            }
+        }
+        Asserts.assertFalse(result.isEmpty(), "VM output should contain "
+                + "RTM locking statistics for " + nameAndSignature);
+        return result;
+    }
+
+    private static int firstBci(List<RTMLockingStatistics> statistics) {
+        int bci = Integer.MAX_VALUE;
+        for (RTMLockingStatistics lock : statistics) {
+            bci = Math.min(bci, lock.getBci());
+        }
+        return bci;
+    }
+
+    /**
+     * Counts the statistics entries at {@code bci}, or at any other bci
+     * if {@code bci} is negated.
+     */
+    private static int count(List<RTMLockingStatistics> statistics, int bci) {
+        int count = 0;
+        for (RTMLockingStatistics lock : statistics) {
+            if (bci >= 0 ? lock.getBci() == bci : lock.getBci() != -bci) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Each method has two lock sites and forces aborts in one of them after
+     * {@code Test.WARMUP_ITERATIONS} are done: lock(boolean) in its second
+     * and lock(int) in its first.  Both first sites are at the same bci.
+     */
+    public static class Test implements CompilableTest {
+        private static final int TOTAL_ITERATIONS = 10000;
+        private static final int WARMUP_ITERATIONS = 1000;
+        private static final Unsafe UNSAFE = Utils.getUnsafe();
+        private final Object monitor = new Object();
+        // Following field have to be static in order to avoid escape analysis.
+        @SuppressWarnings("UnsuedDeclaration")
+        private static int field = 0;
+
+        @Override
+        public String getMethodWithLockName() {
+             return this.getClass().getName() + "::lock";
+         }
+
+        @Override
+        public String[] getMethodsToCompileNames() {
+            return new String[] { getMethodWithLockName() };
+        }
+
+        public void lock(boolean abort) {
+            synchronized(monitor) {
+                Test.field++;
+            }
+            synchronized(monitor) {
+                if (abort) {
+                    Test.UNSAFE.addressSize();
+                }
+            }
+        }
+
+        public void lock(int abort) {
+            synchronized(monitor) {
+                if (abort != 0) {
+                    Test.UNSAFE.addressSize();
+                }
+            }
+            synchronized(monitor) {
+                Test.field++;
+            }
+        }
+
+        /**
+         * Usage:
+         * Test &lt;inflate monitor&gt;
+         */
+        public static void main(String args[]) throws Throwable {
+            Asserts.assertGTE(args.length, 1, "One argument required.");
+            Test t = new Test();
+            boolean shouldBeInflated = Boolean.valueOf(args[0]);
+            if (shouldBeInflated) {
+                AbortProvoker.inflateMonitor(t.monitor);
+            }
+            for (int i = 0; i < Test.TOTAL_ITERATIONS; i++) {
+                AbortProvoker.verifyMonitorState(t.monitor, shouldBeInflated);
+                boolean abort = i >= Test.WARMUP_ITERATIONS;
+                t.lock(abort);
+                t.lock(abort ? 1 : 0);
+            }
+        }
+    }
+
+    public static void main(String args[]) throws Throwable {
+        new TestRTMLockingPerCallsite().test();
+    }
+}
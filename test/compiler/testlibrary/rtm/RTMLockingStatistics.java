@@ -36,7 +36,7 @@ import java.util.regex.Matcher;
  *
  * Example of locking statistics:
  *
- * java/lang/ClassLoader.loadClass@7
+ * java/lang/ClassLoader.loadClass(Ljava/lang/String;)Ljava/lang/Class;@7
  * # rtm locks total (estimated): 0
  * # rtm lock aborts  : 13
  * # rtm lock aborts 0: 12
@@ -173,7 +173,7 @@ public class RTMLockingStatistics {
     /**
      * Returns name of lock for which this statistics was collected.
      * Lock name has following format:
-     * &lt;class name&gt;.&lt;method name&gt;@&lt;bci&gt;
+     * &lt;class name&gt;.&lt;method name&gt;&lt;signature&gt;@&lt;bci&gt;
      *
      * @return name of lock.
      */
@@ -201,6 +201,10 @@ public class RTMLockingStatistics {
         aborts.put(type, count);
     }
 
+    public int getBci() {
+        return bci;
+    }
+
     public long getTotalLocks() {
         return totalLocks;
     }
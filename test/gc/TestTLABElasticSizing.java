@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestTLABElasticSizing
+ * @key gc
+ * @summary Check that TLABs sized from per-thread allocation rates give a
+ *          fast and a slow allocating thread different TLAB sizes with all
+ *          collectors, and that the TLAB waste histogram is printed.
+ * @library /testlibrary
+ */
+
+import java.util.HashSet;
+import java.util.Set;
+import java.util.concurrent.CyclicBarrier;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.oracle.java.testlibrary.*;
+
+public class TestTLABElasticSizing {
+
+    private static final Pattern GC_STATS =
+        Pattern.compile("TLAB: gc thread: \\S+ \\[id: *\\d+\\] desired_size: (\\d+)KB");
+
+    private static void run(String gcFlag, boolean elastic) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(gcFlag,
+                                                                  "-Xms32m",
+                                                                  "-Xmx32m",
+                                                                  "-Xmn16m",
+                                                                  "-XX:-UseAdaptiveSizePolicy",
+                                                                  "-XX:+UseTLAB",
+                                                                  "-XX:+ResizeTLAB",
+                                                                  "-XX:TLABSize=64k",
+                                                                  elastic ? "-XX:+TLABElasticSizing"
+                                                                          : "-XX:-TLABElasticSizing",
+                                                                  "-XX:+PrintTLAB",
+                                                                  Allocator.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("TLAB waste histogram");
+
+        // Desired sizes of the threads that allocated before the last gc,
+        // the fast and the slow allocator among them.
+        String stdout = output.getStdout();
+        int end = stdout.lastIndexOf("TLAB totals");
+        int begin = stdout.lastIndexOf("TLAB totals", end - 1);
+        Set<String> sizes = new HashSet<>();
+        Matcher m = GC_STATS.matcher(stdout.substring(begin + 1, end));
+        while (m.find()) {
+            sizes.add(m.group(1));
+        }
+        if (elastic) {
+            // Sized from their own allocation rates
+            Asserts.assertGTE(sizes.size(), 2,
+                    "fast and slow allocating threads should have different TLAB sizes: " + sizes);
+        } else {
+            // Eden is never half full at a gc, so no thread samples its
+            // allocation fraction and all keep the same TLABSize.
+            Asserts.assertEQ(sizes.size(), 1,
+                    "all threads should keep the same TLAB size: " + sizes);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (String gcFlag : new String[] { "-XX:+UseSerialGC", "-XX:+UseParallelGC", "-XX:+UseG1GC" }) {
+            run(gcFlag, true);
+            run(gcFlag, false);
+        }
+    }
+
+    static class Allocator {
+        private static final int ROUNDS = 10;
+        private static final int FAST_BYTES = 4 * 1024 * 1024;
+        private static final int SLOW_BYTES = 40 * 1024;
+
+        static volatile Object sink;
+
+        // Allocates bytes in small arrays in each round.  The rounds are
+        // separated by System.gc() calls, and each round fills less than
+        // half of eden, so no gc is triggered by allocation.
+        static class Worker extends Thread {
+            private final CyclicBarrier barrier;
+            private final int bytes;
+
+            Worker(CyclicBarrier barrier, int bytes) {
+                this.barrier = barrier;
+                this.bytes = bytes;
+            }
+
+            public void run() {
+                try {
+                    for (int round = 0; round < ROUNDS; round++) {
+                        barrier.await();
+                        for (int i = 0; i < bytes / 128; i++) {
+                            sink = new byte[128 - 16];
+                        }
+                        barrier.await();
+                    }
+                } catch (Exception e) {
+                    throw new RuntimeException(e);
+                }
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            CyclicBarrier barrier = new CyclicBarrier(3);
+            Worker fast = new Worker(barrier, FAST_BYTES);
+            Worker slow = new Worker(barrier, SLOW_BYTES);
+            fast.start();
+            slow.start();
+            for (int round = 0; round < ROUNDS; round++) {
+                barrier.await();
+                barrier.await();
+                System.gc();
+            }
+            fast.join();
+            slow.join();
+        }
+    }
+}
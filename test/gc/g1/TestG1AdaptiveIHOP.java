@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestG1AdaptiveIHOP
+ * @summary Check that G1 only uses the adaptive IHOP when requested, and that
+ *          an explicitly set InitiatingHeapOccupancyPercent stays a fixed threshold.
+ * @key gc
+ * @library /testlibrary
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestG1AdaptiveIHOP {
+
+    private static final String ADAPTIVE = "adaptive concurrent cycle initiation threshold";
+    private static final String UPDATE = "update concurrent cycle initiation threshold";
+
+    private static OutputAnalyzer run(String... flags) throws Exception {
+        String[] baseFlags = new String[] {
+            "-XX:+UseG1GC",
+            "-Xms64m",
+            "-Xmx64m",
+            "-XX:G1HeapRegionSize=1m",
+            "-XX:+PrintAdaptiveSizePolicy"
+        };
+        String[] allFlags = new String[baseFlags.length + flags.length + 1];
+        System.arraycopy(baseFlags, 0, allFlags, 0, baseFlags.length);
+        System.arraycopy(flags, 0, allFlags, baseFlags.length, flags.length);
+        allFlags[allFlags.length - 1] = OldGenAllocator.class.getName();
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(allFlags);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain(UPDATE);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        run().shouldContain(ADAPTIVE);
+        run("-XX:+G1UseAdaptiveIHOP").shouldContain(ADAPTIVE);
+        run("-XX:-G1UseAdaptiveIHOP").shouldNotContain(ADAPTIVE);
+        run("-XX:InitiatingHeapOccupancyPercent=30").shouldNotContain(ADAPTIVE);
+        run("-XX:InitiatingHeapOccupancyPercent=30", "-XX:+G1UseAdaptiveIHOP").shouldContain(ADAPTIVE);
+    }
+
+    static class OldGenAllocator {
+        private static final int CHUNK_SIZE = 16 * 1024;
+        private static final int RETAINED_CHUNKS = 1024; // 16 MB
+
+        public static void main(String[] args) {
+            // Keep replacing long-lived objects so that they get promoted
+            // and die in the old gen.
+            Object[] retained = new Object[RETAINED_CHUNKS];
+            for (int i = 0; i < 64 * RETAINED_CHUNKS; i++) {
+                retained[i % RETAINED_CHUNKS] = new byte[CHUNK_SIZE];
+            }
+        }
+    }
+}
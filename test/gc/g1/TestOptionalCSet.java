@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestOptionalCSet
+ * @summary Check that mixed GCs with a tight pause time goal evacuate optional
+ *          collection set regions correctly, and only when G1UseOptionalCSet is set.
+ * @key gc
+ * @library /testlibrary
+ */
+
+import com.oracle.java.testlibrary.*;
+
+public class TestOptionalCSet {
+
+    private static final String SELECT = "select optional regions";
+    private static final String ADD = "add optional regions to CSet";
+
+    private static OutputAnalyzer run(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UseG1GC",
+                                                                  "-Xms64m",
+                                                                  "-Xmx64m",
+                                                                  "-XX:G1HeapRegionSize=1m",
+                                                                  "-XX:MaxGCPauseMillis=1",
+                                                                  "-XX:InitiatingHeapOccupancyPercent=10",
+                                                                  "-XX:-G1UseAdaptiveIHOP",
+                                                                  "-XX:G1HeapWastePercent=0",
+                                                                  "-XX:+UnlockExperimentalVMOptions",
+                                                                  "-XX:G1MixedGCLiveThresholdPercent=100",
+                                                                  // Every mixed GC needs only one old region and
+                                                                  // has no region limit, so the 1 ms pause goal
+                                                                  // ends the old part of the CSet and leaves the
+                                                                  // next candidates to the optional part.
+                                                                  "-XX:G1MixedGCCountTarget=64",
+                                                                  "-XX:G1OldCSetRegionThresholdPercent=100",
+                                                                  "-XX:+UnlockDiagnosticVMOptions",
+                                                                  "-XX:+VerifyAfterGC",
+                                                                  "-XX:+PrintAdaptiveSizePolicy",
+                                                                  flag,
+                                                                  OldGenChurner.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run("-XX:+G1UseOptionalCSet");
+        output.shouldContain(SELECT);
+        output.shouldContain(ADD);
+
+        output = run("-XX:-G1UseOptionalCSet");
+        output.shouldNotContain(SELECT);
+        output.shouldNotContain(ADD);
+    }
+
+    static class OldGenChurner {
+        private static final int CHUNK_SIZE = 8 * 1024;
+        private static final int RETAINED_CHUNKS = 2048; // 16 MB
+
+        public static void main(String[] args) {
+            // Link the retained objects to each other so that evacuating
+            // an old region has to update references from other old regions.
+            Object[][] retained = new Object[RETAINED_CHUNKS][];
+            for (int i = 0; i < 32 * RETAINED_CHUNKS; i++) {
+                int index = i % RETAINED_CHUNKS;
+                Object[] chunk = new Object[CHUNK_SIZE / 8];
+                chunk[0] = retained[(index * 7 + 1) % RETAINED_CHUNKS];
+                retained[index] = chunk;
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestRemSetRebuild.java
+ * @summary Check that remembered sets of old regions rebuilt concurrently after
+ *          marking are complete when these regions are collected by mixed GCs.
+ * @key gc
+ * @requires vm.gc=="G1" | vm.gc=="null"
+ * @library /testlibrary /testlibrary/whitebox
+ * @build ClassFileInstaller com.oracle.java.testlibrary.* sun.hotspot.WhiteBox TestRemSetRebuild
+ * @run main ClassFileInstaller sun.hotspot.WhiteBox
+ *                              sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+WhiteBoxAPI -XX:+G1RebuildRemSets -Xmx32m -Xms32m -XX:G1HeapRegionSize=1m
+ *                   -XX:G1HeapWastePercent=0 -XX:G1MixedGCLiveThresholdPercent=100 -XX:MaxTenuringThreshold=1
+ *                   -XX:+VerifyBeforeGC -XX:+VerifyDuringGC -XX:+VerifyAfterGC -XX:+PrintGC
+ *                   TestRemSetRebuild
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+WhiteBoxAPI -XX:-G1RebuildRemSets -Xmx32m -Xms32m -XX:G1HeapRegionSize=1m
+ *                   -XX:G1HeapWastePercent=0 -XX:G1MixedGCLiveThresholdPercent=100 -XX:MaxTenuringThreshold=1
+ *                   -XX:+VerifyBeforeGC -XX:+VerifyDuringGC -XX:+VerifyAfterGC -XX:+PrintGC
+ *                   TestRemSetRebuild
+ */
+
+import sun.hotspot.WhiteBox;
+
+public class TestRemSetRebuild {
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int NODE_COUNT = 64 * 1024;
+
+    static class Node {
+        Node next;
+        int value;
+        byte[] payload = new byte[64];
+        Node(int value) { this.value = value; }
+    }
+
+    private static Node[] nodes = new Node[NODE_COUNT];
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < NODE_COUNT; i++) {
+            nodes[i] = new Node(i);
+        }
+        // Promote everything into old regions.
+        WB.youngGC();
+        WB.youngGC();
+
+        // Link nodes across regions, then drop every other one so that the
+        // old regions become candidates for mixed GCs.
+        for (int i = 0; i < NODE_COUNT; i += 2) {
+            nodes[i].next = nodes[(i + NODE_COUNT / 2 + 1) % NODE_COUNT];
+        }
+        for (int i = 1; i < NODE_COUNT; i += 2) {
+            nodes[i] = null;
+        }
+
+        for (int cycle = 0; cycle < 3; cycle++) {
+            if (!WB.g1StartConcMarkCycle()) {
+                throw new RuntimeException("Could not start concurrent cycle");
+            }
+            // Keep changing references while the remembered sets are rebuilt.
+            int round = 0;
+            while (WB.g1InConcurrentMark()) {
+                for (int i = 0; i < NODE_COUNT; i += 2) {
+                    nodes[i].next = nodes[(i + round * 2 + 2) % NODE_COUNT];
+                }
+                round++;
+            }
+            // Give mixed GCs a chance to run.
+            for (int i = 0; i < 8; i++) {
+                WB.youngGC();
+            }
+        }
+
+        for (int i = 0; i < NODE_COUNT; i += 2) {
+            Node n = nodes[i];
+            if (n.value != i || n.next == null || (n.next.value & 1) != 0) {
+                throw new RuntimeException("Corrupted node " + i);
+            }
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestParallelSafepointCleanup
+ * @summary Safepoint cleanup tasks run on the GC worker threads and are
+ *          reported by -XX:+PrintSafepointStatistics
+ * @library /testlibrary
+ * @run main TestParallelSafepointCleanup
+ */
+
+import com.oracle.java.testlibrary.ProcessTools;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+
+public class TestParallelSafepointCleanup {
+    static class Worker {
+        static final Object[] locks = new Object[1000];
+        static int count;
+
+        public static void main(String[] args) {
+            for (int i = 0; i < locks.length; i++) {
+                locks[i] = new Object();
+                synchronized (locks[i]) {
+                    count++;
+                }
+            }
+            for (int i = 0; i < 5; i++) {
+                System.gc();
+            }
+            System.out.println("count " + count);
+        }
+    }
+
+    static void test(String parallel, String gc) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            parallel, gc, "-XX:ParallelGCThreads=4",
+            "-XX:+PrintSafepointStatistics", "-XX:+TraceSafepointCleanupTime",
+            Worker.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("count 1000");
+        output.shouldContain("deflating idle monitors");
+        output.shouldContain("mark nmethods");
+        output.shouldContain("Safepoint cleanup task times:");
+    }
+
+    public static void main(String[] args) throws Exception {
+        test("-XX:+ParallelSafepointCleanup", "-XX:+UseG1GC");
+        test("-XX:+ParallelSafepointCleanup", "-XX:+UseConcMarkSweepGC");
+        test("-XX:+ParallelSafepointCleanup", "-XX:+UseParallelGC");
+        test("-XX:-ParallelSafepointCleanup", "-XX:+UseG1GC");
+    }
+}
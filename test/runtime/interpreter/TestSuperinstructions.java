@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary The interpreter's iload/iadd, iinc/goto and aload/getfield
+ *          superinstructions compute the same results as the plain bytecodes,
+ *          including branches into the middle of a rewritten sequence
+ *
+ * @run main/othervm -Xint TestSuperinstructions
+ * @run main/othervm -Xint -XX:-RewriteFrequentPairs TestSuperinstructions
+ * @run main/othervm -Xbatch -XX:CompileThreshold=100 TestSuperinstructions
+ */
+
+public class TestSuperinstructions {
+    // Only the explicit index iload is fused with iadd: locals 0 to 3 are
+    // loaded with iload_<n>, which keeps its plain template.  These use
+    // locals 0 to 3 and so must not be affected.
+    static int add(int a, int b) {
+        int c = a + b;
+        return c;
+    }
+
+    static int addMul(int a, int b, int c) {
+        int d = a * b + c;
+        return d;
+    }
+
+    // The p<n> parameters take locals 0 to 3, so the others are loaded
+    // with iload n and the fused forms are used.
+
+    // iload 4, iload 5, iadd: _fast_iload2_iadd
+    static int add2(int p0, int p1, int p2, int p3, int a, int b) {
+        int c = a + b;
+        return c;
+    }
+
+    // iload 5, iadd after a value already on the stack: _fast_iload_iadd
+    static int addMul2(int p0, int p1, int p2, int p3, int a, int b) {
+        int c = a * 3 + b;
+        return c;
+    }
+
+    // goto into the iload, iadd pair of the rewritten iload, iload, iadd
+    static int select(int p0, int p1, int p2, int p3, boolean f, int a, int b, int d) {
+        int r = (f ? a : b) + d;
+        return r;
+    }
+
+    // iinc, goto at the back branch
+    static int sum(int n) {
+        int s = 0;
+        for (int i = 0; i < n; i++) {
+            s += i;
+        }
+        return s;
+    }
+
+    // iinc with a negative constant, not followed by a goto
+    static int countDown(int n) {
+        int k = n;
+        k -= 3;
+        int s = 0;
+        while (k > 0) {
+            s += k;
+            k--;
+        }
+        return s;
+    }
+
+    static class Holder {
+        int i;
+        Object o;
+        float f;
+
+        Holder(int i) {
+            this.i = i;
+            this.o = Integer.valueOf(i);
+            this.f = i * 0.5f;
+        }
+    }
+
+    // aload 4, getfield: _fast_aload_[iaf]access
+    static int getI(int p0, int p1, int p2, int p3, Holder h) {
+        return h.i;
+    }
+
+    static Object getO(int p0, int p1, int p2, int p3, Holder h) {
+        return h.o;
+    }
+
+    static float getF(int p0, int p1, int p2, int p3, Holder h) {
+        return h.f;
+    }
+
+    // goto into the getfield of the rewritten aload 6, getfield
+    static int selectI(int p0, int p1, int p2, int p3, boolean f, Holder a, Holder b) {
+        return (f ? a : b).i;
+    }
+
+    // The null check of the fused getfield throws
+    static boolean getINull(int p0, int p1, int p2, int p3, Holder h) {
+        try {
+            getI(p0, p1, p2, p3, h);
+        } catch (NullPointerException e) {
+            return true;
+        }
+        return false;
+    }
+
+    static void check(String what, long actual, long expected) {
+        if (actual != expected) {
+            throw new RuntimeException(what + ": " + actual + " != " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        // Execute each method repeatedly so the rewritten forms are used.
+        int[] bounds = { Integer.MIN_VALUE, Integer.MIN_VALUE + 1, -1, 0, 1,
+                         Integer.MAX_VALUE - 1, Integer.MAX_VALUE };
+        for (int i = 0; i < 2000; i++) {
+            int a = i * 7919 - 100000;
+            int b = Integer.MAX_VALUE - i;
+            check("add", add(a, b), (int) ((long) a + b));
+            check("addMul", addMul(a, 3, b), (int) ((long) a * 3 + b));
+            check("add2", add2(0, 0, 0, 0, a, b), (int) ((long) a + b));
+            check("addMul2", addMul2(0, 0, 0, 0, a, b), (int) ((long) a * 3 + b));
+            check("select true", select(0, 0, 0, 0, true, a, b, i), a + i);
+            check("select false", select(0, 0, 0, 0, false, a, b, i), b + i);
+            // Wrap around at the ends of the int range
+            for (int x : bounds) {
+                for (int y : bounds) {
+                    check("add2 bounds", add2(1, 2, 3, 4, x, y), (int) ((long) x + y));
+                    check("addMul2 bounds", addMul2(1, 2, 3, 4, x, y), (int) ((long) x * 3 + y));
+                    check("select bounds", select(1, 2, 3, 4, (x & 1) == 0, x, i, y),
+                          (int) ((long) ((x & 1) == 0 ? x : i) + y));
+                }
+            }
+            Holder h = new Holder(a);
+            Holder g = new Holder(b);
+            check("getI", getI(0, 0, 0, 0, h), a);
+            check("getO", ((Integer) getO(0, 0, 0, 0, h)).intValue(), a);
+            check("getF", Float.floatToIntBits(getF(0, 0, 0, 0, h)),
+                  Float.floatToIntBits(a * 0.5f));
+            check("selectI true", selectI(0, 0, 0, 0, true, h, g), a);
+            check("selectI false", selectI(0, 0, 0, 0, false, h, g), b);
+            check("getI null", getINull(0, 0, 0, 0, (i & 1) == 0 ? null : h) ? 1 : 0,
+                  (i & 1) == 0 ? 1 : 0);
+            int n = i % 300;
+            check("sum", sum(n), n * (n - 1) / 2);
+            int k = Math.max(n - 3, 0);
+            check("countDown", countDown(n), k * (k + 1) / 2);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary invokedynamic instructions of one class that name the same
+ *          LambdaMetafactory constant are linked to one call site
+ *
+ * @run main/othervm -XX:+ShareLambdaCallSites TestSharedLambdaCallSites true
+ * @run main/othervm -XX:-ShareLambdaCallSites TestSharedLambdaCallSites false
+ */
+
+import java.util.function.Function;
+import java.util.function.IntSupplier;
+
+public class TestSharedLambdaCallSites {
+    // javac emits one CONSTANT_InvokeDynamic for both method references
+    static Function<String, Integer> first() {
+        return String::length;
+    }
+
+    static Function<String, Integer> second() {
+        return String::length;
+    }
+
+    // capturing lambdas with different bodies never share a call site
+    static IntSupplier capture(int x) {
+        return () -> x + 1;
+    }
+
+    static IntSupplier captureOther(int x) {
+        return () -> x + 2;
+    }
+
+    public static void main(String[] args) {
+        boolean shared = Boolean.parseBoolean(args[0]);
+
+        Function<String, Integer> f1 = first();
+        Function<String, Integer> f2 = second();
+        if (f1.apply("abc") != 3 || f2.apply("abcd") != 4) {
+            throw new RuntimeException("wrong result");
+        }
+        if ((f1 == f2) != shared) {
+            throw new RuntimeException("call sites " + (shared ? "not " : "") + "shared: " + f1 + " " + f2);
+        }
+        if (first() != f1 || second() != f2) {
+            throw new RuntimeException("linked call site changed");
+        }
+
+        IntSupplier s1 = capture(10);
+        IntSupplier s2 = captureOther(10);
+        if (s1.getAsInt() != 11 || s2.getAsInt() != 12) {
+            throw new RuntimeException("wrong captured result");
+        }
+        if (s1.getClass() == s2.getClass()) {
+            throw new RuntimeException("distinct lambdas share a class");
+        }
+    }
+}
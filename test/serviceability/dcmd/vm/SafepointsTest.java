@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import com.oracle.java.testlibrary.JDKToolFinder;
+import com.oracle.java.testlibrary.OutputAnalyzer;
+import com.oracle.java.testlibrary.ProcessTools;
+
+/*
+ * @test
+ * @summary Test of diagnostic command VM.safepoints
+ * @library /testlibrary
+ * @run main/othervm -XX:SafepointTraceBufferSize=8 SafepointsTest
+ */
+public class SafepointsTest {
+    private static volatile boolean done;
+    private static volatile int sink;
+
+    public static void main(String[] args) throws Exception {
+        // Keep a thread running Java code so that the VM thread has to wait
+        // for it, and it is reported as the last thread to reach the
+        // safepoint of the GC.
+        Thread spinner = new Thread("Spinner") {
+            public void run() {
+                int x = 0;
+                while (!done) {
+                    x = x * 31 + 1;
+                    sink = x;
+                }
+            }
+        };
+        spinner.start();
+        Thread.sleep(100);
+        System.gc();
+        done = true;
+        spinner.join();
+
+        String pid = Integer.toString(ProcessTools.getProcessId());
+        ProcessBuilder pb = new ProcessBuilder();
+        pb.command(new String[] { JDKToolFinder.getJDKTool("jcmd"), pid, "VM.safepoints"});
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("Last ");
+        output.shouldContain("safepoints:");
+        output.shouldContain("time to safepoint");
+        output.shouldMatch("last thread \"[^\"]+\" nid=");
+        output.shouldNotContain("Exception");
+    }
+}